@@ -0,0 +1,1747 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <unistd.h>
+#include "../include/gaea.h"
+
+#define BENCH_ARENA_CAPACITY BYTES_PER_KBYTE
+#define BENCH_ARENA_COUNT 1024
+#define BENCH_ARENA_FRAMES 4096
+#define BENCH_BASELINE_PATH "./bench/baseline.json"
+#define BENCH_CHUNK_ROUNDS 256
+#define BENCH_ENTITY_COUNT (1 << 14)
+#define BENCH_ENTITY_ROUNDS 64
+#define BENCH_EVENT_BUDGET (1 << 21) // ns, p99 enqueue-to-dispatch for input
+#define BENCH_EVENT_BURST 256
+#define BENCH_EVENT_COUNT (1 << 16)
+#define BENCH_EVENT_ROUNDS (1 << 12)
+#define BENCH_LOD_RADIUS 8
+#define BENCH_MATRIX_COUNT (1 << 20)
+#define BENCH_MATRIX_ERROR 1e-3 // units, eye-space error of a camera-relative chunk
+#define BENCH_MATRIX_ORIGIN 1e7 // units from the world origin
+#define BENCH_MATRIX_SAMPLE 64
+#define BENCH_MESH_ROUNDS 512
+#define BENCH_NOISE_COUNT (1 << 22)
+#define BENCH_OCCLUSION_ROUNDS 64
+#define BENCH_OUTPUT_PATH "./bench_result.json"
+#define BENCH_PNG_DEPTH 8
+#define BENCH_PNG_DIMENSION 512
+#define BENCH_PNG_PATH "./bench_image.png"
+#define BENCH_PNG_ROUNDS 64
+#define BENCH_POOL_COUNT (1 << 16)
+#define BENCH_POOL_ROUNDS 64
+#define BENCH_PROFILE_COUNT (1 << 20)
+#define BENCH_PROFILE_HISTORY 100
+#define BENCH_PROFILE_PATH "./bench_trace.json"
+#define BENCH_RANDOM_COUNT (1 << 20)
+#define BENCH_RANDOM_SEED 0x6761656100000000ULL
+#define BENCH_RAY_COUNT (1 << 16)
+#define BENCH_REGION_PATH "./bench_region/"
+#define BENCH_SIGNAL_COUNT (1 << 20)
+#define BENCH_SIGNAL_ROUNDS (1 << 14)
+#define BENCH_SIGNAL_TIMEOUT (1 << 20) // ns
+#define BENCH_SIGNAL_WAITERS 4
+#define BENCH_STREAM_DISTANCE 48
+#define BENCH_STREAM_FRAMES 4
+#define BENCH_STREAM_MEMORY (256 * BYTES_PER_KBYTE)
+#define BENCH_TERRAIN_RADIUS 4
+#define BENCH_TERRAIN_WORKERS 4
+#define BENCH_THRESHOLD_INIT 0.20
+#define BENCH_UID_COUNT (1 << 20)
+#define BENCH_WORLD_RADIUS 4
+
+/*
+ * Every reported timing is also collected by name. The run is written as JSON
+ * and, unless the baseline is being updated, compared against the stored
+ * baseline. An entry that slows by more than the threshold, or a missing
+ * baseline, fails the run.
+ */
+
+typedef std::chrono::steady_clock bench_clock;
+
+typedef struct {
+	size_t count;
+	double nanoseconds;
+} bench_result_t;
+
+typedef struct {
+	std::atomic<size_t> count;
+	uint64_t latency;
+} bench_event_t;
+
+typedef struct {
+	std::atomic<bool> blocked;
+	std::atomic<size_t> count;
+	std::vector<gaea::event_t> order;
+	std::atomic<bool> release;
+} bench_schedule_t;
+
+// mutex and condition variable signal, as used before the futex signal, for comparison
+typedef class _bench_condition {
+
+	public:
+
+		_bench_condition(void) :
+			m_notified(false)
+		{
+			return;
+		}
+
+		void notify(void)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			m_notified = true;
+			m_condition.notify_all();
+		}
+
+		void wait(void)
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			m_condition.wait(lock, [this] { return m_notified; });
+			m_notified = false;
+		}
+
+	protected:
+
+		std::condition_variable m_condition;
+
+		std::mutex m_mutex;
+
+		bool m_notified;
+
+} bench_condition;
+
+typedef gaea::engine::event::message<gaea::EVENT_INPUT_KEY, uint64_t> bench_message_t;
+
+typedef class _bench_receiver {
+
+	public:
+
+		_bench_receiver(void) :
+			m_count(0),
+			m_latency(0)
+		{
+			return;
+		}
+
+		void receive(
+			__in const bench_message_t &message
+			)
+		{
+			m_latency += (gaea::engine::profile::now() - message.value);
+			++m_count;
+		}
+
+		size_t m_count;
+
+		uint64_t m_latency;
+
+} bench_receiver;
+
+typedef class _bench_entity :
+		public gaea::engine::entity::base_model {
+
+	public:
+
+		_bench_entity(
+			__in const glm::dvec3 &position
+			) :
+				gaea::engine::entity::base_model(gaea::ENTITY_MODEL, ENTITY_SPECIFIER_UNDEFINED, position)
+		{
+			return;
+		}
+
+		void render(
+			__in const glm::dvec3 &position,
+			__in const glm::vec3 &rotation,
+			__in const glm::vec3 &up,
+			__in const glm::mat4 &projection,
+			__in const glm::mat4 &view
+			)
+		{
+			return;
+		}
+
+		void update(
+			__in GLfloat delta
+			)
+		{
+			m_position += glm::dvec3(m_rotation * delta);
+			update_model();
+		}
+
+} bench_entity;
+
+std::map<std::string, bench_result_t> bench_result;
+
+volatile uint64_t bench_sink = 0;
+
+void 
+report(
+	__in const std::string &name,
+	__in size_t count,
+	__in const bench_clock::duration &elapsed
+	)
+{
+	double total = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+	std::cout << std::left << std::setw(32) << name << std::right
+		<< std::setw(12) << count << " ops"
+		<< std::setw(12) << std::fixed << std::setprecision(2) << (total / count) << " ns/op"
+		<< std::setw(12) << std::setprecision(2) << ((count * 1000.0) / total) << " Mops/s"
+		<< std::endl;
+
+	bench_result[name].count = count;
+	bench_result[name].nanoseconds = (total / count);
+}
+
+bool 
+baseline_compare(
+	__in const std::map<std::string, bench_result_t> &baseline,
+	__in double threshold
+	)
+{
+	size_t compared = 0, regressed = 0;
+	std::map<std::string, bench_result_t>::const_iterator current, iter;
+
+	for(iter = baseline.begin(); iter != baseline.end(); ++iter) {
+
+		current = bench_result.find(iter->first);
+		if((current == bench_result.end()) || (iter->second.nanoseconds <= 0.0)) {
+			continue;
+		}
+
+		++compared;
+
+		if(current->second.nanoseconds > (iter->second.nanoseconds * (1.0 + threshold))) {
+			std::cerr << "baseline." << iter->first << ": " << std::fixed << std::setprecision(2)
+				<< current->second.nanoseconds << " ns/op (baseline " << iter->second.nanoseconds
+				<< " ns/op, +" << (((current->second.nanoseconds / iter->second.nanoseconds) - 1.0) * 100.0)
+				<< "%)" << std::endl;
+			++regressed;
+		}
+	}
+
+	std::cout << "BASELINE: " << compared << " compared, " << regressed << " regressed (threshold "
+		<< std::setprecision(0) << (threshold * 100.0) << "%)" << std::endl;
+
+	return !regressed;
+}
+
+bool 
+baseline_read(
+	__in const std::string &path,
+	__out std::map<std::string, bench_result_t> &baseline
+	)
+{
+	std::string line;
+	size_t begin, end;
+	bench_result_t entry;
+	std::ifstream file(path.c_str());
+
+	baseline.clear();
+
+	if(!file) {
+		return false;
+	}
+
+	while(std::getline(file, line)) {
+
+		begin = line.find("\"name\": \"");
+		if(begin == std::string::npos) {
+			continue;
+		}
+
+		begin += std::strlen("\"name\": \"");
+		end = line.find('"', begin);
+		if(end == std::string::npos) {
+			continue;
+		}
+
+		entry.count = std::strtoull(line.c_str() + line.find("\"count\": ") + std::strlen("\"count\": "),
+			nullptr, 10);
+		entry.nanoseconds = std::strtod(line.c_str() + line.find("\"ns_per_op\": ") + std::strlen("\"ns_per_op\": "),
+			nullptr);
+		baseline[line.substr(begin, end - begin)] = entry;
+	}
+
+	return true;
+}
+
+bool 
+baseline_write(
+	__in const std::string &path
+	)
+{
+	std::ofstream file(path.c_str(), std::ios::trunc);
+	std::map<std::string, bench_result_t>::iterator iter;
+
+	if(!file) {
+		return false;
+	}
+
+	file << "{" << std::endl << "\t\"version\": \"" << STRING_CHECK(gaea::version(true)) << "\"," << std::endl
+		<< "\t\"result\": [" << std::endl;
+
+	for(iter = bench_result.begin(); iter != bench_result.end(); ++iter) {
+		file << "\t\t{\"name\": \"" << iter->first << "\", \"count\": " << iter->second.count
+			<< ", \"ns_per_op\": " << std::fixed << std::setprecision(3) << iter->second.nanoseconds << "}"
+			<< ((std::next(iter) != bench_result.end()) ? "," : "") << std::endl;
+	}
+
+	file << "\t]" << std::endl << "}" << std::endl;
+
+	return file.good();
+}
+
+bool 
+bench_arena(void)
+{
+	size_t frame, iter;
+	bool result = true;
+	bench_clock::time_point begin, end;
+	gaea::engine::arena::statistic_t statistic;
+	gaea::engine::arena::manager &instance = gaea::engine::arena::manager::acquire();
+
+	begin = bench_clock::now();
+
+	for(frame = 0; frame < BENCH_ARENA_FRAMES; ++frame) {
+		std::vector<glm::ivec3> entry;
+
+		for(iter = 0; iter < BENCH_ARENA_COUNT; ++iter) {
+			entry.push_back(glm::ivec3(iter));
+		}
+
+		bench_sink += entry.back().x;
+	}
+
+	end = bench_clock::now();
+	report("arena.vector[heap]", BENCH_ARENA_FRAMES * BENCH_ARENA_COUNT, end - begin);
+
+	// start undersized, so the first frames overflow and the block grows
+	instance.initialize(BENCH_ARENA_CAPACITY);
+	begin = bench_clock::now();
+
+	for(frame = 0; frame < BENCH_ARENA_FRAMES; ++frame) {
+		instance.reset();
+
+		if(frame == 1) {
+			statistic = instance.statistic();
+		}
+
+		gaea::engine::arena::vector<glm::ivec3> entry;
+
+		for(iter = 0; iter < BENCH_ARENA_COUNT; ++iter) {
+			entry.push_back(glm::ivec3(iter));
+		}
+
+		bench_sink += entry.back().x;
+	}
+
+	end = bench_clock::now();
+	report("arena.vector[arena]", BENCH_ARENA_FRAMES * BENCH_ARENA_COUNT, end - begin);
+
+	result = (statistic.overflow && (instance.statistic().overflow == statistic.overflow)
+		&& (instance.statistic().capacity >= instance.statistic().high_water));
+	std::cout << "    " << instance.to_string(true) << std::endl;
+	instance.uninitialize();
+
+	return result;
+}
+
+bool 
+bench_pool(void)
+{
+	size_t iter, round;
+	bool result = true;
+	bench_clock::time_point begin, end;
+	gaea::engine::pool::statistic_t statistic;
+	gaea::engine::pool::manager &instance = gaea::engine::pool::manager::acquire();
+
+	begin = bench_clock::now();
+
+	for(round = 0; round < BENCH_POOL_ROUNDS; ++round) {
+		std::map<gaea::uid_t, size_t> entry;
+
+		for(iter = 0; iter < BENCH_POOL_COUNT; ++iter) {
+			entry.insert(std::pair<gaea::uid_t, size_t>(iter, round));
+		}
+
+		bench_sink += entry.size();
+	}
+
+	end = bench_clock::now();
+	report("pool.map[heap]", BENCH_POOL_ROUNDS * BENCH_POOL_COUNT, end - begin);
+
+	// the shared path hands every block straight back, so usage returns to where it started
+	instance.set_cached(false);
+	statistic = instance.statistic();
+	begin = bench_clock::now();
+
+	for(round = 0; round < BENCH_POOL_ROUNDS; ++round) {
+		gaea::engine::pool::map<gaea::uid_t, size_t> entry;
+
+		for(iter = 0; iter < BENCH_POOL_COUNT; ++iter) {
+			entry.insert(std::pair<gaea::uid_t, size_t>(iter, round));
+		}
+
+		bench_sink += entry.size();
+	}
+
+	end = bench_clock::now();
+	report("pool.map[shared]", BENCH_POOL_ROUNDS * BENCH_POOL_COUNT, end - begin);
+	result = (instance.statistic().used == statistic.used);
+	instance.set_cached(true);
+	begin = bench_clock::now();
+
+	for(round = 0; round < BENCH_POOL_ROUNDS; ++round) {
+		gaea::engine::pool::map<gaea::uid_t, size_t> entry;
+
+		if(round == 1) {
+			statistic = instance.statistic();
+		}
+
+		for(iter = 0; iter < BENCH_POOL_COUNT; ++iter) {
+			entry.insert(std::pair<gaea::uid_t, size_t>(iter, round));
+		}
+
+		bench_sink += entry.size();
+	}
+
+	end = bench_clock::now();
+	report("pool.map[cached]", BENCH_POOL_ROUNDS * BENCH_POOL_COUNT, end - begin);
+	result = (result && (instance.statistic().chunk == statistic.chunk));
+	std::cout << "    " << instance.to_string(true) << std::endl;
+
+	return result;
+}
+
+void 
+bench_chunk_linear(
+	__in gaea::block_t variety
+	)
+{
+	uint64_t sink = 0;
+	std::stringstream name;
+	gaea::engine::chunk::base chunk;
+	bench_clock::time_point begin, end;
+	uint32_t iter, round = 0, x, y, z;
+
+	begin = bench_clock::now();
+
+	for(; round < BENCH_CHUNK_ROUNDS; ++round) {
+
+		for(iter = 0, y = 0; y < CHUNK_WIDTH; ++y) {
+
+			for(z = 0; z < CHUNK_WIDTH; ++z) {
+
+				for(x = 0; x < CHUNK_WIDTH; ++x, ++iter) {
+					chunk.set(x, y, z, (iter + round) % variety);
+				}
+			}
+		}
+
+		for(y = 0; y < CHUNK_WIDTH; ++y) {
+
+			for(z = 0; z < CHUNK_WIDTH; ++z) {
+
+				for(x = 0; x < CHUNK_WIDTH; ++x) {
+					sink += chunk.get(x, y, z);
+				}
+			}
+		}
+	}
+
+	end = bench_clock::now();
+	bench_sink = bench_sink + sink;
+
+	name << "chunk.linear[" << variety << "]";
+	report(name.str(), 2 * BENCH_CHUNK_ROUNDS * CHUNK_VOLUME, end - begin);
+	std::cout << "    " << chunk.to_string() << std::endl;
+}
+
+void 
+bench_chunk_random(
+	__in gaea::block_t variety
+	)
+{
+	size_t iter = 0;
+	uint64_t sink = 0;
+	std::stringstream name;
+	gaea::engine::chunk::base chunk;
+	bench_clock::time_point begin, end;
+	std::mt19937_64 generator(BENCH_RANDOM_SEED);
+	std::vector<std::pair<glm::uvec3, gaea::block_t>> entry;
+
+	for(; iter < BENCH_RANDOM_COUNT; ++iter) {
+		entry.push_back(std::pair<glm::uvec3, gaea::block_t>(glm::uvec3(generator() % CHUNK_WIDTH,
+			generator() % CHUNK_WIDTH, generator() % CHUNK_WIDTH), generator() % variety));
+	}
+
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < entry.size(); ++iter) {
+		chunk.set(entry[iter].first, entry[iter].second);
+		sink += chunk.get(entry[(iter * 7) % entry.size()].first);
+	}
+
+	end = bench_clock::now();
+	bench_sink = bench_sink + sink;
+
+	name << "chunk.random[" << variety << "]";
+	report(name.str(), 2 * entry.size(), end - begin);
+	std::cout << "    " << chunk.to_string() << std::endl;
+}
+
+void 
+bench_entity_update(void)
+{
+	size_t iter = 0;
+	std::vector<bench_entity> entity;
+	bench_clock::time_point begin, end;
+	std::mt19937_64 generator(BENCH_RANDOM_SEED);
+	std::uniform_real_distribution<GLfloat> distribution(-1.f, 1.f);
+	gaea::engine::uid::manager &uid = gaea::engine::uid::manager::acquire();
+	gaea::engine::entity::manager &instance = gaea::engine::entity::manager::acquire();
+
+	uid.initialize();
+	instance.initialize();
+
+	// the manager holds references, so entries must never be relocated
+	entity.reserve(BENCH_ENTITY_COUNT);
+
+	for(; iter < BENCH_ENTITY_COUNT; ++iter) {
+		entity.emplace_back(glm::dvec3(glm::vec3(distribution(generator), distribution(generator),
+			distribution(generator)) * GLfloat(BENCH_WORLD_RADIUS * CHUNK_WIDTH)));
+	}
+
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < BENCH_ENTITY_ROUNDS; ++iter) {
+		instance.update(1.f / TICK_RATE_INIT);
+	}
+
+	end = bench_clock::now();
+	report("entity.update", BENCH_ENTITY_COUNT * BENCH_ENTITY_ROUNDS, end - begin);
+	bench_sink += (uint64_t) entity.back().model()[3][0];
+
+	entity.clear();
+	instance.uninitialize();
+	uid.uninitialize();
+}
+
+void 
+bench_event_handler(
+	__in gaea::engine::event::base &event,
+	__in void *context
+	)
+{
+	uint64_t stamp;
+	bench_event_t *state = (bench_event_t *) context;
+
+	std::memcpy(&stamp, event.context(), sizeof(stamp));
+	state->latency += (gaea::engine::profile::now() - stamp);
+	++state->count;
+}
+
+void 
+bench_event_schedule_handler(
+	__in gaea::engine::event::base &event,
+	__in void *context
+	)
+{
+	bench_schedule_t *state = (bench_schedule_t *) context;
+
+	if(!state->count) {
+		state->blocked = true;
+
+		while(!state->release) {
+			std::this_thread::yield();
+		}
+	}
+
+	state->order.push_back(event.type());
+	++state->count;
+}
+
+bool 
+bench_event_schedule(void)
+{
+	size_t iter = 0;
+	bool result = true;
+	bench_schedule_t state;
+	gaea::engine::event::statistic_t statistic;
+	gaea::engine::uid::manager &uid = gaea::engine::uid::manager::acquire();
+	gaea::engine::event::manager &instance = gaea::engine::event::manager::acquire();
+
+	uid.initialize();
+	instance.initialize();
+	instance.register_handler(bench_event_schedule_handler, gaea::EVENT_INPUT, &state);
+	instance.register_handler(bench_event_schedule_handler, gaea::EVENT_UNDEFINED, &state);
+
+	state.blocked = false;
+	state.count = 0;
+	state.release = false;
+
+	// hold the dispatcher on a low priority event while the queues fill
+	gaea::engine::event::notify(gaea::EVENT_UNDEFINED);
+
+	while(!state.blocked) {
+		std::this_thread::yield();
+	}
+
+	for(; iter < BENCH_EVENT_BURST; ++iter) {
+		gaea::engine::event::notify(gaea::EVENT_UNDEFINED);
+		gaea::engine::event::notify(gaea::EVENT_UNDEFINED, EVENT_SPECIFIER_UNDEFINED, nullptr, 0, 
+			EVENT_PRIORITY_TYPE, 1);
+	}
+
+	gaea::engine::event::notify(gaea::EVENT_INPUT, gaea::EVENT_INPUT_KEY);
+	state.release = true;
+
+	while(state.count < (BENCH_EVENT_BURST + 2)) {
+		std::this_thread::yield();
+	}
+
+	statistic = instance.statistic(gaea::EVENT_PRIORITY_LOW);
+	result = ((state.order.size() == (BENCH_EVENT_BURST + 2)) && (state.order.at(1) == gaea::EVENT_INPUT)
+		&& (statistic.dropped == BENCH_EVENT_BURST));
+
+	instance.unregister_handler(bench_event_schedule_handler, gaea::EVENT_UNDEFINED, &state);
+	instance.unregister_handler(bench_event_schedule_handler, gaea::EVENT_INPUT, &state);
+	instance.uninitialize();
+	uid.uninitialize();
+
+	return result;
+}
+
+bool 
+bench_event(void)
+{
+	uint64_t stamp;
+	size_t iter = 0;
+	bool result = true;
+	bench_event_t state;
+	bench_receiver receiver;
+	bench_clock::time_point begin, end;
+	gaea::engine::event::statistic_t statistic;
+	gaea::engine::event::channel<bench_message_t> &channel = gaea::engine::event::channel<bench_message_t>::acquire();
+	gaea::engine::uid::manager &uid = gaea::engine::uid::manager::acquire();
+	gaea::engine::event::manager &instance = gaea::engine::event::manager::acquire();
+
+	uid.initialize();
+	instance.initialize();
+	instance.register_handler(bench_event_handler, gaea::EVENT_INPUT, &state);
+
+	state.count = 0;
+	state.latency = 0;
+
+	for(; iter < BENCH_EVENT_ROUNDS; ++iter) {
+		stamp = gaea::engine::profile::now();
+		gaea::engine::event::notify(gaea::EVENT_INPUT, gaea::EVENT_INPUT_KEY, &stamp, sizeof(stamp));
+
+		while(state.count <= iter) {
+			std::this_thread::yield();
+		}
+	}
+
+	std::cout << std::left << std::setw(32) << "event.latency" << std::right << std::setw(12)
+		<< BENCH_EVENT_ROUNDS << " ops" << std::setw(12) << std::fixed << std::setprecision(2)
+		<< (state.latency / (double) BENCH_EVENT_ROUNDS) << " ns/op" << std::endl;
+	bench_result["event.latency"].count = BENCH_EVENT_ROUNDS;
+	bench_result["event.latency"].nanoseconds = (state.latency / (double) BENCH_EVENT_ROUNDS);
+
+	statistic = instance.statistic(gaea::EVENT_PRIORITY_HIGH);
+	std::cout << std::left << std::setw(32) << "event.queue[high]" << std::right << std::setw(12)
+		<< statistic.count << " ops" << std::setw(12) << statistic.p50 << " p50 ns" 
+		<< std::setw(12) << statistic.p99 << " p99 ns" << std::endl;
+	result = (statistic.p99 <= BENCH_EVENT_BUDGET);
+
+	state.count = 0;
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < BENCH_EVENT_COUNT; ++iter) {
+		stamp = gaea::engine::profile::now();
+		gaea::engine::event::notify(gaea::EVENT_INPUT, gaea::EVENT_INPUT_KEY, &stamp, sizeof(stamp));
+	}
+
+	while(state.count < BENCH_EVENT_COUNT) {
+		std::this_thread::yield();
+	}
+
+	end = bench_clock::now();
+	report("event.throughput", BENCH_EVENT_COUNT, end - begin);
+
+	instance.unregister_handler(bench_event_handler, gaea::EVENT_INPUT, &state);
+	instance.uninitialize();
+	uid.uninitialize();
+
+	channel.subscribe(&receiver);
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < BENCH_EVENT_COUNT; ++iter) {
+		gaea::engine::event::publish(bench_message_t { gaea::engine::profile::now() });
+	}
+
+	end = bench_clock::now();
+	report("event.channel", BENCH_EVENT_COUNT, end - begin);
+
+	result = (result && (receiver.m_count == BENCH_EVENT_COUNT));
+	channel.unsubscribe(&receiver);
+
+	return result;
+}
+
+bool 
+bench_matrix(void)
+{
+	size_t iter = 0;
+	glm::vec3 direction, relative;
+	glm::vec4 expected, point = glm::vec4(0.f, 0.f, 0.f, 1.f);
+	glm::mat4 projection, view, world;
+	bench_clock::time_point begin, end;
+	double error_relative = 0.0, error_world = 0.0;
+	glm::dvec3 corner, origin = glm::dvec3(BENCH_MATRIX_ORIGIN, 0.0, BENCH_MATRIX_ORIGIN);
+	std::vector<glm::mat4> model, result;
+	std::vector<gaea::engine::entity::transform_t> transform;
+	std::mt19937_64 generator(BENCH_RANDOM_SEED);
+	std::uniform_real_distribution<GLfloat> distribution(-1.f, 1.f);
+
+	transform.resize(BENCH_MATRIX_COUNT);
+	model.resize(BENCH_MATRIX_COUNT);
+	result.resize(BENCH_MATRIX_COUNT);
+
+	for(; iter < BENCH_MATRIX_COUNT; ++iter) {
+		transform[iter].position = (origin + glm::dvec3(distribution(generator), distribution(generator),
+			distribution(generator)));
+		transform[iter].rotation = glm::vec3(distribution(generator), distribution(generator), 1.f);
+		transform[iter].up = ENTITY_UP_INIT;
+	}
+
+	projection = glm::perspective(glm::radians(CAMERA_FOV_INIT), 4.f / 3.f, CAMERA_CLIP_MIN,
+		CAMERA_CLIP_FAR_INIT);
+	direction = glm::normalize(glm::vec3(1.f, 0.f, 1.f));
+	view = glm::lookAt(glm::vec3(), direction, ENTITY_UP_INIT);
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < BENCH_MATRIX_COUNT; ++iter) {
+		relative = glm::vec3(transform[iter].position - origin);
+		model[iter] = glm::lookAt(relative, relative + transform[iter].rotation, transform[iter].up);
+	}
+
+	end = bench_clock::now();
+	report("matrix.model[batch]", BENCH_MATRIX_COUNT, end - begin);
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < BENCH_MATRIX_COUNT; ++iter) {
+		result[iter] = (projection * view * model[iter]);
+	}
+
+	end = bench_clock::now();
+	report("matrix.mvp[batch]", BENCH_MATRIX_COUNT, end - begin);
+	bench_sink += (uint64_t) result.back()[3][3];
+
+	// a chunk corner near the camera, placed camera-relative and in world-space float
+	world = glm::lookAt(glm::vec3(origin), glm::vec3(origin) + direction, ENTITY_UP_INIT);
+
+	for(iter = 0; iter < BENCH_MATRIX_SAMPLE; ++iter) {
+		corner = glm::floor(transform[iter].position);
+		expected = (view * glm::vec4(glm::vec3(corner - origin), 1.f));
+		error_relative = std::max(error_relative, (double) glm::distance(expected,
+			view * glm::translate(glm::mat4(1.f), glm::vec3(corner - origin)) * point));
+		error_world = std::max(error_world, (double) glm::distance(expected,
+			world * glm::translate(glm::mat4(1.f), glm::vec3(corner)) * point));
+	}
+
+	std::cout << "    matrix.error: relative=" << std::scientific << error_relative << ", world=" << error_world
+		<< std::fixed << std::endl;
+
+	return (error_relative <= BENCH_MATRIX_ERROR);
+}
+
+void 
+bench_mesh_generate(
+	__in bool checker
+	)
+{
+	size_t round = 0;
+	uint64_t sink = 0;
+	std::vector<gaea::block_t> padded;
+	gaea::engine::mesh::data_t data;
+	uint32_t height, x, y, z;
+	gaea::engine::chunk::base chunk;
+	bench_clock::time_point begin, end;
+	const gaea::engine::chunk::base *neighbour[MESH_NEIGHBOUR_COUNT] = { nullptr };
+
+	for(z = 0; z < CHUNK_WIDTH; ++z) {
+
+		for(x = 0; x < CHUNK_WIDTH; ++x) {
+			height = ((CHUNK_WIDTH / 2) + ((x * 3 + z * 5) % 5));
+
+			for(y = 0; y < CHUNK_WIDTH; ++y) {
+
+				if(checker) {
+					chunk.set(x, y, z, ((x + y + z) & 1) ? BLOCK_AIR : 1);
+				} else if(y < height) {
+					chunk.set(x, y, z, (y + 1 == height) ? 1 : ((y + 4 > height) ? 2 : 3));
+				}
+			}
+		}
+	}
+
+	neighbour[MESH_NEIGHBOUR_CENTER] = &chunk;
+	begin = bench_clock::now();
+
+	for(; round < BENCH_MESH_ROUNDS; ++round) {
+		gaea::engine::mesh::pad(neighbour, padded);
+		gaea::engine::mesh::generate(padded, data);
+		sink += data.index.size();
+	}
+
+	end = bench_clock::now();
+	bench_sink = bench_sink + sink;
+
+	report(checker ? "mesh.generate[checker]" : "mesh.generate[terrain]", BENCH_MESH_ROUNDS, end - begin);
+	std::cout << "    QUADS=" << (data.vertex.size() / 4) << ", VERTS=" << data.vertex.size()
+		<< ", IDX=" << data.index.size() << std::endl;
+}
+
+void 
+bench_mesh_lod(
+	__in int32_t radius
+	)
+{
+	glm::ivec3 coordinate;
+	std::stringstream name;
+	std::vector<gaea::block_t> coarse, padded;
+	gaea::engine::chunk::base chunk;
+	gaea::engine::mesh::data_t data;
+	std::vector<glm::ivec3> entry;
+	std::vector<glm::ivec3>::iterator iter;
+	int32_t neighbour_x, neighbour_y, neighbour_z, x, y, z;
+	bench_clock::time_point begin, end;
+	uint32_t level;
+	size_t full = 0, full_memory = 0, reduced = 0, reduced_memory = 0;
+	const gaea::engine::chunk::base *neighbour[MESH_NEIGHBOUR_COUNT];
+	gaea::engine::terrain::base generator(BENCH_RANDOM_SEED);
+	gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+
+	world.initialize();
+
+	for(z = -radius; z <= radius; ++z) {
+
+		for(x = -radius; x <= radius; ++x) {
+
+			if(((x * x) + (z * z)) > (radius * radius)) {
+				continue;
+			}
+
+			for(y = TERRAIN_CHUNK_BOTTOM; y <= TERRAIN_CHUNK_TOP; ++y) {
+				coordinate = glm::ivec3(x, y, z);
+				generator.generate(coordinate, chunk);
+				world.set_chunk(coordinate, chunk);
+			}
+		}
+	}
+
+	entry = world.coordinates();
+	begin = bench_clock::now();
+
+	for(iter = entry.begin(); iter != entry.end(); ++iter) {
+
+		for(neighbour_z = -1; neighbour_z <= 1; ++neighbour_z) {
+
+			for(neighbour_y = -1; neighbour_y <= 1; ++neighbour_y) {
+
+				for(neighbour_x = -1; neighbour_x <= 1; ++neighbour_x) {
+					coordinate = (*iter + glm::ivec3(neighbour_x, neighbour_y, neighbour_z));
+					neighbour[(neighbour_x + 1) + ((neighbour_y + 1) * 3) + ((neighbour_z + 1) * 9)] =
+						(world.contains(coordinate) ? &world.chunk(coordinate) : nullptr);
+				}
+			}
+		}
+
+		gaea::engine::mesh::pad(neighbour, padded);
+		gaea::engine::mesh::generate(padded, data);
+		full += (data.index.size() / 3);
+		full_memory += ((data.vertex.size() * sizeof(gaea::engine::mesh::vertex_t))
+			+ (data.index.size() * sizeof(uint32_t)));
+
+		level = gaea::engine::mesh::lod(*iter, glm::ivec3(0), MESH_LOD_DISTANCE_INIT);
+		gaea::engine::mesh::downsample(padded, level, coarse);
+		gaea::engine::mesh::generate(coarse, data, level);
+		reduced += (data.index.size() / 3);
+		reduced_memory += ((data.vertex.size() * sizeof(gaea::engine::mesh::vertex_t))
+			+ (data.index.size() * sizeof(uint32_t)));
+	}
+
+	end = bench_clock::now();
+
+	name << "mesh.lod[" << radius << "]";
+	report(name.str(), entry.size(), end - begin);
+	std::cout << "    TRIS=" << full << " -> " << reduced
+		<< ", MEM=" << (full_memory / BYTES_PER_KBYTE) << " KB -> " << (reduced_memory / BYTES_PER_KBYTE) << " KB"
+		<< std::endl;
+
+	world.uninitialize();
+}
+
+void 
+bench_noise(
+	__in bool lane
+	)
+{
+	size_t iter = 0, offset;
+	float result[NOISE_LANE], sum = 0.f, x[NOISE_LANE], y[NOISE_LANE], z[NOISE_LANE];
+	bench_clock::time_point begin, end;
+	gaea::engine::noise::base noise(BENCH_RANDOM_SEED);
+
+	begin = bench_clock::now();
+
+	for(; iter < BENCH_NOISE_COUNT; iter += NOISE_LANE) {
+
+		for(offset = 0; offset < NOISE_LANE; ++offset) {
+			x[offset] = ((iter + offset) * 0.173f);
+			y[offset] = (iter * 0.031f);
+			z[offset] = (offset * 0.719f);
+		}
+
+		if(lane) {
+			noise.perlin(x, y, z, result);
+		} else {
+
+			for(offset = 0; offset < NOISE_LANE; ++offset) {
+				result[offset] = noise.perlin(x[offset], y[offset], z[offset]);
+			}
+		}
+
+		for(offset = 0; offset < NOISE_LANE; ++offset) {
+			sum += result[offset];
+		}
+	}
+
+	end = bench_clock::now();
+	bench_sink = bench_sink + (uint64_t) std::fabs(sum);
+
+	report(lane ? "noise.perlin[lane]" : "noise.perlin[scalar]", BENCH_NOISE_COUNT, end - begin);
+	std::cout << "    " << noise.to_string() << std::endl;
+}
+
+uint64_t 
+bench_terrain_checksum(void)
+{
+	gaea::block_t block;
+	glm::ivec3 coordinate;
+	uint64_t result = 0xcbf29ce484222325ULL;
+	int32_t x, y, z, voxel_x, voxel_y, voxel_z;
+	gaea::engine::world::manager &instance = gaea::engine::world::manager::acquire();
+
+	for(z = -BENCH_TERRAIN_RADIUS; z <= BENCH_TERRAIN_RADIUS; ++z) {
+
+		for(x = -BENCH_TERRAIN_RADIUS; x <= BENCH_TERRAIN_RADIUS; ++x) {
+
+			for(y = TERRAIN_CHUNK_BOTTOM; y <= TERRAIN_CHUNK_TOP; ++y) {
+				coordinate = glm::ivec3(x, y, z);
+
+				if(!instance.contains(coordinate)) {
+					continue;
+				}
+
+				gaea::engine::chunk::base &chunk = instance.chunk(coordinate);
+				for(voxel_y = 0; voxel_y < CHUNK_WIDTH; ++voxel_y) {
+
+					for(voxel_z = 0; voxel_z < CHUNK_WIDTH; ++voxel_z) {
+
+						for(voxel_x = 0; voxel_x < CHUNK_WIDTH; ++voxel_x) {
+							block = chunk.get(voxel_x, voxel_y, voxel_z);
+							result = ((result ^ block) * 0x100000001b3ULL);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+bool 
+bench_occlusion(void)
+{
+	bool result;
+	glm::vec3 eye;
+	glm::mat4 projection, transform;
+	glm::ivec3 coordinate;
+	std::vector<gaea::block_t> padded;
+	gaea::engine::chunk::base chunk;
+	gaea::engine::ray::hit_t hit;
+	gaea::engine::occlusion::base buffer;
+	gaea::engine::occlusion::box_t box;
+	size_t culled = 0, round = 0;
+	std::vector<glm::ivec3> entry;
+	std::vector<glm::ivec3>::iterator iter;
+	bench_clock::time_point begin, end;
+	std::vector<gaea::engine::occlusion::box_t> bounds, occluder;
+	std::vector<gaea::engine::occlusion::box_t>::iterator bounds_iter;
+	int32_t neighbour_x, neighbour_y, neighbour_z, x, y, z;
+	const gaea::engine::chunk::base *neighbour[MESH_NEIGHBOUR_COUNT];
+	gaea::engine::terrain::base terrain(BENCH_RANDOM_SEED);
+	gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+
+	projection = glm::perspective(glm::radians(CAMERA_FOV_INIT), OCCLUSION_WIDTH / (GLfloat) OCCLUSION_HEIGHT,
+		CAMERA_CLIP_MIN, CAMERA_CLIP_FAR_INIT);
+
+	transform = (projection * glm::lookAt(glm::vec3(0.f), glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 1.f, 0.f)));
+	box.minimum = glm::vec3(CHUNK_WIDTH, -CHUNK_WIDTH, -CHUNK_WIDTH);
+	box.maximum = glm::vec3(CHUNK_WIDTH + 1, CHUNK_WIDTH, CHUNK_WIDTH);
+	buffer.rasterize(transform, box);
+	box.minimum = glm::vec3(2 * CHUNK_WIDTH, -1.f, -1.f);
+	box.maximum = glm::vec3((2 * CHUNK_WIDTH) + 1, 1.f, 1.f);
+	result = !buffer.visible(transform, box);
+	box.minimum.x = (CHUNK_WIDTH / 2);
+	box.maximum.x = ((CHUNK_WIDTH / 2) + 1);
+	result = (result && buffer.visible(transform, box));
+
+	world.initialize();
+
+	for(z = -BENCH_TERRAIN_RADIUS; z < BENCH_TERRAIN_RADIUS; ++z) {
+
+		for(x = -BENCH_TERRAIN_RADIUS; x < BENCH_TERRAIN_RADIUS; ++x) {
+
+			for(y = TERRAIN_CHUNK_BOTTOM; y <= TERRAIN_CHUNK_TOP; ++y) {
+				coordinate = glm::ivec3(x, y, z);
+				terrain.generate(coordinate, chunk);
+				world.set_chunk(coordinate, chunk);
+			}
+		}
+	}
+
+	entry = world.coordinates();
+
+	for(iter = entry.begin(); iter != entry.end(); ++iter) {
+
+		for(neighbour_z = -1; neighbour_z <= 1; ++neighbour_z) {
+
+			for(neighbour_y = -1; neighbour_y <= 1; ++neighbour_y) {
+
+				for(neighbour_x = -1; neighbour_x <= 1; ++neighbour_x) {
+					coordinate = (*iter + glm::ivec3(neighbour_x, neighbour_y, neighbour_z));
+					neighbour[(neighbour_x + 1) + ((neighbour_y + 1) * 3) + ((neighbour_z + 1) * 9)] =
+						(world.contains(coordinate) ? &world.chunk(coordinate) : nullptr);
+				}
+			}
+		}
+
+		gaea::engine::mesh::pad(neighbour, padded);
+		box.minimum = glm::vec3(*iter * CHUNK_WIDTH);
+		box.maximum = (box.minimum + glm::vec3(CHUNK_WIDTH));
+		bounds.push_back(box);
+
+		box.maximum.y = (box.minimum.y + gaea::engine::mesh::hull(padded));
+		if(box.maximum.y > box.minimum.y) {
+			occluder.push_back(box);
+		}
+	}
+
+	eye = glm::vec3(-BENCH_TERRAIN_RADIUS * CHUNK_WIDTH, (TERRAIN_CHUNK_TOP + 1) * CHUNK_WIDTH, 0.f) + glm::vec3(0.5f);
+	if(gaea::engine::ray::cast(eye, glm::vec3(0.f, -1.f, 0.f), hit, (TERRAIN_CHUNK_TOP - TERRAIN_CHUNK_BOTTOM + 1)
+			* CHUNK_WIDTH)) {
+		eye.y = (hit.position.y + 2.f);
+	}
+
+	transform = (projection * glm::lookAt(eye, eye + glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 1.f, 0.f)));
+	begin = bench_clock::now();
+
+	for(; round < BENCH_OCCLUSION_ROUNDS; ++round) {
+		buffer.clear();
+		buffer.rasterize(transform, occluder);
+	}
+
+	end = bench_clock::now();
+	report("occlusion.rasterize", BENCH_OCCLUSION_ROUNDS * occluder.size(), end - begin);
+	begin = bench_clock::now();
+
+	for(round = 0; round < BENCH_OCCLUSION_ROUNDS; ++round) {
+
+		for(bounds_iter = bounds.begin(); bounds_iter != bounds.end(); ++bounds_iter) {
+			culled += !buffer.visible(transform, *bounds_iter);
+		}
+	}
+
+	end = bench_clock::now();
+	report("occlusion.test", BENCH_OCCLUSION_ROUNDS * bounds.size(), end - begin);
+	std::cout << "    CULLED=" << (culled / BENCH_OCCLUSION_ROUNDS) << "/" << bounds.size()
+		<< ", OCCLUDERS=" << occluder.size() << std::endl;
+
+	world.uninitialize();
+
+	return result;
+}
+
+bool 
+bench_png_write(
+	__in const std::string &path
+	)
+{
+	size_t x, y;
+	FILE *file = nullptr;
+	bool result = false;
+	png_infop writer_info = nullptr;
+	png_structp writer = nullptr;
+	std::vector<png_byte> row(BENCH_PNG_DIMENSION * 4);
+	std::mt19937_64 generator(BENCH_RANDOM_SEED);
+
+	file = std::fopen(path.c_str(), "wb");
+	if(!file) {
+		return result;
+	}
+
+	writer = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+	if(writer) {
+		writer_info = png_create_info_struct(writer);
+	}
+
+	if(writer_info && !setjmp(png_jmpbuf(writer))) {
+		png_init_io(writer, file);
+		png_set_IHDR(writer, writer_info, BENCH_PNG_DIMENSION, BENCH_PNG_DIMENSION, BENCH_PNG_DEPTH,
+			PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+		png_write_info(writer, writer_info);
+
+		for(y = 0; y < BENCH_PNG_DIMENSION; ++y) {
+
+			// smooth gradients with sparse noise, so the image compresses like a texture
+			for(x = 0; x < row.size(); ++x) {
+				row[x] = (png_byte) (((x / 4) + y) ^ ((generator() & 0x7) ? 0 : (generator() & 0xff)));
+			}
+
+			png_write_row(writer, row.data());
+		}
+
+		png_write_end(writer, nullptr);
+		result = true;
+	}
+
+	png_destroy_write_struct(&writer, writer_info ? &writer_info : nullptr);
+	std::fclose(file);
+
+	return result;
+}
+
+void 
+bench_png(void)
+{
+	size_t iter = 0;
+	glm::ivec2 dimensions;
+	uint8_t color, depth;
+	std::vector<uint8_t> data;
+	bench_clock::time_point begin, end;
+
+	if(!bench_png_write(BENCH_PNG_PATH)) {
+		std::cerr << "png.decode: failed to write " << BENCH_PNG_PATH << std::endl;
+		return;
+	}
+
+	begin = bench_clock::now();
+
+	for(; iter < BENCH_PNG_ROUNDS; ++iter) {
+		gaea::graphics::texture::import(BENCH_PNG_PATH, gaea::IMAGE_PNG, data, dimensions, color, depth);
+		bench_sink += data.size();
+	}
+
+	end = bench_clock::now();
+	report("png.decode", BENCH_PNG_ROUNDS, end - begin);
+	std::cout << "    " << dimensions.x << "x" << dimensions.y << ", " << data.size() << " bytes" << std::endl;
+	std::remove(BENCH_PNG_PATH);
+}
+
+bool 
+bench_profile(void)
+{
+	uint64_t sample;
+	bool result = true;
+	bench_clock::time_point begin, end;
+	gaea::engine::profile::statistic_t statistic;
+	gaea::engine::profile::manager &profile = gaea::engine::profile::manager::acquire();
+
+	profile.initialize(BENCH_PROFILE_HISTORY, true);
+
+	for(sample = 1; sample <= (2 * BENCH_PROFILE_HISTORY); ++sample) {
+		profile.record("window", 0, (sample > BENCH_PROFILE_HISTORY) ? (sample - BENCH_PROFILE_HISTORY) : 0);
+	}
+
+	statistic = profile.statistic("window");
+	result = ((statistic.count == (2 * BENCH_PROFILE_HISTORY)) && (statistic.minimum == 1)
+		&& (statistic.maximum == BENCH_PROFILE_HISTORY) && (statistic.average == (BENCH_PROFILE_HISTORY / 2))
+		&& (statistic.p99 == (BENCH_PROFILE_HISTORY - 1)));
+
+	begin = bench_clock::now();
+
+	for(sample = 0; sample < BENCH_PROFILE_COUNT; ++sample) {
+		gaea::engine::profile::scope scope("scope");
+	}
+
+	end = bench_clock::now();
+	report("profile.scope", BENCH_PROFILE_COUNT, end - begin);
+
+	statistic = profile.statistic("scope");
+	std::cout << "    MIN=" << statistic.minimum << " ns, AVG=" << statistic.average
+		<< " ns, P99=" << statistic.p99 << " ns" << std::endl;
+
+	begin = bench_clock::now();
+	profile.dump(BENCH_PROFILE_PATH);
+	end = bench_clock::now();
+	report("profile.dump", PROFILE_TRACE_MAX, end - begin);
+	std::remove(BENCH_PROFILE_PATH);
+
+	profile.uninitialize();
+
+	return result;
+}
+
+void 
+bench_ray(void)
+{
+	int32_t x, y, z;
+	size_t hit, iter = 0;
+	glm::ivec3 coordinate;
+	bench_clock::time_point begin, end;
+	gaea::engine::chunk::base chunk;
+	gaea::engine::ray::ray_t entry;
+	std::vector<gaea::engine::ray::hit_t> result;
+	std::vector<gaea::engine::ray::ray_t> ray;
+	std::mt19937_64 generator(BENCH_RANDOM_SEED);
+	std::uniform_real_distribution<GLfloat> distribution(-1.f, 1.f);
+	gaea::engine::terrain::base terrain(BENCH_RANDOM_SEED);
+	gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+
+	world.initialize();
+
+	for(z = -BENCH_TERRAIN_RADIUS; z < BENCH_TERRAIN_RADIUS; ++z) {
+
+		for(x = -BENCH_TERRAIN_RADIUS; x < BENCH_TERRAIN_RADIUS; ++x) {
+
+			for(y = TERRAIN_CHUNK_BOTTOM; y <= TERRAIN_CHUNK_TOP; ++y) {
+				coordinate = glm::ivec3(x, y, z);
+				terrain.generate(coordinate, chunk);
+				world.set_chunk(coordinate, chunk);
+			}
+		}
+	}
+
+	for(; iter < BENCH_RAY_COUNT; ++iter) {
+		entry.origin = glm::vec3(distribution(generator), distribution(generator), distribution(generator))
+			* GLfloat(BENCH_TERRAIN_RADIUS * CHUNK_WIDTH);
+		entry.direction = glm::vec3(distribution(generator), distribution(generator), distribution(generator));
+		entry.distance = RAY_DISTANCE_INIT;
+
+		if(entry.direction == glm::vec3(0.f)) {
+			entry.direction.y = -1.f;
+		}
+
+		ray.push_back(entry);
+	}
+
+	begin = bench_clock::now();
+	hit = gaea::engine::ray::cast(ray, result);
+	end = bench_clock::now();
+	report("ray.cast[batch]", BENCH_RAY_COUNT, end - begin);
+	std::cout << "    HITS=" << hit << "/" << BENCH_RAY_COUNT << std::endl;
+
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < BENCH_RAY_COUNT; ++iter) {
+		bench_sink += gaea::engine::ray::cast(ray[iter].origin, ray[iter].direction, result[iter],
+			ray[iter].distance);
+	}
+
+	end = bench_clock::now();
+	report("ray.cast[single]", BENCH_RAY_COUNT, end - begin);
+
+	world.uninitialize();
+}
+
+bool 
+bench_region(void)
+{
+	size_t count = 0;
+	bool result = true;
+	int32_t x, y, z;
+	glm::ivec3 coordinate, key;
+	std::set<std::string> path;
+	std::set<std::string>::iterator path_iter;
+	std::vector<gaea::block_t> expected, loaded;
+	std::vector<gaea::engine::region::result_t> collected;
+	std::vector<gaea::engine::region::result_t>::iterator iter;
+	std::unordered_map<glm::ivec3, gaea::engine::chunk::base, gaea::engine::chunk::hash_t> chunk;
+	std::unordered_map<glm::ivec3, gaea::engine::chunk::base, gaea::engine::chunk::hash_t>::iterator chunk_iter;
+	bench_clock::time_point begin, end;
+	gaea::engine::terrain::base generator(BENCH_RANDOM_SEED);
+	gaea::engine::region::manager &instance = gaea::engine::region::manager::acquire();
+
+	for(z = -BENCH_TERRAIN_RADIUS; z < BENCH_TERRAIN_RADIUS; ++z) {
+
+		for(x = -BENCH_TERRAIN_RADIUS; x < BENCH_TERRAIN_RADIUS; ++x) {
+
+			for(y = TERRAIN_CHUNK_BOTTOM; y <= TERRAIN_CHUNK_TOP; ++y) {
+				std::stringstream name;
+
+				coordinate = glm::ivec3(x, y, z);
+				generator.generate(coordinate, chunk[coordinate]);
+
+				key = gaea::engine::region::coordinate(coordinate);
+				name << BENCH_REGION_PATH << "r." << key.x << "." << key.y << "." << key.z << ".grg";
+				path.insert(name.str());
+			}
+		}
+	}
+
+	instance.initialize(BENCH_REGION_PATH);
+	begin = bench_clock::now();
+
+	for(chunk_iter = chunk.begin(); chunk_iter != chunk.end(); ++chunk_iter) {
+		instance.save(chunk_iter->first, chunk_iter->second);
+	}
+
+	while(instance.pending()) {
+		std::this_thread::yield();
+	}
+
+	end = bench_clock::now();
+	report("region.save", chunk.size(), end - begin);
+	begin = bench_clock::now();
+
+	for(chunk_iter = chunk.begin(); chunk_iter != chunk.end(); ++chunk_iter) {
+		instance.load(chunk_iter->first);
+	}
+
+	while(count < chunk.size()) {
+		instance.collect(collected);
+
+		for(iter = collected.begin(); iter != collected.end(); ++count, ++iter) {
+
+			if(iter->found) {
+				iter->chunk.serialize(loaded);
+				chunk[iter->coordinate].serialize(expected);
+			}
+
+			result = (result && iter->found && (loaded == expected));
+		}
+
+		std::this_thread::yield();
+	}
+
+	end = bench_clock::now();
+
+	report("region.load", count, end - begin);
+	std::cout << "    " << instance.to_string() << std::endl;
+	instance.uninitialize();
+
+	for(path_iter = path.begin(); path_iter != path.end(); ++path_iter) {
+		std::remove(path_iter->c_str());
+	}
+
+	rmdir(BENCH_REGION_PATH);
+
+	return result;
+}
+
+template <class T> void 
+bench_signal_pair(
+	__in const std::string &name
+	)
+{
+	size_t iter = 0;
+	T ping, pong, idle;
+	bench_clock::time_point begin, end;
+
+	begin = bench_clock::now();
+
+	for(; iter < BENCH_SIGNAL_COUNT; ++iter) {
+		idle.notify();
+	}
+
+	end = bench_clock::now();
+	report("signal.notify[" + name + "]", BENCH_SIGNAL_COUNT, end - begin);
+
+	std::thread worker([&ping, &pong] {
+
+		for(size_t round = 0; round < BENCH_SIGNAL_ROUNDS; ++round) {
+			ping.wait();
+			pong.notify();
+		}
+	});
+
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < BENCH_SIGNAL_ROUNDS; ++iter) {
+		ping.notify();
+		pong.wait();
+	}
+
+	end = bench_clock::now();
+	worker.join();
+	report("signal.wake[" + name + "]", BENCH_SIGNAL_ROUNDS, end - begin);
+}
+
+bool 
+bench_signal(void)
+{
+	size_t iter = 0;
+	bool result = true;
+	std::vector<std::thread> worker;
+	std::atomic<size_t> complete(0);
+	bench_clock::time_point begin, end;
+	gaea::engine::signal::base instance;
+
+	bench_signal_pair<bench_condition>("condition");
+	bench_signal_pair<gaea::engine::signal::base>("futex");
+
+	begin = bench_clock::now();
+	result = !instance.wait_for(BENCH_SIGNAL_TIMEOUT);
+	end = bench_clock::now();
+	result = (result && ((end - begin) >= std::chrono::nanoseconds(BENCH_SIGNAL_TIMEOUT)));
+
+	instance.notify();
+	result = (result && instance.wait_for(0) && !instance.is_notified());
+
+	// every parked waiter must eventually see a notification
+	for(; iter < BENCH_SIGNAL_WAITERS; ++iter) {
+		worker.push_back(std::thread([&instance, &complete] {
+			instance.wait();
+			++complete;
+		}));
+	}
+
+	while(complete < BENCH_SIGNAL_WAITERS) {
+		instance.notify();
+		std::this_thread::yield();
+	}
+
+	for(iter = 0; iter < worker.size(); ++iter) {
+		worker.at(iter).join();
+	}
+
+	return (result && !instance.waiting());
+}
+
+void 
+bench_stream_walk(void)
+{
+	size_t frame = 0, peak = 0;
+	bench_clock::time_point begin, end, frame_begin;
+	bench_clock::duration frame_max = bench_clock::duration::zero();
+	gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+	gaea::engine::stream::manager &instance = gaea::engine::stream::manager::acquire();
+	gaea::engine::terrain::manager &terrain = gaea::engine::terrain::manager::acquire();
+
+	world.initialize();
+	terrain.initialize(BENCH_RANDOM_SEED, BENCH_TERRAIN_WORKERS, BENCH_TERRAIN_RADIUS);
+	instance.initialize(1, BENCH_STREAM_MEMORY);
+	begin = bench_clock::now();
+
+	for(; frame < (BENCH_STREAM_DISTANCE * BENCH_STREAM_FRAMES); ++frame) {
+		frame_begin = bench_clock::now();
+		instance.update(glm::vec3((frame / BENCH_STREAM_FRAMES) * CHUNK_WIDTH, 0.f, 0.f));
+		frame_max = std::max(frame_max, bench_clock::now() - frame_begin);
+		peak = std::max(peak, instance.memory());
+		std::this_thread::yield();
+	}
+
+	end = bench_clock::now();
+
+	report("stream.walk", frame, end - begin);
+	std::cout << "    PEAK=" << (peak / BYTES_PER_KBYTE) << " KB, FRAME_MAX="
+		<< std::chrono::duration_cast<std::chrono::microseconds>(frame_max).count() << " us, CHUNKS="
+		<< world.size() << std::endl
+		<< "    " << instance.to_string() << std::endl;
+
+	instance.uninitialize();
+	terrain.uninitialize();
+	world.uninitialize();
+}
+
+void 
+bench_terrain_generate(void)
+{
+	size_t count = 0;
+	uint64_t sink = 0;
+	int32_t x, y, z;
+	gaea::engine::chunk::base chunk;
+	bench_clock::time_point begin, end;
+	gaea::engine::terrain::base generator(BENCH_RANDOM_SEED);
+
+	begin = bench_clock::now();
+
+	for(z = -BENCH_TERRAIN_RADIUS; z < BENCH_TERRAIN_RADIUS; ++z) {
+
+		for(x = -BENCH_TERRAIN_RADIUS; x < BENCH_TERRAIN_RADIUS; ++x) {
+
+			for(y = TERRAIN_CHUNK_BOTTOM; y <= TERRAIN_CHUNK_TOP; ++y, ++count) {
+				generator.generate(glm::ivec3(x, y, z), chunk);
+				sink += chunk.palette_size();
+			}
+		}
+	}
+
+	end = bench_clock::now();
+	bench_sink = bench_sink + sink;
+
+	report("terrain.generate", count, end - begin);
+	std::cout << "    " << generator.to_string() << std::endl;
+}
+
+uint64_t 
+bench_terrain_pipeline(
+	__in size_t workers
+	)
+{
+	uint64_t result;
+	std::stringstream name;
+	bench_clock::time_point begin, end;
+	gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+	gaea::engine::terrain::manager &instance = gaea::engine::terrain::manager::acquire();
+
+	world.initialize();
+	instance.initialize(BENCH_RANDOM_SEED, workers, BENCH_TERRAIN_RADIUS);
+	begin = bench_clock::now();
+
+	do {
+		instance.update(glm::vec3(0.f));
+		std::this_thread::yield();
+	} while(instance.pending());
+
+	end = bench_clock::now();
+
+	name << "terrain.pipeline[" << workers << "]";
+	report(name.str(), instance.generated(), end - begin);
+	std::cout << "    " << instance.to_string() << std::endl;
+
+	result = bench_terrain_checksum();
+	instance.uninitialize();
+	world.uninitialize();
+
+	return result;
+}
+
+void 
+bench_uid(void)
+{
+	size_t iter = 0;
+	std::vector<gaea::uid_t> id;
+	bench_clock::time_point begin, end;
+	gaea::engine::uid::manager &instance = gaea::engine::uid::manager::acquire();
+
+	instance.initialize();
+	id.resize(BENCH_UID_COUNT, UID_INVALID);
+	begin = bench_clock::now();
+
+	for(; iter < BENCH_UID_COUNT; ++iter) {
+		instance.generate(id[iter]);
+	}
+
+	end = bench_clock::now();
+	report("uid.generate", BENCH_UID_COUNT, end - begin);
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < BENCH_UID_COUNT; ++iter) {
+		instance.decrement_reference(id[iter]);
+	}
+
+	end = bench_clock::now();
+	report("uid.release", BENCH_UID_COUNT, end - begin);
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < BENCH_UID_COUNT; ++iter) {
+		instance.generate(id[iter]);
+		instance.decrement_reference(id[iter]);
+	}
+
+	end = bench_clock::now();
+	report("uid.recycle", BENCH_UID_COUNT, end - begin);
+	instance.uninitialize();
+}
+
+void 
+bench_world_random(void)
+{
+	size_t iter = 0;
+	uint64_t sink = 0;
+	bench_clock::time_point begin, end;
+	std::vector<glm::ivec3> position;
+	std::mt19937_64 generator(BENCH_RANDOM_SEED);
+	gaea::engine::world::manager &instance = gaea::engine::world::manager::acquire();
+
+	instance.initialize();
+
+	for(; iter < BENCH_RANDOM_COUNT; ++iter) {
+		position.push_back(glm::ivec3(generator() % (2 * BENCH_WORLD_RADIUS * CHUNK_WIDTH),
+			generator() % (2 * BENCH_WORLD_RADIUS * CHUNK_WIDTH),
+			generator() % (2 * BENCH_WORLD_RADIUS * CHUNK_WIDTH))
+			- glm::ivec3(BENCH_WORLD_RADIUS * CHUNK_WIDTH));
+	}
+
+	begin = bench_clock::now();
+
+	for(iter = 0; iter < position.size(); ++iter) {
+		instance.set_block(position[iter], (iter % 8) + 1);
+		sink += instance.block(position[(iter * 7) % position.size()]);
+	}
+
+	end = bench_clock::now();
+	bench_sink = bench_sink + sink;
+
+	report("world.random", 2 * position.size(), end - begin);
+	std::cout << "    " << instance.to_string() << std::endl;
+	instance.uninitialize();
+}
+
+int 
+main(
+	__in int argc,
+	__in char *argv[]
+	)
+{
+	int iter = 1, result = 0;
+	bool update = false;
+	std::string argument;
+	double threshold = BENCH_THRESHOLD_INIT;
+	std::map<std::string, bench_result_t> baseline;
+	std::string baseline_path = BENCH_BASELINE_PATH, output_path = BENCH_OUTPUT_PATH;
+
+	std::cout << STRING_CHECK(gaea::version(true)) << std::endl;
+
+	for(; iter < argc; ++iter) {
+		argument = argv[iter];
+
+		if(argument == "--update") {
+			update = true;
+		} else if((argument == "--baseline") && ((iter + 1) < argc)) {
+			baseline_path = argv[++iter];
+		} else if((argument == "--output") && ((iter + 1) < argc)) {
+			output_path = argv[++iter];
+		} else if((argument == "--threshold") && ((iter + 1) < argc)) {
+			threshold = std::strtod(argv[++iter], nullptr);
+		} else {
+			std::cerr << "Usage: " << argv[0] << " [--baseline PATH] [--output PATH] [--threshold RATIO] [--update]"
+				<< std::endl;
+			return SCALAR_INVALID(int);
+		}
+	}
+
+	try {
+
+		if(!bench_arena()) {
+			std::cerr << "arena.overflow: steady frames still fall back to the heap" << std::endl;
+			result = SCALAR_INVALID(int);
+		}
+
+		if(!bench_pool()) {
+			std::cerr << "pool.used: blocks leaked or chunks grew after reuse" << std::endl;
+			result = SCALAR_INVALID(int);
+		}
+
+		bench_uid();
+
+		if(!bench_event()) {
+			std::cerr << "event.latency: input over budget or channel messages not all received" << std::endl;
+			result = SCALAR_INVALID(int);
+		}
+
+		if(!bench_event_schedule()) {
+			std::cerr << "event.schedule: input not dispatched first or expired events not dropped" << std::endl;
+			result = SCALAR_INVALID(int);
+		}
+
+		if(!bench_signal()) {
+			std::cerr << "signal.wait: timed wait misbehaved or a waiter was left parked" << std::endl;
+			result = SCALAR_INVALID(int);
+		}
+
+		bench_entity_update();
+
+		if(!bench_matrix()) {
+			std::cerr << "matrix.error: camera-relative placement drifts far from the origin" << std::endl;
+			result = SCALAR_INVALID(int);
+		}
+
+		bench_png();
+		bench_chunk_linear(1);
+		bench_chunk_linear(16);
+		bench_chunk_linear(256);
+		bench_chunk_random(4);
+		bench_chunk_random(4096);
+		bench_world_random();
+		bench_mesh_generate(false);
+		bench_mesh_generate(true);
+		bench_mesh_lod(BENCH_LOD_RADIUS);
+		bench_mesh_lod(2 * BENCH_LOD_RADIUS);
+		bench_noise(false);
+		bench_noise(true);
+
+		if(!bench_occlusion()) {
+			std::cerr << "occlusion.visible: occluded box reported visible or visible box culled" << std::endl;
+			result = SCALAR_INVALID(int);
+		}
+
+		if(!bench_profile()) {
+			std::cerr << "profile.statistic: rolling window statistics are incorrect" << std::endl;
+			result = SCALAR_INVALID(int);
+		}
+
+		bench_ray();
+		bench_terrain_generate();
+
+		if(!bench_region()) {
+			std::cerr << "region.load: loaded chunks differ from saved chunks" << std::endl;
+			result = SCALAR_INVALID(int);
+		}
+
+		if(bench_terrain_pipeline(1) != bench_terrain_pipeline(BENCH_TERRAIN_WORKERS)) {
+			std::cerr << "terrain.pipeline: output differs across worker counts" << std::endl;
+			result = SCALAR_INVALID(int);
+		}
+
+		bench_stream_walk();
+	} catch(gaea::exception &exc) {
+		std::cerr << exc.to_string(true) << std::endl;
+		result = SCALAR_INVALID(int);
+	}
+
+	if(!baseline_write(update ? baseline_path : output_path)) {
+		std::cerr << "baseline.write: failed to write " << (update ? baseline_path : output_path) << std::endl;
+		result = SCALAR_INVALID(int);
+	} else if(update) {
+		std::cout << "BASELINE: updated " << baseline_path << std::endl;
+	} else if(!baseline_read(baseline_path, baseline)) {
+		// a missing baseline must not pass as a clean comparison
+		std::cerr << "BASELINE: " << baseline_path << " not found (run with --update to create)" << std::endl;
+		result = SCALAR_INVALID(int);
+	} else if(!baseline_compare(baseline, threshold)) {
+		result = SCALAR_INVALID(int);
+	}
+
+	return result;
+}
@@ -0,0 +1,229 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_ACTION_H_
+#define GAEA_ACTION_H_
+
+namespace gaea {
+
+	#define ACTION_BIT(_TYPE_) (1U << (_TYPE_))
+	#define ACTION_COUNT (ACTION_MAX + 1)
+	#define ACTION_DEAD_ZONE_INIT 0.2f
+	#define ACTION_LOOK_SCALE_INIT 8.f
+	#define ACTION_MAX ACTION_DESCEND
+	#define ACTION_PATH_INIT "./res/input.cfg"
+	#define AXIS_COUNT (AXIS_MAX + 1)
+	#define AXIS_MAX AXIS_MOVE_Y
+
+	// the first four actions mirror key_t
+	typedef enum {
+		ACTION_BACKWARD = 0,
+		ACTION_FORWARD,
+		ACTION_LEFT,
+		ACTION_RIGHT,
+		ACTION_ASCEND,
+		ACTION_DESCEND,
+	} action_t;
+
+	typedef enum {
+		AXIS_LOOK_X = 0,
+		AXIS_LOOK_Y,
+		AXIS_MOVE_X,
+		AXIS_MOVE_Y,
+	} axis_t;
+
+	namespace engine {
+
+		namespace action {
+
+			typedef struct {
+				GLfloat axis[AXIS_COUNT];
+				uint32_t down;
+				uint32_t frame;
+				uint32_t pressed;
+				uint32_t released;
+			} state_t;
+
+			/*
+			 * Resolves raw keyboard, mouse and game controller input into a fixed set
+			 * of actions and axes. Input is fed from the main loop into the same
+			 * lock-free live masks the observers use, and update folds a snapshot of
+			 * them into one state per frame, which consumers poll from any thread.
+			 *
+			 * Bindings start from the key map passed to initialize and may be
+			 * replaced per action or axis by a configuration file, one binding per
+			 * line:
+			 *
+			 *   action FORWARD key W
+			 *   action DESCEND key Left_Shift
+			 *   action ASCEND button a
+			 *   axis MOVE_Y key S W [scale]
+			 *   axis LOOK_X controller rightx [scale]
+			 *   axis LOOK_Y mouse y [scale]
+			 *   dead_zone 0.2
+			 *   speed 10
+			 *   sensitivity 15
+			 *
+			 * Key names are SDL scancode names, with underscores standing for spaces.
+			 * Speed and sensitivity must be positive, and a line that sets either to
+			 * zero, a negative or a non-finite value is rejected as malformed.
+			 */
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					void attach(
+						__in int32_t index
+						);
+
+					GLfloat dead_zone(void);
+
+					void detach(
+						__in SDL_JoystickID id
+						);
+
+					void initialize(
+						__in_opt const std::map<gaea::key_t, SDL_Scancode> &key_map = INPUT_KEY_MAP_INIT,
+						__in_opt GLfloat speed = INPUT_SPEED_INIT,
+						__in_opt GLfloat sensitivity = INPUT_SENSITIVITY_INIT
+						);
+
+					void input(
+						__in uint32_t specifier,
+						__in const void *context,
+						__in size_t length
+						);
+
+					static bool is_allocated(void);
+
+					bool is_initialized(void);
+
+					bool load(
+						__in const std::string &path,
+						__in_opt bool optional = false
+						);
+
+					GLfloat sensitivity(void);
+
+					size_t size(void);
+
+					GLfloat speed(void);
+
+					gaea::engine::action::state_t state(void);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void uninitialize(void);
+
+					void update(void);
+
+				protected:
+
+					typedef enum {
+						SOURCE_BUTTON = 0,
+						SOURCE_CONTROLLER_AXIS,
+						SOURCE_CONTROLLER_BUTTON,
+						SOURCE_KEY,
+						SOURCE_KEY_PAIR,
+						SOURCE_MOTION_X,
+						SOURCE_MOTION_Y,
+						SOURCE_WHEEL,
+					} source_t;
+
+					typedef struct {
+						uint32_t code;
+						uint32_t negative;
+						GLfloat scale;
+						source_t source;
+					} binding_t;
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					bool bind(
+						__in const std::string &line,
+						__inout std::vector<std::vector<binding_t>> &action,
+						__inout std::vector<std::vector<binding_t>> &axis
+						);
+
+					void clear(void);
+
+					bool is_down(
+						__in const binding_t &binding
+						);
+
+					bool is_pressed(
+						__in const binding_t &binding
+						);
+
+					GLfloat value(
+						__in const binding_t &binding
+						);
+
+					std::vector<std::vector<binding_t>> m_action;
+
+					std::vector<std::vector<binding_t>> m_axis;
+
+					std::map<SDL_JoystickID, SDL_GameController *> m_controller;
+
+					gaea::engine::observer::state_t m_current;
+
+					GLfloat m_dead_zone;
+
+					bool m_initialized;
+
+					static _manager *m_instance;
+
+					gaea::engine::observer::live m_live;
+
+					std::mutex m_lock;
+
+					glm::vec2 m_motion;
+
+					gaea::engine::observer::state_t m_pressed;
+
+					GLfloat m_sensitivity;
+
+					GLfloat m_speed;
+
+					gaea::engine::action::state_t m_state;
+
+					GLfloat m_wheel;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_ACTION_H_
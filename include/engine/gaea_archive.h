@@ -0,0 +1,267 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_ARCHIVE_H_
+#define GAEA_ARCHIVE_H_
+
+namespace gaea {
+
+	#define ARCHIVE_ALIGNMENT 4096
+	#define ARCHIVE_COMPRESSION_INIT ARCHIVE_COMPRESSION_LZ4
+	#define ARCHIVE_COMPRESSION_MAX ARCHIVE_COMPRESSION_ZSTD
+	#define ARCHIVE_PATH_INIT "./res/gaea.gpk"
+
+	typedef enum {
+		ARCHIVE_COMPRESSION_NONE = 0,
+		ARCHIVE_COMPRESSION_LZ4,
+		ARCHIVE_COMPRESSION_ZSTD,
+	} compression_t;
+
+	namespace engine {
+
+		namespace archive {
+
+			void compress(
+				__in gaea::compression_t type,
+				__in const uint8_t *data,
+				__in size_t length,
+				__out std::vector<uint8_t> &output
+				);
+
+			void decompress(
+				__in gaea::compression_t type,
+				__in const uint8_t *data,
+				__in size_t length,
+				__out std::vector<uint8_t> &output,
+				__in size_t output_length
+				);
+
+			uint64_t hash(
+				__in const std::string &name
+				);
+
+			bool load(
+				__in const std::string &name,
+				__out std::vector<uint8_t> &data
+				);
+
+			bool map(
+				__in const std::string &name,
+				__out std::shared_ptr<const uint8_t> &data,
+				__out size_t &length
+				);
+
+			typedef class _base {
+
+				public:
+
+					_base(
+						__in const std::string &path
+						);
+
+					virtual ~_base(void);
+
+					static std::string as_string(
+						__in const _base &object,
+						__in_opt bool verbose = false
+						);
+
+					bool contains(
+						__in const std::string &name
+						);
+
+					bool map(
+						__in const std::string &name,
+						__out const uint8_t *&data,
+						__out size_t &length
+						);
+
+					const std::string &path(void);
+
+					void read(
+						__in const std::string &name,
+						__out std::vector<uint8_t> &data
+						);
+
+					size_t size(void);
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+				protected:
+
+					_base(
+						__in const _base &other
+						);
+
+					_base &operator=(
+						__in const _base &other
+						);
+
+					void close(void);
+
+					const void *find(
+						__in const std::string &name
+						);
+
+					void open(void);
+
+					size_t m_count;
+
+					const uint8_t *m_data;
+
+					int m_file;
+
+					size_t m_length;
+
+					std::string m_path;
+
+			} base;
+
+			typedef class _builder {
+
+				public:
+
+					_builder(void);
+
+					_builder(
+						__in const _builder &other
+						);
+
+					virtual ~_builder(void);
+
+					_builder &operator=(
+						__in const _builder &other
+						);
+
+					void add(
+						__in const std::string &name,
+						__in const std::vector<uint8_t> &data,
+						__in_opt gaea::compression_t compression = ARCHIVE_COMPRESSION_INIT
+						);
+
+					void add_file(
+						__in const std::string &path,
+						__in_opt gaea::compression_t compression = ARCHIVE_COMPRESSION_INIT
+						);
+
+					static std::string as_string(
+						__in const _builder &object,
+						__in_opt bool verbose = false
+						);
+
+					void clear(void);
+
+					size_t size(void);
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void write(
+						__in const std::string &path
+						);
+
+				protected:
+
+					std::map<std::string, std::pair<std::vector<uint8_t>, gaea::compression_t>> m_entry;
+
+			} builder;
+
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					void initialize(void);
+
+					static bool is_allocated(void);
+
+					bool is_initialized(void);
+
+					bool is_mounted(
+						__in const std::string &path
+						);
+
+					bool load(
+						__in const std::string &name,
+						__out std::vector<uint8_t> &data
+						);
+
+					bool map(
+						__in const std::string &name,
+						__out std::shared_ptr<const uint8_t> &data,
+						__out size_t &length
+						);
+
+					bool mount(
+						__in const std::string &path,
+						__in_opt bool optional = false
+						);
+
+					size_t size(void);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void uninitialize(void);
+
+					void unmount(
+						__in const std::string &path
+						);
+
+				protected:
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					void clear(void);
+
+					std::vector<std::shared_ptr<gaea::engine::archive::base>>::iterator find(
+						__in const std::string &path
+						);
+
+					std::vector<std::shared_ptr<gaea::engine::archive::base>> m_entry;
+
+					bool m_initialized;
+
+					static _manager *m_instance;
+
+					std::mutex m_lock;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_ARCHIVE_H_
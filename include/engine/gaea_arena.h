@@ -0,0 +1,190 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_ARENA_H_
+#define GAEA_ARENA_H_
+
+namespace gaea {
+
+	#define ARENA_ALIGNMENT_INIT 16
+	#define ARENA_CAPACITY_INIT (256 * BYTES_PER_KBYTE)
+	#define ARENA_CAPACITY_MAX (64 * BYTES_PER_KBYTE * BYTES_PER_KBYTE)
+
+	namespace engine {
+
+		namespace arena {
+
+			typedef struct {
+				size_t allocated;
+				size_t capacity;
+				size_t count;
+				size_t high_water;
+				size_t overflow;
+			} statistic_t;
+
+			void *allocate(
+				__in size_t length,
+				__in_opt size_t alignment = ARENA_ALIGNMENT_INIT
+				);
+
+			void deallocate(
+				__in void *data
+				);
+
+			/*
+			 * STL adapter over the frame arena. Containers using it must not outlive
+			 * the frame they were filled in.
+			 */
+			template <class T> class allocator {
+
+				public:
+
+					typedef T value_type;
+
+					allocator(void)
+					{
+						return;
+					}
+
+					template <class U> allocator(
+						__in const allocator<U> &other
+						)
+					{
+						return;
+					}
+
+					T *allocate(
+						__in size_t count
+						)
+					{
+						return (T *) gaea::engine::arena::allocate(count * sizeof(T), alignof(T));
+					}
+
+					void deallocate(
+						__in T *data,
+						__in size_t count
+						)
+					{
+						gaea::engine::arena::deallocate(data);
+					}
+			};
+
+			template <class T, class U> bool operator==(
+				__in const gaea::engine::arena::allocator<T> &left,
+				__in const gaea::engine::arena::allocator<U> &right
+				)
+			{
+				return true;
+			}
+
+			template <class T, class U> bool operator!=(
+				__in const gaea::engine::arena::allocator<T> &left,
+				__in const gaea::engine::arena::allocator<U> &right
+				)
+			{
+				return false;
+			}
+
+			template <class T> using vector = std::vector<T, gaea::engine::arena::allocator<T>>;
+
+			/*
+			 * Linear allocator for data that lives at most one frame. An allocation
+			 * bumps an offset into a single block, and reset rewinds it once per
+			 * frame. Requests that do not fit, or that come from a thread other than
+			 * the one that initialized the arena, fall back to the heap. Reset then
+			 * grows the block to the high-water mark, so a steady frame stops
+			 * touching the heap after the first few frames.
+			 */
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					void *allocate(
+						__in size_t length,
+						__in_opt size_t alignment = ARENA_ALIGNMENT_INIT
+						);
+
+					void deallocate(
+						__in void *data
+						);
+
+					void initialize(
+						__in_opt size_t capacity = ARENA_CAPACITY_INIT
+						);
+
+					static bool is_allocated(void);
+
+					bool is_initialized(void);
+
+					void reset(void);
+
+					gaea::engine::arena::statistic_t statistic(void);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void uninitialize(void);
+
+				protected:
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					void clear(void);
+
+					uint8_t *m_block;
+
+					size_t m_capacity;
+
+					size_t m_count;
+
+					size_t m_high_water;
+
+					bool m_initialized;
+
+					static _manager *m_instance;
+
+					size_t m_offset;
+
+					size_t m_overflow;
+
+					size_t m_overflow_length;
+
+					std::thread::id m_owner;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_ARENA_H_
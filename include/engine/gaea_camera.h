@@ -26,8 +26,9 @@ namespace gaea {
 
 		namespace camera {
 
-			#define CAMERA_CLIP_INIT glm::vec2(CAMERA_CLIP_MIN, CAMERA_CLIP_MAX)
-			#define CAMERA_CLIP_MAX 1000.f
+			#define CAMERA_CLIP_FAR_INIT 1000.f
+			#define CAMERA_CLIP_INIT glm::vec2(CAMERA_CLIP_MIN, CAMERA_CLIP_FAR_INIT)
+			#define CAMERA_CLIP_MAX 8192.f
 			#define CAMERA_CLIP_MIN 0.1f
 			#define CAMERA_FOV_INIT 45.f
 			#define CAMERA_FOV_MAX 90.f
@@ -39,6 +40,36 @@ namespace gaea {
 			#define CAMERA_YAW_MAX 360.f
 			#define CAMERA_YAW_MIN 0.f
 
+			typedef gaea::engine::event::message<EVENT_CAMERA_CLIP_SET, glm::vec2> clip_set_t;
+
+			typedef gaea::engine::event::message<EVENT_CAMERA_DIMENSIONS_SET, glm::ivec2> dimensions_set_t;
+
+			typedef gaea::engine::event::message<EVENT_CAMERA_FOV_DELTA, GLfloat> fov_delta_t;
+
+			typedef gaea::engine::event::message<EVENT_CAMERA_FOV_SET, GLfloat> fov_set_t;
+
+			typedef gaea::engine::event::message<EVENT_CAMERA_POSITION_DELTA, glm::vec3> position_delta_t;
+
+			typedef gaea::engine::event::message<EVENT_CAMERA_POSITION_SET, glm::dvec3> position_set_t;
+
+			typedef gaea::engine::event::message<EVENT_CAMERA_ROTATION_DELTA, glm::vec3> rotation_delta_t;
+
+			typedef gaea::engine::event::message<EVENT_CAMERA_ROTATION_SET, glm::vec3> rotation_set_t;
+
+			typedef gaea::engine::event::message<EVENT_CAMERA_UP_DELTA, glm::vec3> up_delta_t;
+
+			typedef gaea::engine::event::message<EVENT_CAMERA_UP_SET, glm::vec3> up_set_t;
+
+			/*
+			 * The view matrix is built with the camera at the origin. Entities are
+			 * rendered relative to the camera position, so only the rotation of
+			 * the camera ever reaches a float matrix.
+			 *
+			 * Messages arrive on the event thread and on whichever thread publishes
+			 * them, while the simulation applies and captures the camera state. That
+			 * state is guarded by a lock. Rendering reads only the presented frame
+			 * (origin and view), which belongs to the render thread.
+			 */
 			typedef class _base :
 					public gaea::engine::entity::base_position,
 					public gaea::engine::observer::base {
@@ -47,7 +78,7 @@ namespace gaea {
 
 					_base(
 						__in const glm::ivec2 &dimensions,
-						__in_opt const glm::vec3 &position = CAMERA_POSITION_INIT,
+						__in_opt const glm::dvec3 &position = CAMERA_POSITION_INIT,
 						__in_opt const glm::vec3 &rotation = CAMERA_ROTATION_INIT,
 						__in_opt const glm::vec3 &up = CAMERA_UP_INIT,
 						__in_opt const glm::vec2 &clip = CAMERA_CLIP_INIT,
@@ -69,10 +100,65 @@ namespace gaea {
 						__in_opt bool verbose = false
 						);
 
-					const glm::mat4 &projection(void);
+					virtual bool capture(
+						__out gaea::engine::entity::transform_t &previous,
+						__out gaea::engine::entity::transform_t &current
+						);
+
+					glm::ivec2 dimensions(void);
+
+					glm::dvec3 origin(void);
+
+					virtual void present(
+						__in const gaea::engine::entity::transform_t &previous,
+						__in const gaea::engine::entity::transform_t &current,
+						__in GLfloat alpha
+						);
+
+					glm::mat4 projection(void);
+
+					void receive(
+						__in const gaea::engine::camera::clip_set_t &message
+						);
+
+					void receive(
+						__in const gaea::engine::camera::dimensions_set_t &message
+						);
+
+					void receive(
+						__in const gaea::engine::camera::fov_delta_t &message
+						);
+
+					void receive(
+						__in const gaea::engine::camera::fov_set_t &message
+						);
+
+					void receive(
+						__in const gaea::engine::camera::position_delta_t &message
+						);
+
+					void receive(
+						__in const gaea::engine::camera::position_set_t &message
+						);
+
+					void receive(
+						__in const gaea::engine::camera::rotation_delta_t &message
+						);
+
+					void receive(
+						__in const gaea::engine::camera::rotation_set_t &message
+						);
+
+					void receive(
+						__in const gaea::engine::camera::up_delta_t &message
+						);
+
+					void receive(
+						__in const gaea::engine::camera::up_set_t &message
+						);
 
 					virtual void render(
-						__in const glm::vec3 &position,
+						__in const glm::dvec3 &position,
 						__in const glm::vec3 &rotation,
 						__in const glm::vec3 &up,
 						__in const glm::mat4 &projection,
@@ -91,6 +177,8 @@ namespace gaea {
 						__in GLfloat fov
 						);
 
+					virtual void snapshot(void);
+
 					virtual std::string to_string(
 						__in_opt bool verbose = false
 						);
@@ -128,6 +216,8 @@ namespace gaea {
 				
 					GLfloat m_fov_delta;
 
+					std::recursive_mutex m_lock;
+
 					glm::vec3 m_position_delta;
 
 					glm::mat4 m_projection;
@@ -151,7 +241,7 @@ namespace gaea {
 
 					void initialize(
 						__in const glm::ivec2 &dimensions,
-						__in_opt const glm::vec3 &position = CAMERA_POSITION_INIT,
+						__in_opt const glm::dvec3 &position = CAMERA_POSITION_INIT,
 						__in_opt const glm::vec3 &rotation = CAMERA_ROTATION_INIT,
 						__in_opt const glm::vec3 &up = CAMERA_UP_INIT,
 						__in_opt const glm::vec2 &clip = CAMERA_CLIP_INIT,
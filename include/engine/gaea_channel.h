@@ -0,0 +1,257 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_CHANNEL_H_
+#define GAEA_CHANNEL_H_
+
+namespace gaea {
+
+	#define CHANNEL_SLOT_COUNT 3
+
+	namespace engine {
+
+		namespace event {
+
+			/*
+			 * Typed payload. The specifier is part of the type, so messages that share
+			 * a value type (for example position and rotation deltas) still travel on
+			 * separate channels.
+			 */
+			template <uint32_t S, class T> struct message {
+				static const uint32_t specifier = S;
+				T value;
+			};
+
+			/*
+			 * Type-erased core of a channel. Receivers are kept as an immutable list
+			 * that is republished on every change, the same way the event manager
+			 * keeps its handlers, so a receiver may subscribe or unsubscribe from
+			 * inside a callback.
+			 *
+			 * Publishers count themselves in under the slot of the current epoch,
+			 * retrying if the epoch moved while they did. Unsubscribe waits for the
+			 * slots of older epochs to drain, advances the epoch and then waits for
+			 * the slot of the epoch it closed, so once it returns the receiver is
+			 * never called again and may be destroyed. Overlapping unsubscribes each
+			 * wait for what they could have missed without serializing, so one
+			 * issued from inside a callback never waits on a drain that is waiting
+			 * on that callback. Publishers further up the calling thread's own stack
+			 * are not waited for; they finish walking their list after the callback
+			 * returns. Two threads that each unsubscribe from inside their own
+			 * publish wait on each other.
+			 */
+			typedef class _base_channel {
+
+				public:
+
+					typedef void (*receive_cb)(
+						__in const void *payload,
+						__in void *context
+						);
+
+					typedef std::vector<std::pair<receive_cb, void *>> receiver_list_t;
+
+					virtual ~_base_channel(void);
+
+					static std::string as_string(
+						__in const _base_channel &object,
+						__in_opt bool verbose = false
+						);
+
+					size_t size(void) const;
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+				protected:
+
+					_base_channel(void);
+
+					_base_channel(
+						__in const _base_channel &other
+						);
+
+					_base_channel &operator=(
+						__in const _base_channel &other
+						);
+
+					bool contains(
+						__in receive_cb receive,
+						__in void *context
+						) const;
+
+					void publish(
+						__in const void *payload
+						) const;
+
+					void subscribe(
+						__in receive_cb receive,
+						__in void *context
+						);
+
+					void unsubscribe(
+						__in receive_cb receive,
+						__in void *context
+						);
+
+					std::atomic<uint64_t> m_epoch;
+
+					std::mutex m_lock;
+
+					mutable std::atomic<size_t> m_reader[CHANNEL_SLOT_COUNT];
+
+					std::shared_ptr<const receiver_list_t> m_receiver;
+
+			} base_channel;
+
+			/*
+			 * One channel per payload type. Receivers are objects with a matching
+			 * receive(const T &) overload, bound through a trampoline instantiated
+			 * for that type, so a missing or mismatched handler fails to compile
+			 * and dispatch needs no specifier switch, length check or copy. Unlike
+			 * notify, publish runs the receivers on the calling thread.
+			 */
+			template <class T> class channel :
+					public gaea::engine::event::base_channel {
+
+				public:
+
+					~channel(void)
+					{
+						return;
+					}
+
+					static channel &acquire(void)
+					{
+						std::call_once(m_once, channel::_create);
+
+						return *m_instance;
+					}
+
+					template <class O> bool contains(
+						__in O *object
+						) const
+					{
+						return gaea::engine::event::base_channel::contains(&channel::receive<O>, object);
+					}
+
+					static bool is_allocated(void)
+					{
+						return (m_instance != nullptr);
+					}
+
+					void publish(
+						__in const T &payload
+						) const
+					{
+						gaea::engine::event::base_channel::publish(&payload);
+					}
+
+					template <class O> void subscribe(
+						__in O *object
+						)
+					{
+						gaea::engine::event::base_channel::subscribe(&channel::receive<O>, object);
+					}
+
+					template <class O> void unsubscribe(
+						__in O *object
+						)
+					{
+						gaea::engine::event::base_channel::unsubscribe(&channel::receive<O>, object);
+					}
+
+				protected:
+
+					channel(void)
+					{
+						return;
+					}
+
+					channel(
+						__in const channel &other
+						);
+
+					channel &operator=(
+						__in const channel &other
+						);
+
+					static void _create(void)
+					{
+						m_instance = new channel;
+						std::atexit(channel::_delete);
+					}
+
+					static void _delete(void)
+					{
+
+						if(m_instance) {
+							delete m_instance;
+							m_instance = nullptr;
+						}
+					}
+
+					template <class O> static void receive(
+						__in const void *payload,
+						__in void *context
+						)
+					{
+						((O *) context)->receive(*(const T *) payload);
+					}
+
+					static std::atomic<channel *> m_instance;
+
+					static std::once_flag m_once;
+			};
+
+			template <class T> std::atomic<channel<T> *> channel<T>::m_instance(nullptr);
+
+			template <class T> std::once_flag channel<T>::m_once;
+
+			template <class T> void publish(
+				__in const T &payload
+				)
+			{
+				gaea::engine::event::channel<T>::acquire().publish(payload);
+			}
+
+			template <class... T, class O> void subscribe(
+				__in O *object
+				)
+			{
+				int expand[] = { 0, (gaea::engine::event::channel<T>::acquire().subscribe(object), 0)... };
+
+				(void) expand;
+			}
+
+			template <class... T, class O> void unsubscribe(
+				__in O *object
+				)
+			{
+				int expand[] = { 0, (gaea::engine::event::channel<T>::is_allocated() 
+					? gaea::engine::event::channel<T>::acquire().unsubscribe(object) : (void) 0, 0)... };
+
+				(void) expand;
+			}
+		}
+	}
+}
+
+#endif // GAEA_CHANNEL_H_
@@ -0,0 +1,182 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_CHUNK_H_
+#define GAEA_CHUNK_H_
+
+namespace gaea {
+
+	#define BLOCK_AIR 0
+	#define BLOCK_INVALID SCALAR_INVALID(gaea::block_t)
+
+	#define CHUNK_AREA (CHUNK_WIDTH * CHUNK_WIDTH)
+	#define CHUNK_VOLUME (CHUNK_AREA * CHUNK_WIDTH)
+	#define CHUNK_WIDTH (1 << CHUNK_WIDTH_SHIFT)
+	#define CHUNK_WIDTH_SHIFT 4
+
+	typedef uint16_t block_t;
+
+	namespace engine {
+
+		namespace chunk {
+
+			glm::ivec3 coordinate(
+				__in const glm::ivec3 &position
+				);
+
+			glm::uvec3 local(
+				__in const glm::ivec3 &position
+				);
+
+			typedef struct {
+
+				size_t operator()(
+					__in const glm::ivec3 &coordinate
+					) const;
+
+			} hash_t;
+
+			typedef class _base {
+
+				public:
+
+					_base(
+						__in_opt gaea::block_t block = BLOCK_AIR
+						);
+
+					_base(
+						__in const _base &other
+						);
+
+					virtual ~_base(void);
+
+					_base &operator=(
+						__in const _base &other
+						);
+
+					static std::string as_string(
+						__in const _base &object,
+						__in_opt bool verbose = false
+						);
+
+					size_t bits(void) const;
+
+					void clear(
+						__in_opt gaea::block_t block = BLOCK_AIR
+						);
+
+					void compact(void);
+
+					size_t count(
+						__in gaea::block_t block
+						) const;
+
+					void deserialize(
+						__in const std::vector<gaea::block_t> &data
+						);
+
+					gaea::block_t get(
+						__in uint32_t x,
+						__in uint32_t y,
+						__in uint32_t z
+						) const;
+
+					gaea::block_t get(
+						__in const glm::uvec3 &position
+						) const;
+
+					bool is_dirty(void) const;
+
+					bool is_empty(void) const;
+
+					size_t memory(void) const;
+
+					size_t palette_size(void) const;
+
+					void serialize(
+						__out std::vector<gaea::block_t> &data
+						) const;
+
+					void set(
+						__in uint32_t x,
+						__in uint32_t y,
+						__in uint32_t z,
+						__in gaea::block_t block
+						);
+
+					void set(
+						__in const glm::uvec3 &position,
+						__in gaea::block_t block
+						);
+
+					void set_dirty(
+						__in_opt bool dirty = true
+						);
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+				protected:
+
+					uint32_t acquire_palette(
+						__in gaea::block_t block
+						);
+
+					static size_t index(
+						__in uint32_t x,
+						__in uint32_t y,
+						__in uint32_t z
+						);
+
+					uint32_t read(
+						__in size_t index
+						) const;
+
+					void release_palette(
+						__in uint32_t entry
+						);
+
+					void resize(
+						__in uint8_t bits
+						);
+
+					void write(
+						__in size_t index,
+						__in uint32_t entry
+						);
+
+					uint8_t m_bits;
+
+					std::vector<uint64_t> m_data;
+
+					bool m_dirty;
+
+					std::vector<uint32_t> m_free;
+
+					std::vector<std::pair<gaea::block_t, uint32_t>> m_palette;
+
+					std::unordered_map<gaea::block_t, uint32_t> m_palette_index;
+
+			} base;
+		}
+	}
+}
+
+#endif // GAEA_CHUNK_H_
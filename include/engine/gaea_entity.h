@@ -23,8 +23,9 @@
 namespace gaea {
 
 	#define ENTITY_ALL SCALAR_INVALID(gaea::entity_t)
-	#define ENTITY_MAX ENTITY_MODEL
-	#define ENTITY_POSITION_INIT glm::vec3()
+	#define ENTITY_ALPHA_INIT 1.f
+	#define ENTITY_MAX ENTITY_CHUNK
+	#define ENTITY_POSITION_INIT glm::dvec3()
 	#define ENTITY_ROTATION_INIT glm::vec3(0.f, 0.f, glm::pi<GLfloat>())
 	#define ENTITY_SPECIFIER_UNDEFINED SCALAR_INVALID(uint32_t)
 	#define ENTITY_UP_INIT glm::vec3(0.f, DIRECTION_UP, 0.f)
@@ -36,12 +37,38 @@ namespace gaea {
 	typedef enum {
 		ENTITY_CAMERA = 0,
 		ENTITY_MODEL,
+		ENTITY_CHUNK,
 	} entity_t;
 
 	namespace engine {
 
 		namespace entity {
 
+			/*
+			 * World positions are kept in double precision so that entities far
+			 * from the origin do not jitter. Rendering subtracts the camera origin
+			 * in double before narrowing to float, so model and view matrices only
+			 * ever hold camera-relative offsets.
+			 */
+			typedef struct {
+				glm::dvec3 position;
+				glm::vec3 rotation;
+				glm::vec3 up;
+			} transform_t;
+
+			typedef struct {
+				gaea::engine::entity::transform_t current;
+				gaea::uid_t id;
+				gaea::engine::entity::transform_t previous;
+				gaea::entity_t type;
+			} snapshot_t;
+
+			gaea::engine::entity::transform_t interpolate(
+				__in const gaea::engine::entity::transform_t &previous,
+				__in const gaea::engine::entity::transform_t &current,
+				__in GLfloat alpha
+				);
+
 			typedef class _base :
 					public gaea::engine::object::base {
 
@@ -68,16 +95,42 @@ namespace gaea {
 						__in_opt bool verbose = false
 						);
 
+					virtual bool bounds(
+						__in const glm::dvec3 &position,
+						__out gaea::engine::occlusion::box_t &box
+						);
+
+					virtual bool capture(
+						__out gaea::engine::entity::transform_t &previous,
+						__out gaea::engine::entity::transform_t &current
+						);
+
+					virtual bool is_occluded(void);
+
 					bool is_visible(void);
 
+					virtual void present(
+						__in const gaea::engine::entity::transform_t &previous,
+						__in const gaea::engine::entity::transform_t &current,
+						__in GLfloat alpha
+						);
+
+					virtual void query(
+						__in const glm::dvec3 &position,
+						__in const glm::mat4 &projection,
+						__in const glm::mat4 &view
+						);
+
 					virtual void render(
-						__in const glm::vec3 &position,
+						__in const glm::dvec3 &position,
 						__in const glm::vec3 &rotation,
 						__in const glm::vec3 &up,
 						__in const glm::mat4 &projection,
 						__in const glm::mat4 &view
 						) = 0;
 
+					virtual void snapshot(void);
+
 					uint32_t specifier(void);
 
 					virtual std::string to_string(
@@ -108,6 +161,12 @@ namespace gaea {
 
 			} base;
 
+			/*
+			 * Positioned entities keep their state from before the last update.
+			 * The simulation captures both states into a frame snapshot. Rendering
+			 * presents the snapshot and draws the blend of the two, so it never
+			 * reads the fields the simulation is writing.
+			 */
 			typedef class _base_position :
 					public gaea::engine::entity::base {
 
@@ -116,7 +175,7 @@ namespace gaea {
 					_base_position(
 						__in gaea::entity_t type,
 						__in_opt uint32_t specifier = ENTITY_SPECIFIER_UNDEFINED,
-						__in_opt const glm::vec3 &position = ENTITY_POSITION_INIT,
+						__in_opt const glm::dvec3 &position = ENTITY_POSITION_INIT,
 						__in_opt const glm::vec3 &rotation = ENTITY_ROTATION_INIT,
 						__in_opt const glm::vec3 &up = ENTITY_UP_INIT,
 						__in_opt bool visible = ENTITY_VISIBLE_INIT
@@ -137,10 +196,21 @@ namespace gaea {
 						__in_opt bool verbose = false
 						);
 
-					glm::vec3 &position(void);
+					virtual bool capture(
+						__out gaea::engine::entity::transform_t &previous,
+						__out gaea::engine::entity::transform_t &current
+						);
+
+					glm::dvec3 &position(void);
+
+					virtual void present(
+						__in const gaea::engine::entity::transform_t &previous,
+						__in const gaea::engine::entity::transform_t &current,
+						__in GLfloat alpha
+						);
 
 					virtual void render(
-						__in const glm::vec3 &position,
+						__in const glm::dvec3 &position,
 						__in const glm::vec3 &rotation,
 						__in const glm::vec3 &up,
 						__in const glm::mat4 &projection,
@@ -149,6 +219,8 @@ namespace gaea {
 
 					glm::vec3 &rotation(void);
 
+					virtual void snapshot(void);
+
 					virtual std::string to_string(
 						__in_opt bool verbose = false
 						);
@@ -161,7 +233,17 @@ namespace gaea {
 
 				protected:
 
-					glm::vec3 m_position;
+					gaea::engine::entity::transform_t interpolated(void);
+
+					GLfloat m_alpha;
+
+					gaea::engine::entity::transform_t m_frame_current;
+
+					gaea::engine::entity::transform_t m_frame_previous;
+
+					glm::dvec3 m_position;
+
+					gaea::engine::entity::transform_t m_previous;
 
 					glm::vec3 m_rotation;
 
@@ -177,7 +259,7 @@ namespace gaea {
 					_base_model(
 						__in gaea::entity_t type,
 						__in_opt uint32_t specifier = ENTITY_SPECIFIER_UNDEFINED,
-						__in_opt const glm::vec3 &position = ENTITY_POSITION_INIT,
+						__in_opt const glm::dvec3 &position = ENTITY_POSITION_INIT,
 						__in_opt const glm::vec3 &rotation = ENTITY_ROTATION_INIT,
 						__in_opt const glm::vec3 &up = ENTITY_UP_INIT,
 						__in_opt GLuint model_id = GL_HANDLE_INVALID,
@@ -208,7 +290,7 @@ namespace gaea {
 					GLint &projection_id(void);
 
 					virtual void render(
-						__in const glm::vec3 &position,
+						__in const glm::dvec3 &position,
 						__in const glm::vec3 &rotation,
 						__in const glm::vec3 &up,
 						__in const glm::mat4 &projection,
@@ -223,7 +305,9 @@ namespace gaea {
 						__in GLfloat delta
 						) = 0;
 
-					void update_model(void);
+					void update_model(
+						__in_opt const glm::dvec3 &position = ENTITY_POSITION_INIT
+						);
 
 					GLint &view_id(void);
 
@@ -239,6 +323,15 @@ namespace gaea {
 
 			} base_model;
 
+			/*
+			 * Chunk entities are created and drawn on the render thread. Update and
+			 * capture skip them, so a pipelined simulation never walks that map.
+			 *
+			 * Entities with bounds are first tested against the software occlusion
+			 * buffer. Occludable entities are then queried against their bounds in
+			 * a depth-only pass after each frame is drawn. The result is read back
+			 * on a later frame, once available, so the CPU never waits on the GPU.
+			 */
 			typedef class _manager {
 
 				public:
@@ -247,6 +340,10 @@ namespace gaea {
 
 					static _manager &acquire(void);
 
+					void capture(
+						__out std::vector<gaea::engine::entity::snapshot_t> &snapshot
+						);
+
 					bool contains(
 						__in gaea::uid_t id,
 						__in gaea::entity_t type
@@ -257,6 +354,8 @@ namespace gaea {
 						__in gaea::entity_t type
 						);
 
+					size_t drawn(void);
+
 					void generate(
 						__in gaea::engine::entity::base &object
 						);
@@ -272,13 +371,20 @@ namespace gaea {
 
 					bool is_initialized(void);
 
+					size_t occluded(void);
+
+					void present(
+						__in const std::vector<gaea::engine::entity::snapshot_t> &snapshot,
+						__in GLfloat alpha
+						);
+
 					size_t reference_count(
 						__in gaea::uid_t id,
 						__in gaea::entity_t type
 						);
 
 					void render(
-						__in const glm::vec3 &position,
+						__in const glm::dvec3 &position,
 						__in const glm::vec3 &rotation,
 						__in const glm::vec3 &up,
 						__in const glm::mat4 &projection,
@@ -317,17 +423,21 @@ namespace gaea {
 
 					void clear(void);
 
-					std::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator find(
+					gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator find(
 						__in gaea::uid_t id,
 						__in gaea::entity_t type
 						);
 
-					std::vector<std::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>> m_entry;
+					size_t m_drawn;
+
+					std::vector<gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>> m_entry;
 
 					bool m_initialized;
 
 					static _manager *m_instance;
 
+					size_t m_occluded;
+
 			} manager;
 		}
 	}
@@ -23,10 +23,19 @@
 namespace gaea {
 
 	#define EVENT_CAMERA_MAX EVENT_CAMERA_UP_SET
-	#define EVENT_INPUT_MAX EVENT_INPUT_WHEEL
+	#define EVENT_HISTOGRAM_COUNT 40
+	#define EVENT_INPUT_MAX EVENT_INPUT_CONTROLLER_BUTTON
 	#define EVENT_INVALID SCALAR_INVALID(gaea::event_t)
 	#define EVENT_MAX EVENT_INPUT
+	#define EVENT_PRIORITY_COUNT (EVENT_PRIORITY_MAX + 1)
+	#define EVENT_PRIORITY_MAX EVENT_PRIORITY_LOW
+	#define EVENT_PRIORITY_TYPE SCALAR_INVALID(gaea::event_priority_t)
 	#define EVENT_SPECIFIER_UNDEFINED SCALAR_INVALID(uint32_t)
+	#define EVENT_TIMEOUT_NONE 0
+
+	#define EVENT_PRIORITY_STRING(_TYPE_) \
+		((_TYPE_) > EVENT_PRIORITY_MAX ? STRING_UNKNOWN : \
+		STRING_CHECK(EVENT_PRIORITY_STR[_TYPE_]))
 
 	#define EVENT_STRING(_TYPE_) \
 		((_TYPE_) > EVENT_MAX ? STRING_UNKNOWN : \
@@ -42,6 +51,21 @@ namespace gaea {
 		"UNDEFINED", "CAMERA", "INPUT",
 		};
 
+	typedef enum {
+		EVENT_PRIORITY_HIGH = 0,
+		EVENT_PRIORITY_NORMAL,
+		EVENT_PRIORITY_LOW,
+	} event_priority_t;
+
+	static const std::string EVENT_PRIORITY_STR[] = {
+		"HIGH", "NORMAL", "LOW",
+		};
+
+	// default priority of each event type, indexed by event_t
+	static const gaea::event_priority_t EVENT_PRIORITY_INIT[] = {
+		EVENT_PRIORITY_LOW, EVENT_PRIORITY_NORMAL, EVENT_PRIORITY_HIGH,
+		};
+
 	enum {
 		EVENT_CAMERA_CLIP_SET = 0,
 		EVENT_CAMERA_DIMENSIONS_SET,
@@ -60,17 +84,38 @@ namespace gaea {
 		EVENT_INPUT_KEY,
 		EVENT_INPUT_MOTION,
 		EVENT_INPUT_WHEEL,
+
+		// appended, so recorded replays keep their specifiers
+		EVENT_INPUT_CONTROLLER_AXIS,
+		EVENT_INPUT_CONTROLLER_BUTTON,
 	};
 
 	namespace engine {
 
 		namespace event {
 
+			/*
+			 * Enqueue-to-dispatch latency in nanoseconds. Histogram bucket N counts
+			 * samples below 2^N ns (bucket 0 holds zero-latency samples), and the
+			 * percentiles report the upper bound of the bucket they fall in.
+			 * Dropped events expired before dispatch and are not sampled.
+			 */
+			typedef struct {
+				uint64_t count;
+				uint64_t dropped;
+				uint64_t histogram[EVENT_HISTOGRAM_COUNT];
+				uint64_t maximum;
+				uint64_t p50;
+				uint64_t p99;
+			} statistic_t;
+
 			void notify(
 				__in gaea::event_t type,
 				__in_opt uint32_t specifier = EVENT_SPECIFIER_UNDEFINED,
 				__in_opt void *context = nullptr,
-				__in_opt size_t length = 0
+				__in_opt size_t length = 0,
+				__in_opt gaea::event_priority_t priority = EVENT_PRIORITY_TYPE,
+				__in_opt uint64_t timeout = EVENT_TIMEOUT_NONE
 				);
 
 			typedef class _base :
@@ -132,6 +177,27 @@ namespace gaea {
 				__in void *context
 				);
 
+			typedef std::vector<std::pair<gaea::engine::event::handler_cb, void *>> handler_list_t;
+
+			/*
+			 * Handlers are kept as an immutable list per event type. Dispatch takes a
+			 * reference to the current list and walks it without holding any lock.
+			 * Registration copies the list, edits the copy and publishes it; readers
+			 * still holding the old list keep it alive until they finish. Handlers may
+			 * therefore register or unregister from inside a callback, with the change
+			 * taking effect from the next event.
+			 *
+			 * The dispatch epoch is odd while handlers run. Unregistering from any
+			 * other thread waits out the dispatch in flight, so once it returns the
+			 * removed handler is never called again and its context may be freed.
+			 *
+			 * Pending events wait in one FIFO queue per priority. The dispatcher always
+			 * takes the oldest event of the highest non-empty priority, so a burst of
+			 * low priority events delays input by at most the event in flight. An
+			 * event generated with a timeout (in nanoseconds) is dropped if it is
+			 * still queued once the timeout has passed.
+			 */
+
 			typedef class _manager {
 
 				public:
@@ -160,7 +226,9 @@ namespace gaea {
 						__in gaea::event_t type,
 						__in_opt uint32_t specifier = EVENT_SPECIFIER_UNDEFINED,
 						__in_opt void *context = nullptr,
-						__in_opt size_t length = 0
+						__in_opt size_t length = 0,
+						__in_opt gaea::event_priority_t priority = EVENT_PRIORITY_TYPE,
+						__in_opt uint64_t timeout = EVENT_TIMEOUT_NONE
 						);
 
 					size_t increment_reference(
@@ -174,6 +242,10 @@ namespace gaea {
 
 					bool is_initialized(void);
 
+					gaea::event_priority_t priority(
+						__in gaea::event_t type
+						);
+
 					size_t reference_count(
 						__in gaea::uid_t id,
 						__in gaea::event_t type
@@ -185,6 +257,15 @@ namespace gaea {
 						__in_opt void *context = nullptr
 						);
 
+					void set_priority(
+						__in gaea::event_t type,
+						__in gaea::event_priority_t priority
+						);
+
+					gaea::engine::event::statistic_t statistic(
+						__in gaea::event_priority_t priority
+						);
+
 					std::string to_string(
 						__in_opt bool verbose = false
 						);
@@ -199,6 +280,13 @@ namespace gaea {
 
 				protected:
 
+					typedef struct {
+						uint64_t expire;
+						gaea::uid_t id;
+						uint64_t time;
+						gaea::event_t type;
+					} queue_t;
+
 					_manager(void);
 
 					_manager(
@@ -215,22 +303,29 @@ namespace gaea {
 
 					void clear(void);
 
-					std::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator find_event(
+					gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator find_event(
 						__in gaea::uid_t id,
 						__in gaea::event_t type
 						);
 
-					std::set<std::pair<gaea::engine::event::handler_cb, void *>>::iterator find_handler(
+					gaea::engine::event::handler_list_t::const_iterator find_handler(
+						__in const gaea::engine::event::handler_list_t &list,
 						__in gaea::engine::event::handler_cb handler,
 						__in gaea::event_t type,
 						__in_opt void *context = nullptr
 						);
 
-					std::vector<std::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>> m_event;
+					void wait_dispatch(void);
+
+					std::atomic<uint64_t> m_dispatch;
+
+					std::vector<gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>> m_event;
 
-					std::vector<std::queue<gaea::uid_t>> m_event_queue;
+					std::vector<std::queue<queue_t>> m_event_queue;
 
-					std::vector<std::set<std::pair<gaea::engine::event::handler_cb, void *>>> m_handler;
+					std::vector<std::shared_ptr<const gaea::engine::event::handler_list_t>> m_handler;
+
+					std::mutex m_handler_lock;
 
 					bool m_initialized;
 
@@ -238,8 +333,12 @@ namespace gaea {
 
 					std::recursive_mutex m_lock;
 
+					std::vector<gaea::event_priority_t> m_priority;
+
 					gaea::engine::signal::base m_signal;
 
+					std::vector<gaea::engine::event::statistic_t> m_statistic;
+
 					std::thread m_thread;
 
 			} manager;
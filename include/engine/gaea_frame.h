@@ -0,0 +1,104 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_FRAME_H_
+#define GAEA_FRAME_H_
+
+namespace gaea {
+
+	#define FRAME_BUFFER_COUNT 3
+
+	namespace engine {
+
+		namespace frame {
+
+			typedef struct {
+				gaea::engine::entity::snapshot_t camera;
+				std::vector<gaea::engine::entity::snapshot_t> entity;
+				glm::mat4 projection;
+				uint64_t step;
+				uint32_t tick;
+				uint64_t time;
+			} packet_t;
+
+			/*
+			 * Triple buffer between one producer and one consumer. The producer
+			 * fills the back packet and publishes it. The consumer takes the most
+			 * recently published packet as its front. Neither side waits for the
+			 * other, and a packet is never written while it is being read.
+			 */
+			typedef class _buffer {
+
+				public:
+
+					_buffer(void);
+
+					virtual ~_buffer(void);
+
+					bool acquire(void);
+
+					static std::string as_string(
+						__in const _buffer &object,
+						__in_opt bool verbose = false
+						);
+
+					gaea::engine::frame::packet_t &back(void);
+
+					void clear(void);
+
+					gaea::engine::frame::packet_t &front(void);
+
+					void publish(void);
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+				protected:
+
+					_buffer(
+						__in const _buffer &other
+						);
+
+					_buffer &operator=(
+						__in const _buffer &other
+						);
+
+					uint64_t m_acquired;
+
+					size_t m_back;
+
+					bool m_fresh;
+
+					size_t m_front;
+
+					std::mutex m_lock;
+
+					std::vector<gaea::engine::frame::packet_t> m_packet;
+
+					uint64_t m_published;
+
+					size_t m_ready;
+
+			} buffer;
+		}
+	}
+}
+
+#endif // GAEA_FRAME_H_
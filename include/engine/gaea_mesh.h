@@ -0,0 +1,330 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_MESH_H_
+#define GAEA_MESH_H_
+
+namespace gaea {
+
+	#define FACE_MAX FACE_POSITIVE_Z
+
+	#define MESH_ATTRIBUTE_LAYER 1
+	#define MESH_ATTRIBUTE_POSITION 0
+	#define MESH_FRAGMENT_INIT "./res/chunk_frag.glsl"
+	#define MESH_LOD_DISTANCE_INIT 4
+	#define MESH_LOD_MAX 3
+	#define MESH_NEIGHBOUR_CENTER 13
+	#define MESH_NEIGHBOUR_COUNT 27
+	#define MESH_PADDED_VOLUME (MESH_PADDED_WIDTH * MESH_PADDED_WIDTH * MESH_PADDED_WIDTH)
+	#define MESH_PADDED_WIDTH (CHUNK_WIDTH + 2)
+	#define MESH_UPLOAD_INIT 32
+	#define MESH_VERTEX_INIT "./res/chunk_vert.glsl"
+	#define MESH_WORKER_INIT 2
+
+	/*
+	 * Packed vertex position word:
+	 *   [0:5] x, [6:11] y, [12:17] z, [18:20] face, [21:22] ambient occlusion
+	 */
+	#define MESH_VERTEX_AO(_VERT_) (((_VERT_) >> 21) & 0x3)
+	#define MESH_VERTEX_FACE(_VERT_) (((_VERT_) >> 18) & 0x7)
+	#define MESH_VERTEX_PACK(_X_, _Y_, _Z_, _FACE_, _AO_) \
+		(((_X_) & 0x3f) | (((_Y_) & 0x3f) << 6) | (((_Z_) & 0x3f) << 12) \
+		| (((_FACE_) & 0x7) << 18) | (((_AO_) & 0x3) << 21))
+	#define MESH_VERTEX_X(_VERT_) ((_VERT_) & 0x3f)
+	#define MESH_VERTEX_Y(_VERT_) (((_VERT_) >> 6) & 0x3f)
+	#define MESH_VERTEX_Z(_VERT_) (((_VERT_) >> 12) & 0x3f)
+
+	typedef enum {
+		FACE_NEGATIVE_X = 0,
+		FACE_POSITIVE_X,
+		FACE_NEGATIVE_Y,
+		FACE_POSITIVE_Y,
+		FACE_NEGATIVE_Z,
+		FACE_POSITIVE_Z,
+	} face_t;
+
+	namespace engine {
+
+		namespace mesh {
+
+			typedef struct {
+				uint32_t position;
+				uint32_t layer;
+			} vertex_t;
+
+			typedef struct {
+				std::vector<uint32_t> index;
+				std::vector<gaea::engine::mesh::vertex_t> vertex;
+			} data_t;
+
+			void downsample(
+				__in const std::vector<gaea::block_t> &padded,
+				__in uint32_t lod,
+				__out std::vector<gaea::block_t> &coarse
+				);
+
+			void generate(
+				__in const std::vector<gaea::block_t> &padded,
+				__out gaea::engine::mesh::data_t &data,
+				__in_opt uint32_t lod = 0
+				);
+
+			uint32_t hull(
+				__in const std::vector<gaea::block_t> &padded
+				);
+
+			uint32_t lod(
+				__in const glm::ivec3 &coordinate,
+				__in const glm::ivec3 &focus,
+				__in int32_t distance
+				);
+
+			void pad(
+				__in const gaea::engine::chunk::base *neighbour[MESH_NEIGHBOUR_COUNT],
+				__out std::vector<gaea::block_t> &padded
+				);
+
+			typedef class _base :
+					public gaea::engine::entity::base_model {
+
+				public:
+
+					_base(
+						__in const glm::ivec3 &coordinate,
+						__in gaea::graphics::program::base &program,
+						__in gaea::graphics::vao::base &box,
+						__in_opt bool visible = ENTITY_VISIBLE_INIT
+						);
+
+					_base(
+						__in const _base &other
+						);
+
+					virtual ~_base(void);
+
+					_base &operator=(
+						__in const _base &other
+						);
+
+					static std::string as_string(
+						__in const _base &object,
+						__in_opt bool verbose = false
+						);
+
+					virtual bool bounds(
+						__in const glm::dvec3 &position,
+						__out gaea::engine::occlusion::box_t &box
+						);
+
+					const glm::ivec3 &coordinate(void);
+
+					size_t count(void);
+
+					uint32_t hull(void);
+
+					virtual bool is_occluded(void);
+
+					uint32_t lod(void);
+
+					size_t memory(void);
+
+					virtual void query(
+						__in const glm::dvec3 &position,
+						__in const glm::mat4 &projection,
+						__in const glm::mat4 &view
+						);
+
+					virtual void render(
+						__in const glm::dvec3 &position,
+						__in const glm::vec3 &rotation,
+						__in const glm::vec3 &up,
+						__in const glm::mat4 &projection,
+						__in const glm::mat4 &view
+						);
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					virtual void update(
+						__in GLfloat delta
+						);
+
+					void upload(
+						__in const gaea::engine::mesh::data_t &data,
+						__in_opt uint32_t lod = 0,
+						__in_opt uint32_t hull = 0
+						);
+
+				protected:
+
+					gaea::graphics::vao::base m_box;
+
+					glm::ivec3 m_coordinate;
+
+					size_t m_count;
+
+					uint32_t m_hull;
+
+					uint32_t m_lod;
+
+					size_t m_memory;
+
+					bool m_occluded;
+
+					gaea::graphics::program::base m_program;
+
+					gaea::graphics::query::base m_query;
+
+					gaea::graphics::vao::base m_vao;
+
+			} base;
+
+			/*
+			 * Chunks are meshed at 1/2^lod resolution, where lod grows by one each
+			 * time the horizontal distance to the camera doubles past the LOD
+			 * distance. Coarse meshes keep their side walls (skirts) so they cover
+			 * any crack against a finer neighbour. Each chunk's hull, the run of
+			 * fully solid layers from its floor, serves as a software occluder.
+			 */
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					bool contains(
+						__in const glm::ivec3 &coordinate
+						);
+
+					size_t count(void);
+
+					int32_t distance(void);
+
+					void erase(
+						__in const glm::ivec3 &coordinate
+						);
+
+					void initialize(
+						__in_opt size_t workers = MESH_WORKER_INIT,
+						__in_opt int32_t distance = MESH_LOD_DISTANCE_INIT,
+						__in_opt const std::string &vertex = MESH_VERTEX_INIT,
+						__in_opt const std::string &fragment = MESH_FRAGMENT_INIT
+						);
+
+					static bool is_allocated(void);
+
+					bool is_initialized(void);
+
+					size_t memory(void);
+
+					size_t memory(
+						__in const glm::ivec3 &coordinate
+						);
+
+					void occluders(
+						__in const glm::dvec3 &position,
+						__out gaea::engine::arena::vector<gaea::engine::occlusion::box_t> &occluder,
+						__in_opt size_t count = OCCLUSION_OCCLUDER_MAX
+						);
+
+					size_t pending(void);
+
+					size_t size(void);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void uninitialize(void);
+
+					void update(
+						__in const glm::dvec3 &position,
+						__in_opt size_t upload = MESH_UPLOAD_INIT
+						);
+
+				protected:
+
+					typedef struct {
+						glm::ivec3 coordinate;
+						uint32_t generation;
+						uint32_t hull;
+						uint32_t lod;
+						std::vector<gaea::block_t> padded;
+						gaea::engine::mesh::data_t data;
+					} job_t;
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					static void _thread(void);
+
+					void clear(void);
+
+					void refresh(void);
+
+					void schedule(
+						__in const glm::ivec3 &coordinate
+						);
+
+					gaea::graphics::vao::base *m_box;
+
+					std::condition_variable m_condition;
+
+					int32_t m_distance;
+
+					std::unordered_map<glm::ivec3, gaea::engine::mesh::base *, gaea::engine::chunk::hash_t> m_entry;
+
+					glm::ivec3 m_focus;
+
+					bool m_focused;
+
+					std::unordered_map<glm::ivec3, uint32_t, gaea::engine::chunk::hash_t> m_generation;
+
+					bool m_initialized;
+
+					static _manager *m_instance;
+
+					std::queue<job_t> m_job;
+
+					std::mutex m_lock;
+
+					gaea::graphics::program::base *m_program;
+
+					std::vector<job_t> m_result;
+
+					std::vector<std::thread> m_worker;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_MESH_H_
@@ -32,7 +32,7 @@ namespace gaea {
 				public:
 
 					_base(
-						__in_opt const glm::vec3 &position = ENTITY_POSITION_INIT,
+						__in_opt const glm::dvec3 &position = ENTITY_POSITION_INIT,
 						__in_opt const glm::vec3 &rotation = ENTITY_ROTATION_INIT,
 						__in_opt const glm::vec3 &up = ENTITY_UP_INIT,
 						__in_opt bool visible = ENTITY_VISIBLE_INIT
@@ -80,7 +80,7 @@ namespace gaea {
 						);
 
 					virtual void render(
-						__in const glm::vec3 &position,
+						__in const glm::dvec3 &position,
 						__in const glm::vec3 &rotation,
 						__in const glm::vec3 &up,
 						__in const glm::mat4 &projection,
@@ -116,7 +116,7 @@ namespace gaea {
 				public:
 
 					_base_controllable(
-						__in_opt const glm::vec3 &position = ENTITY_POSITION_INIT,
+						__in_opt const glm::dvec3 &position = ENTITY_POSITION_INIT,
 						__in_opt const glm::vec3 &rotation = ENTITY_ROTATION_INIT,
 						__in_opt const glm::vec3 &up = ENTITY_UP_INIT,
 						__in_opt bool visible = ENTITY_VISIBLE_INIT,
@@ -141,7 +141,7 @@ namespace gaea {
 						);
 
 					virtual void render(
-						__in const glm::vec3 &position,
+						__in const glm::dvec3 &position,
 						__in const glm::vec3 &rotation,
 						__in const glm::vec3 &up,
 						__in const glm::mat4 &projection,
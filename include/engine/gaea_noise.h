@@ -0,0 +1,115 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_NOISE_H_
+#define GAEA_NOISE_H_
+
+namespace gaea {
+
+	#define NOISE_GAIN_INIT 0.5f
+	#define NOISE_LACUNARITY_INIT 2.f
+	#define NOISE_LANE 4
+	#define NOISE_OCTAVE_INIT 4
+	#define NOISE_OCTAVE_MAX 16
+	#define NOISE_PERMUTATION 256
+	#define NOISE_SEED_INIT 0
+
+	namespace engine {
+
+		namespace noise {
+
+			/*
+			 * Seeded improved Perlin noise. The lane variants evaluate NOISE_LANE
+			 * samples at once using SSE4.1 (or AVX2 gathers) when available.
+			 */
+			typedef class _base {
+
+				public:
+
+					_base(
+						__in_opt uint64_t seed = NOISE_SEED_INIT
+						);
+
+					_base(
+						__in const _base &other
+						);
+
+					virtual ~_base(void);
+
+					_base &operator=(
+						__in const _base &other
+						);
+
+					static std::string as_string(
+						__in const _base &object,
+						__in_opt bool verbose = false
+						);
+
+					float fbm(
+						__in float x,
+						__in float y,
+						__in float z,
+						__in_opt uint32_t octaves = NOISE_OCTAVE_INIT,
+						__in_opt float lacunarity = NOISE_LACUNARITY_INIT,
+						__in_opt float gain = NOISE_GAIN_INIT
+						) const;
+
+					void fbm(
+						__in const float x[NOISE_LANE],
+						__in const float y[NOISE_LANE],
+						__in const float z[NOISE_LANE],
+						__out float result[NOISE_LANE],
+						__in_opt uint32_t octaves = NOISE_OCTAVE_INIT,
+						__in_opt float lacunarity = NOISE_LACUNARITY_INIT,
+						__in_opt float gain = NOISE_GAIN_INIT
+						) const;
+
+					float perlin(
+						__in float x,
+						__in float y,
+						__in float z
+						) const;
+
+					void perlin(
+						__in const float x[NOISE_LANE],
+						__in const float y[NOISE_LANE],
+						__in const float z[NOISE_LANE],
+						__out float result[NOISE_LANE]
+						) const;
+
+					uint64_t seed(void) const;
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+				protected:
+
+					void permute(void);
+
+					int32_t m_permutation[NOISE_PERMUTATION * 2];
+
+					uint64_t m_seed;
+
+			} base;
+		}
+	}
+}
+
+#endif // GAEA_NOISE_H_
@@ -22,9 +22,19 @@
 
 namespace gaea {
 
+	#define BUTTON_COUNT (BUTTON_MAX + 1)
 	#define BUTTON_MAX BUTTON_X2
+	#define INPUT_BIT(_INDEX_) \
+		(1ULL << ((_INDEX_) % INPUT_WORD_BITS))
 	#define INPUT_SENSITIVITY_INIT 15.f
 	#define INPUT_SPEED_INIT 10.f
+	#define INPUT_TEST(_MASK_, _INDEX_) \
+		(((_MASK_)[INPUT_WORD(_INDEX_)] & INPUT_BIT(_INDEX_)) != 0)
+	#define INPUT_WORD(_INDEX_) \
+		((_INDEX_) / INPUT_WORD_BITS)
+	#define INPUT_WORD_BITS 64
+	#define INPUT_WORD_COUNT ((SDL_NUM_SCANCODES + INPUT_WORD_BITS - 1) / INPUT_WORD_BITS)
+	#define KEY_COUNT (KEY_MAX + 1)
 	#define KEY_MAX KEY_RIGHT
 
 	typedef enum {
@@ -53,6 +63,121 @@ namespace gaea {
 
 		namespace observer {
 
+			typedef struct {
+				uint64_t button;
+				uint64_t controller_button;
+				uint64_t key[INPUT_WORD_COUNT];
+			} state_t;
+
+			/*
+			 * Key and button state is kept as bitmasks indexed by scancode and button.
+			 * The feeding thread only sets and clears bits in the live masks, so any
+			 * other thread can read them without a lock. A snapshot returns what is
+			 * held, and a latch returns the presses and releases seen since the
+			 * previous latch, so a tap shorter than a frame still registers as an edge.
+			 * Motion and wheel accumulate until taken.
+			 */
+			typedef class _live {
+
+				public:
+
+					_live(void);
+
+					virtual ~_live(void);
+
+					GLfloat axis(
+						__in uint32_t index
+						) const;
+
+					void clear(void);
+
+					void clear_controller(void);
+
+					void coordinate(
+						__in gaea::button_t type,
+						__out glm::ivec2 &coordinate,
+						__out uint8_t &click
+						) const;
+
+					void latch(
+						__out gaea::engine::observer::state_t &pressed,
+						__out gaea::engine::observer::state_t &released
+						);
+
+					glm::ivec2 motion(void);
+
+					void on_button(
+						__in const SDL_MouseButtonEvent &event
+						);
+
+					void on_controller_axis(
+						__in const SDL_ControllerAxisEvent &event
+						);
+
+					void on_controller_button(
+						__in const SDL_ControllerButtonEvent &event
+						);
+
+					void on_key(
+						__in const SDL_KeyboardEvent &event
+						);
+
+					void on_motion(
+						__in const SDL_MouseMotionEvent &event
+						);
+
+					void on_wheel(
+						__in const SDL_MouseWheelEvent &event
+						);
+
+					void snapshot(
+						__out gaea::engine::observer::state_t &state
+						) const;
+
+					int32_t wheel(void);
+
+				protected:
+
+					_live(
+						__in const _live &other
+						);
+
+					_live &operator=(
+						__in const _live &other
+						);
+
+					std::atomic<uint64_t> m_button;
+
+					std::atomic<uint8_t> m_button_click[BUTTON_COUNT];
+
+					std::atomic<uint64_t> m_button_coordinate[BUTTON_COUNT];
+
+					std::atomic<uint64_t> m_button_pressed;
+
+					std::atomic<uint64_t> m_button_released;
+
+					std::atomic<int16_t> m_controller_axis[SDL_CONTROLLER_AXIS_MAX];
+
+					std::atomic<uint64_t> m_controller_button;
+
+					std::atomic<uint64_t> m_controller_button_pressed;
+
+					std::atomic<uint64_t> m_controller_button_released;
+
+					std::atomic<uint64_t> m_key[INPUT_WORD_COUNT];
+
+					std::atomic<uint64_t> m_key_pressed[INPUT_WORD_COUNT];
+
+					std::atomic<uint64_t> m_key_released[INPUT_WORD_COUNT];
+
+					std::atomic<int32_t> m_motion_x;
+
+					std::atomic<int32_t> m_motion_y;
+
+					std::atomic<int32_t> m_wheel;
+
+			} live;
+
 			typedef class _base {
 
 				public:
@@ -106,6 +231,13 @@ namespace gaea {
 
 			} base;
 
+			/*
+			 * The event thread feeds the live masks, and each update takes a snapshot
+			 * of them along with the edges latched since the previous update.
+			 *
+			 * Once the action manager is initialized, movement and look follow its
+			 * axes and its configured speed and sensitivity instead of the key map.
+			 */
 			typedef class _base_input :
 					public gaea::engine::observer::base {
 
@@ -113,7 +245,7 @@ namespace gaea {
 
 					_base_input(
 						
-						__in glm::vec3 &position_reference,
+						__in glm::dvec3 &position_reference,
 						__in glm::vec3 &rotation_reference,
 						__in glm::vec3 &up_reference,
 						__in_opt const std::map<gaea::key_t, SDL_Scancode> &key_map = INPUT_KEY_MAP_INIT,
@@ -144,16 +276,40 @@ namespace gaea {
 						__out uint8_t &click
 						);
 
+					bool is_button_released(
+						__in gaea::button_t type
+						);
+
+					bool is_button_triggered(
+						__in gaea::button_t type
+						);
+
 					bool is_key_pressed(
 						__in gaea::key_t type
 						);
 
+					bool is_key_released(
+						__in gaea::key_t type
+						);
+
+					bool is_key_triggered(
+						__in gaea::key_t type
+						);
+
+					bool is_scancode_pressed(
+						__in SDL_Scancode scancode
+						);
+
 					void setup(
 						__in const std::map<gaea::key_t, SDL_Scancode> &key_map,
 						__in GLfloat speed,
 						__in GLfloat sensitivity
 						);
 
+					void snapshot(
+						__out gaea::engine::observer::state_t &state
+						) const;
+
 					virtual std::string to_string(
 						__in_opt bool verbose = false
 						);
@@ -169,33 +325,23 @@ namespace gaea {
 						__in void *context
 						);
 
-					void on_button(
-						__in const SDL_MouseButtonEvent &event
-						);
-
-					void on_key(
-						__in const SDL_KeyboardEvent &event
-						);
+					void setup(void);
 
-					void on_motion(
-						__in const SDL_MouseMotionEvent &event
-						);
+					uint32_t m_action_frame;
 
-					void on_wheel(
-						__in const SDL_MouseWheelEvent &event
-						);
+					gaea::engine::observer::state_t m_current;
 
-					void setup(void);
+					std::vector<SDL_Scancode> m_key_map;
 
-					std::map<gaea::button_t, std::tuple<uint8_t, glm::ivec2, bool>> m_button;
+					gaea::engine::observer::live m_live;
 
-					std::map<SDL_Scancode, bool> m_key;
+					glm::vec3 m_position_delta;
 
-					std::map<gaea::key_t, SDL_Scancode> m_key_map;
+					glm::dvec3 &m_position_reference;
 
-					glm::vec3 m_position_delta;
+					gaea::engine::observer::state_t m_pressed;
 
-					glm::vec3 &m_position_reference;
+					gaea::engine::observer::state_t m_released;
 
 					glm::vec3 m_rotation_current;
 
@@ -0,0 +1,193 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_OCCLUSION_H_
+#define GAEA_OCCLUSION_H_
+
+namespace gaea {
+
+	#define OCCLUSION_HEIGHT 128
+	#define OCCLUSION_OCCLUDER_MAX 64
+	#define OCCLUSION_WIDTH 256
+
+	namespace engine {
+
+		namespace occlusion {
+
+			typedef struct {
+				glm::vec3 minimum;
+				glm::vec3 maximum;
+			} box_t;
+
+			/*
+			 * Low-resolution software depth buffer. Occluder boxes are rasterized
+			 * into it, nearest depth wins, and boxes are tested against it
+			 * conservatively: any box crossing the near plane, or reaching a
+			 * pixel no occluder covers in front of it, is visible. Boxes outside
+			 * the view frustum are not.
+			 */
+			typedef class _base {
+
+				public:
+
+					_base(void);
+
+					_base(
+						__in const _base &other
+						);
+
+					virtual ~_base(void);
+
+					_base &operator=(
+						__in const _base &other
+						);
+
+					static std::string as_string(
+						__in const _base &object,
+						__in_opt bool verbose = false
+						);
+
+					void clear(void);
+
+					const std::vector<float> &depth(void);
+
+					void rasterize(
+						__in const glm::mat4 &transform,
+						__in const gaea::engine::occlusion::box_t &box
+						);
+
+					void rasterize(
+						__in const glm::mat4 &transform,
+						__in const std::vector<gaea::engine::occlusion::box_t> &box
+						);
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					bool visible(
+						__in const glm::mat4 &transform,
+						__in const gaea::engine::occlusion::box_t &box
+						);
+
+				protected:
+
+					bool project(
+						__in const glm::mat4 &transform,
+						__in const gaea::engine::occlusion::box_t &box,
+						__out glm::vec3 corner[]
+						);
+
+					void triangle(
+						__in const glm::vec3 &first,
+						__in const glm::vec3 &second,
+						__in const glm::vec3 &third
+						);
+
+					std::vector<float> m_depth;
+
+					size_t m_occluder;
+
+			} base;
+
+			/*
+			 * Rasterizes each frame's occluders on a worker thread while the
+			 * frame is updated. Visibility tests wait for that frame's buffer.
+			 */
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					size_t culled(void);
+
+					void initialize(void);
+
+					static bool is_allocated(void);
+
+					bool is_initialized(void);
+
+					void rasterize(
+						__in const glm::mat4 &transform,
+						__in const gaea::engine::arena::vector<gaea::engine::occlusion::box_t> &occluder
+						);
+
+					size_t tested(void);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void uninitialize(void);
+
+					bool visible(
+						__in const gaea::engine::occlusion::box_t &box
+						);
+
+				protected:
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					static void _thread(void);
+
+					void clear(void);
+
+					gaea::engine::occlusion::base m_buffer;
+
+					std::condition_variable m_condition;
+
+					size_t m_culled;
+
+					bool m_initialized;
+
+					static _manager *m_instance;
+
+					std::mutex m_lock;
+
+					std::vector<gaea::engine::occlusion::box_t> m_occluder;
+
+					bool m_pending;
+
+					bool m_ready;
+
+					size_t m_tested;
+
+					glm::mat4 m_transform;
+
+					std::thread m_worker;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_OCCLUSION_H_
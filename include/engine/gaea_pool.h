@@ -0,0 +1,235 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_POOL_H_
+#define GAEA_POOL_H_
+
+namespace gaea {
+
+	#define POOL_BLOCK_ALIGNMENT 16
+	#define POOL_BLOCK_MAX 1024
+	#define POOL_CACHE_BATCH 32
+	#define POOL_CACHE_INIT true
+	#define POOL_CHUNK_LENGTH (16 * BYTES_PER_KBYTE)
+	#define POOL_CLASS_COUNT (POOL_BLOCK_MAX / POOL_BLOCK_ALIGNMENT)
+
+	namespace engine {
+
+		namespace pool {
+
+			typedef struct {
+				size_t allocated;
+				size_t chunk;
+				size_t high_water;
+				size_t used;
+			} statistic_t;
+
+			void *allocate(
+				__in size_t length
+				);
+
+			void deallocate(
+				__in void *data,
+				__in size_t length
+				);
+
+			template <class T, class... A> T *create(
+				__in A&&... argument
+				)
+			{
+				void *data = gaea::engine::pool::allocate(sizeof(T));
+
+				try {
+					return new (data) T(std::forward<A>(argument)...);
+				} catch(...) {
+					gaea::engine::pool::deallocate(data, sizeof(T));
+					throw;
+				}
+			}
+
+			template <class T> void destroy(
+				__in T *object
+				)
+			{
+
+				if(object) {
+					object->~T();
+					gaea::engine::pool::deallocate(object, sizeof(T));
+				}
+			}
+
+			/*
+			 * STL adapter over the pool. Requests of up to POOL_BLOCK_MAX bytes, such
+			 * as tree and hash nodes or small bucket arrays, come from the pool;
+			 * larger ones go to the heap.
+			 */
+			template <class T> class allocator {
+
+				public:
+
+					typedef T value_type;
+
+					allocator(void)
+					{
+						return;
+					}
+
+					template <class U> allocator(
+						__in const allocator<U> &other
+						)
+					{
+						return;
+					}
+
+					T *allocate(
+						__in size_t count
+						)
+					{
+						return (T *) gaea::engine::pool::allocate(count * sizeof(T));
+					}
+
+					void deallocate(
+						__in T *data,
+						__in size_t count
+						)
+					{
+						gaea::engine::pool::deallocate(data, count * sizeof(T));
+					}
+			};
+
+			template <class T, class U> bool operator==(
+				__in const gaea::engine::pool::allocator<T> &left,
+				__in const gaea::engine::pool::allocator<U> &right
+				)
+			{
+				return true;
+			}
+
+			template <class T, class U> bool operator!=(
+				__in const gaea::engine::pool::allocator<T> &left,
+				__in const gaea::engine::pool::allocator<U> &right
+				)
+			{
+				return false;
+			}
+
+			template <class K, class V, class C = std::less<K>> using map = std::map<K, V, C,
+				gaea::engine::pool::allocator<std::pair<const K, V>>>;
+
+			template <class K, class C = std::less<K>> using set = std::set<K, C,
+				gaea::engine::pool::allocator<K>>;
+
+			/*
+			 * Fixed-size free lists, one per 16-byte size class up to POOL_BLOCK_MAX.
+			 * Blocks are carved from chunks that are only released at exit. Each
+			 * thread keeps a small cache per class and trades blocks with the shared
+			 * list in batches, so most allocations take no lock. Freeing the chunks
+			 * starts a new pool generation, and a thread drops a cache left over
+			 * from an older generation instead of handing out its blocks. A thread
+			 * flushes its cache back to the shared lists when it exits, or earlier
+			 * through flush(). Larger requests go to the heap.
+			 *
+			 * The pool needs no initialization. Managers that hold pooled containers
+			 * acquire it before registering their own atexit handler, so the pool is
+			 * torn down after them.
+			 */
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					void *allocate(
+						__in size_t length
+						);
+
+					void deallocate(
+						__in void *data,
+						__in size_t length
+						);
+
+					void flush(void);
+
+					static bool is_allocated(void);
+
+					bool is_cached(void);
+
+					void set_cached(
+						__in bool value
+						);
+
+					gaea::engine::pool::statistic_t statistic(
+						__in_opt size_t length = 0
+						);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+				protected:
+
+					typedef struct {
+						std::vector<void *> chunk;
+						void *head;
+						size_t high_water;
+						size_t used;
+					} class_t;
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					void clear(void);
+
+					void refill(
+						__in size_t index,
+						__inout void *&head,
+						__inout size_t &count
+						);
+
+					void release(
+						__in size_t index,
+						__inout void *&head,
+						__inout size_t &count
+						);
+
+					std::atomic<bool> m_cached;
+
+					std::vector<class_t> m_class;
+
+					static _manager *m_instance;
+
+					std::mutex m_lock;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_POOL_H_
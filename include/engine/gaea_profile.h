@@ -0,0 +1,193 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_PROFILE_H_
+#define GAEA_PROFILE_H_
+
+namespace gaea {
+
+	#define PROFILE_GPU_LATENCY 4
+	#define PROFILE_GPU_PREFIX "gpu."
+	#define PROFILE_HISTORY_INIT 240
+	#define PROFILE_TRACE_INIT false
+	#define PROFILE_TRACE_MAX (1 << 16)
+	#define PROFILE_TRACE_PATH_INIT "./trace.json"
+
+	namespace engine {
+
+		namespace profile {
+
+			typedef struct {
+				uint64_t average;
+				uint64_t count;
+				uint64_t maximum;
+				uint64_t minimum;
+				uint64_t p99;
+			} statistic_t;
+
+			uint64_t now(void);
+
+			typedef class _scope {
+
+				public:
+
+					_scope(
+						__in const std::string &name
+						);
+
+					virtual ~_scope(void);
+
+				protected:
+
+					_scope(
+						__in const _scope &other
+						);
+
+					_scope &operator=(
+						__in const _scope &other
+						);
+
+					uint64_t m_begin;
+
+					std::string m_name;
+
+			} scope;
+
+			/*
+			 * Samples are nanoseconds. Each phase keeps a rolling window of its
+			 * last samples for min/avg/p99 statistics. GPU phases time
+			 * GL_TIME_ELAPSED queries from a small ring that is read back only
+			 * once available, and may not nest. When tracing, the most recent
+			 * events are kept for a Chrome trace-event dump.
+			 */
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					void dump(
+						__in_opt const std::string &path = PROFILE_TRACE_PATH_INIT
+						);
+
+					void initialize(
+						__in_opt size_t history = PROFILE_HISTORY_INIT,
+						__in_opt bool trace = PROFILE_TRACE_INIT
+						);
+
+					static bool is_allocated(void);
+
+					bool is_initialized(void);
+
+					std::vector<std::string> phases(void);
+
+					void record(
+						__in const std::string &name,
+						__in uint64_t begin,
+						__in uint64_t end
+						);
+
+					void start(
+						__in const std::string &name
+						);
+
+					gaea::engine::profile::statistic_t statistic(
+						__in const std::string &name
+						);
+
+					void stop(
+						__in const std::string &name
+						);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void uninitialize(void);
+
+				protected:
+
+					typedef struct {
+						uint64_t begin;
+						uint64_t duration;
+						bool gpu;
+						std::string name;
+						uint32_t thread;
+					} event_t;
+
+					typedef struct {
+						bool active;
+						std::vector<uint64_t> begin;
+						size_t next;
+						std::vector<gaea::graphics::query::base> query;
+					} gpu_t;
+
+					typedef struct {
+						uint64_t count;
+						size_t next;
+						std::vector<uint64_t> sample;
+					} phase_t;
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					void clear(void);
+
+					void sample(
+						__in const std::string &name,
+						__in uint64_t begin,
+						__in uint64_t duration,
+						__in bool gpu
+						);
+
+					std::deque<event_t> m_event;
+
+					size_t m_history;
+
+					bool m_initialized;
+
+					static _manager *m_instance;
+
+					std::mutex m_lock;
+
+					std::map<std::string, phase_t> m_phase;
+
+					std::map<std::thread::id, uint32_t> m_thread;
+
+					std::map<std::string, gpu_t> m_timer;
+
+					bool m_trace;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_PROFILE_H_
@@ -0,0 +1,81 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_RAY_H_
+#define GAEA_RAY_H_
+
+namespace gaea {
+
+	#define RAY_DISTANCE_INIT 64.f
+
+	namespace engine {
+
+		namespace ray {
+
+			typedef struct {
+				gaea::block_t block;
+				GLfloat distance;
+				glm::ivec3 normal;
+				glm::ivec3 position;
+			} hit_t;
+
+			typedef struct {
+				glm::vec3 origin;
+				glm::vec3 direction;
+				GLfloat distance;
+			} ray_t;
+
+			/*
+			 * Rays step voxel by voxel (Amanatides-Woo DDA) through the world,
+			 * crossing missing or all-air chunks without block lookups. A miss
+			 * leaves hit.block set to BLOCK_AIR. Rays with a non-finite origin or
+			 * direction, or a non-finite or negative distance, are rejected.
+			 */
+			bool cast(
+				__in const glm::vec3 &origin,
+				__in const glm::vec3 &direction,
+				__out gaea::engine::ray::hit_t &hit,
+				__in_opt GLfloat distance = RAY_DISTANCE_INIT
+				);
+
+			size_t cast(
+				__in const std::vector<gaea::engine::ray::ray_t> &ray,
+				__out std::vector<gaea::engine::ray::hit_t> &hit
+				);
+
+			bool collide(
+				__in const glm::vec3 &minimum,
+				__in const glm::vec3 &maximum
+				);
+
+			bool pick(
+				__in const glm::ivec2 &coordinate,
+				__out gaea::engine::ray::hit_t &hit,
+				__in_opt GLfloat distance = RAY_DISTANCE_INIT
+				);
+
+			bool visible(
+				__in const glm::vec3 &origin,
+				__in const glm::vec3 &target
+				);
+		}
+	}
+}
+
+#endif // GAEA_RAY_H_
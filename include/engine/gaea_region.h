@@ -0,0 +1,276 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_REGION_H_
+#define GAEA_REGION_H_
+
+namespace gaea {
+
+	#define REGION_AREA (REGION_WIDTH * REGION_WIDTH)
+	#define REGION_BATCH_MAX 64
+	#define REGION_PATH_INIT "./save/"
+	#define REGION_SECTOR 4096
+	#define REGION_WIDTH (1 << REGION_WIDTH_SHIFT)
+	#define REGION_WIDTH_SHIFT 5
+	#define REGION_WORKER_INIT 2
+
+	namespace engine {
+
+		namespace region {
+
+			glm::ivec3 coordinate(
+				__in const glm::ivec3 &chunk
+				);
+
+			uint32_t index(
+				__in const glm::ivec3 &chunk
+				);
+
+			typedef struct {
+				gaea::engine::chunk::base chunk;
+				glm::ivec3 coordinate;
+				bool found;
+			} result_t;
+
+			/*
+			 * A region file holds one layer of REGION_WIDTH x REGION_WIDTH chunks.
+			 * Records are rewritten in place when they still fit, otherwise moved
+			 * to the first free run of sectors (or appended).
+			 */
+			typedef class _base {
+
+				public:
+
+					_base(
+						__in const std::string &path
+						);
+
+					virtual ~_base(void);
+
+					off_t allocate(
+						__in uint32_t index,
+						__in size_t length
+						);
+
+					static std::string as_string(
+						__in const _base &object,
+						__in_opt bool verbose = false
+						);
+
+					bool contains(
+						__in uint32_t index
+						);
+
+					static void decode(
+						__in const std::vector<uint8_t> &record,
+						__out gaea::engine::chunk::base &chunk
+						);
+
+					static void encode(
+						__in const gaea::engine::chunk::base &chunk,
+						__out std::vector<uint8_t> &record
+						);
+
+					uint32_t entry(
+						__in uint32_t index
+						);
+
+					int file(void);
+
+					bool locate(
+						__in uint32_t index,
+						__out off_t &offset,
+						__out size_t &length
+						);
+
+					const std::string &path(void);
+
+					bool read(
+						__in const glm::ivec3 &coordinate,
+						__out gaea::engine::chunk::base &chunk
+						);
+
+					size_t size(void);
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void write(
+						__in const glm::ivec3 &coordinate,
+						__in const gaea::engine::chunk::base &chunk
+						);
+
+				protected:
+
+					_base(
+						__in const _base &other
+						);
+
+					_base &operator=(
+						__in const _base &other
+						);
+
+					void close(void);
+
+					void open(void);
+
+					int m_file;
+
+					std::recursive_mutex m_lock;
+
+					std::string m_path;
+
+					uint32_t m_table[REGION_AREA];
+
+					std::vector<bool> m_used;
+
+			} base;
+
+			/*
+			 * Loads and saves are queued and serviced off the calling thread, so
+			 * neither ever waits on the disk. Loads of chunks with a save still in
+			 * flight are answered from memory.
+			 */
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					void collect(
+						__out std::vector<gaea::engine::region::result_t> &result
+						);
+
+					void initialize(
+						__in_opt const std::string &path = REGION_PATH_INIT,
+						__in_opt size_t workers = REGION_WORKER_INIT
+						);
+
+					static bool is_allocated(void);
+
+					bool is_initialized(void);
+
+					void load(
+						__in const glm::ivec3 &coordinate
+						);
+
+					size_t loaded(void);
+
+					size_t pending(void);
+
+					void save(
+						__in const glm::ivec3 &coordinate,
+						__in const gaea::engine::chunk::base &chunk
+						);
+
+					size_t saved(void);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void uninitialize(void);
+
+				protected:
+
+					typedef struct {
+						glm::ivec3 coordinate;
+						bool write;
+					} job_t;
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					static void _thread(void);
+
+					void clear(void);
+
+					void complete(
+						__in const job_t &job,
+						__in bool found,
+						__in const gaea::engine::chunk::base &chunk,
+						__in uint64_t sequence
+						);
+
+					gaea::engine::region::base &find(
+						__in const glm::ivec3 &coordinate
+						);
+
+					void process(
+						__in const std::vector<job_t> &job,
+						__in const std::vector<std::pair<uint64_t, gaea::engine::chunk::base>> &chunk
+						);
+
+					void take(
+						__out std::vector<job_t> &job,
+						__out std::vector<std::pair<uint64_t, gaea::engine::chunk::base>> &chunk,
+						__in size_t count
+						);
+
+					std::condition_variable m_condition;
+
+					bool m_initialized;
+
+					static _manager *m_instance;
+
+					std::deque<job_t> m_job;
+
+					size_t m_loaded;
+
+					std::mutex m_lock;
+
+					std::string m_path;
+
+					std::unordered_set<glm::ivec3, gaea::engine::chunk::hash_t> m_read;
+
+					std::unordered_map<glm::ivec3, gaea::engine::region::base *, gaea::engine::chunk::hash_t> m_region;
+
+					std::mutex m_region_lock;
+
+					std::vector<gaea::engine::region::result_t> m_result;
+
+					size_t m_saved;
+
+					uint64_t m_sequence;
+
+					bool m_uring;
+
+					std::vector<std::thread> m_worker;
+
+					std::unordered_map<glm::ivec3, std::pair<uint64_t, gaea::engine::chunk::base>,
+						gaea::engine::chunk::hash_t> m_write;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_REGION_H_
@@ -0,0 +1,157 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_REPLAY_H_
+#define GAEA_REPLAY_H_
+
+namespace gaea {
+
+	#define REPLAY_PATH_INIT "./replay.grp"
+
+	namespace engine {
+
+		namespace replay {
+
+			typedef void (*input_cb)(
+				__in uint32_t specifier,
+				__in void *context,
+				__in size_t length
+				);
+
+			/*
+			 * Input events are recorded with the frame they were polled on, plus a
+			 * microsecond offset for inspection. Playback hands each event back to
+			 * the given handler, or to event::notify, on the same frame it was
+			 * recorded. Replays are exact
+			 * only in headless mode, where every frame advances one tick.
+			 */
+			typedef class _player {
+
+				public:
+
+					_player(void);
+
+					virtual ~_player(void);
+
+					static std::string as_string(
+						__in const _player &object,
+						__in_opt bool verbose = false
+						);
+
+					void close(void);
+
+					bool is_finished(void);
+
+					bool is_open(void);
+
+					void open(
+						__in const std::string &path
+						);
+
+					size_t play(
+						__in uint32_t frame,
+						__in_opt gaea::engine::replay::input_cb handler = nullptr
+						);
+
+					size_t size(void);
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+				protected:
+
+					_player(
+						__in const _player &other
+						);
+
+					_player &operator=(
+						__in const _player &other
+						);
+
+					size_t m_count;
+
+					std::vector<uint8_t> m_data;
+
+					size_t m_offset;
+
+					std::string m_path;
+
+					size_t m_played;
+
+			} player;
+
+			typedef class _recorder {
+
+				public:
+
+					_recorder(void);
+
+					virtual ~_recorder(void);
+
+					static std::string as_string(
+						__in const _recorder &object,
+						__in_opt bool verbose = false
+						);
+
+					void close(void);
+
+					bool is_open(void);
+
+					void open(
+						__in const std::string &path
+						);
+
+					void record(
+						__in uint32_t frame,
+						__in uint32_t specifier,
+						__in const void *context,
+						__in size_t length
+						);
+
+					size_t size(void);
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+				protected:
+
+					_recorder(
+						__in const _recorder &other
+						);
+
+					_recorder &operator=(
+						__in const _recorder &other
+						);
+
+					uint64_t m_begin;
+
+					size_t m_count;
+
+					std::ofstream m_file;
+
+					std::string m_path;
+
+			} recorder;
+		}
+	}
+}
+
+#endif // GAEA_REPLAY_H_
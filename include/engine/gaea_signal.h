@@ -22,10 +22,20 @@
 
 namespace gaea {
 
+	#define SIGNAL_SPIN_INIT 64
+
 	namespace engine {
 
 		namespace signal {
 
+			/*
+			 * Auto-reset signal. A single state word holds the notified flag and the
+			 * number of parked waiters. On multi-core hosts waiters spin briefly
+			 * before parking on a futex, and notify only issues a wake syscall when
+			 * the flag was clear and somebody is parked. Notifications that arrive
+			 * before a waiter consumes the flag coalesce, and each one wakes at most
+			 * one waiter.
+			 */
 			typedef class _base {
 
 				public:
@@ -61,13 +71,22 @@ namespace gaea {
 
 					void wait(void);
 
+					bool wait_for(
+						__in uint64_t timeout
+						);
+
+					uint32_t waiting(void);
+
 				protected:
 
-					std::condition_variable m_condition;
+					bool consume(void);
 
-					std::mutex m_mutex;
+					bool park(
+						__in bool timed,
+						__in_opt uint64_t timeout = 0
+						);
 
-					bool m_notified;
+					std::atomic<uint32_t> m_state;
 
 			} base;
 		}
@@ -0,0 +1,124 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_STREAM_H_
+#define GAEA_STREAM_H_
+
+namespace gaea {
+
+	#define STREAM_EVICT_MAX 64
+	#define STREAM_HYSTERESIS_INIT 2
+	#define STREAM_MEMORY_INIT (256 * BYTES_PER_KBYTE * BYTES_PER_KBYTE)
+
+	namespace engine {
+
+		namespace stream {
+
+			/*
+			 * Chunks inside the terrain radius are always kept. Chunks past the
+			 * hysteresis ring are evicted; chunks in between are kept until the
+			 * memory cap, counting their meshes, is exceeded, then evicted
+			 * least-recently-seen first. A cap that eviction cannot meet is only
+			 * swept again once the footprint changes.
+			 * Evicted chunks, and every resident chunk at uninitialize, are saved
+			 * through the region manager when it is initialized.
+			 */
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					size_t evicted(void);
+
+					void initialize(
+						__in_opt int32_t hysteresis = STREAM_HYSTERESIS_INIT,
+						__in_opt size_t memory = STREAM_MEMORY_INIT
+						);
+
+					static bool is_allocated(void);
+
+					bool is_initialized(void);
+
+					size_t memory(void);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void uninitialize(void);
+
+					void update(
+						__in const glm::dvec3 &position
+						);
+
+				protected:
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					void clear(void);
+
+					void evict(
+						__in const glm::ivec3 &coordinate
+						);
+
+					void sweep(void);
+
+					void touch(void);
+
+					std::unordered_map<glm::ivec3, uint64_t, gaea::engine::chunk::hash_t> m_access;
+
+					std::vector<glm::ivec3> m_evict;
+
+					size_t m_evicted;
+
+					glm::ivec3 m_focus;
+
+					bool m_focused;
+
+					size_t m_footprint;
+
+					int32_t m_hysteresis;
+
+					bool m_initialized;
+
+					static _manager *m_instance;
+
+					size_t m_memory;
+
+					uint64_t m_tick;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_STREAM_H_
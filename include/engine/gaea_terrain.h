@@ -0,0 +1,230 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_TERRAIN_H_
+#define GAEA_TERRAIN_H_
+
+namespace gaea {
+
+	#define BIOME_MAX BIOME_SNOW
+
+	#define BLOCK_DIRT 2
+	#define BLOCK_GRASS 3
+	#define BLOCK_SAND 4
+	#define BLOCK_SNOW 5
+	#define BLOCK_STONE 1
+	#define BLOCK_WATER 6
+
+	#define TERRAIN_CHUNK_BOTTOM -2
+	#define TERRAIN_CHUNK_TOP 5
+	#define TERRAIN_COMMIT_INIT 64
+	#define TERRAIN_RADIUS_INIT 8
+	#define TERRAIN_SEA_LEVEL 0
+	#define TERRAIN_SEED_INIT 0
+	#define TERRAIN_WORKER_INIT 2
+
+	typedef enum {
+		BIOME_OCEAN = 0,
+		BIOME_BEACH,
+		BIOME_PLAINS,
+		BIOME_FOREST,
+		BIOME_DESERT,
+		BIOME_MOUNTAIN,
+		BIOME_SNOW,
+	} biome_t;
+
+	namespace engine {
+
+		namespace terrain {
+
+			/*
+			 * Chunk contents depend only on the seed and chunk coordinate, so the
+			 * output is identical regardless of which worker generates a chunk.
+			 */
+			typedef class _base {
+
+				public:
+
+					_base(
+						__in_opt uint64_t seed = TERRAIN_SEED_INIT
+						);
+
+					_base(
+						__in const _base &other
+						);
+
+					virtual ~_base(void);
+
+					_base &operator=(
+						__in const _base &other
+						);
+
+					static std::string as_string(
+						__in const _base &object,
+						__in_opt bool verbose = false
+						);
+
+					gaea::biome_t biome(
+						__in int32_t x,
+						__in int32_t z
+						) const;
+
+					void generate(
+						__in const glm::ivec3 &coordinate,
+						__out gaea::engine::chunk::base &chunk
+						) const;
+
+					int32_t height(
+						__in int32_t x,
+						__in int32_t z
+						) const;
+
+					uint64_t seed(void) const;
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+				protected:
+
+					void column(
+						__in const int32_t x[NOISE_LANE],
+						__in const int32_t z[NOISE_LANE],
+						__out int32_t height[NOISE_LANE],
+						__out gaea::biome_t biome[NOISE_LANE]
+						) const;
+
+					gaea::engine::noise::base m_cave;
+
+					gaea::engine::noise::base m_height;
+
+					gaea::engine::noise::base m_humidity;
+
+					uint64_t m_seed;
+
+					gaea::engine::noise::base m_temperature;
+
+			} base;
+
+			/*
+			 * Missing chunks are requested from the region manager first, when it
+			 * is initialized, and only generated if they were never saved.
+			 */
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					size_t generated(void);
+
+					void initialize(
+						__in_opt uint64_t seed = TERRAIN_SEED_INIT,
+						__in_opt size_t workers = TERRAIN_WORKER_INIT,
+						__in_opt int32_t radius = TERRAIN_RADIUS_INIT
+						);
+
+					static bool is_allocated(void);
+
+					bool is_initialized(void);
+
+					size_t pending(void);
+
+					int32_t radius(void);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void uninitialize(void);
+
+					void update(
+						__in const glm::dvec3 &position,
+						__in_opt size_t commit = TERRAIN_COMMIT_INIT
+						);
+
+				protected:
+
+					typedef struct _distance_t {
+
+						_distance_t(
+							__in const glm::ivec3 &focus
+							);
+
+						bool operator()(
+							__in const glm::ivec3 &left,
+							__in const glm::ivec3 &right
+							) const;
+
+						glm::ivec3 m_focus;
+
+					} distance_t;
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					static void _thread(void);
+
+					void clear(void);
+
+					void schedule(void);
+
+					std::condition_variable m_condition;
+
+					glm::ivec3 m_focus;
+
+					bool m_focused;
+
+					size_t m_generated;
+
+					gaea::engine::terrain::base m_generator;
+
+					bool m_initialized;
+
+					static _manager *m_instance;
+
+					std::vector<glm::ivec3> m_job;
+
+					std::mutex m_lock;
+
+					int32_t m_radius;
+
+					std::unordered_set<glm::ivec3, gaea::engine::chunk::hash_t> m_request;
+
+					std::vector<std::pair<glm::ivec3, gaea::engine::chunk::base>> m_result;
+
+					std::vector<std::thread> m_worker;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_TERRAIN_H_
@@ -145,11 +145,11 @@ namespace gaea {
 
 					void clear(void);
 
-					std::map<gaea::uid_t, size_t>::iterator find(
+					gaea::engine::pool::map<gaea::uid_t, size_t>::iterator find(
 						__in gaea::uid_t &id
 						);
 
-					std::map<gaea::uid_t, size_t> m_entry;
+					gaea::engine::pool::map<gaea::uid_t, size_t> m_entry;
 
 					bool m_initialized;
 
@@ -157,7 +157,7 @@ namespace gaea {
 
 					gaea::uid_t m_next;
 
-					std::set<gaea::uid_t> m_surplus;
+					gaea::engine::pool::set<gaea::uid_t> m_surplus;
 
 			} manager;
 		}
@@ -0,0 +1,127 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_WORLD_H_
+#define GAEA_WORLD_H_
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace world {
+
+			typedef class _manager {
+
+				public:
+
+					~_manager(void);
+
+					static _manager &acquire(void);
+
+					gaea::block_t block(
+						__in const glm::ivec3 &position
+						);
+
+					gaea::engine::chunk::base &chunk(
+						__in const glm::ivec3 &coordinate
+						);
+
+					bool contains(
+						__in const glm::ivec3 &coordinate
+						);
+
+					std::vector<glm::ivec3> coordinates(void);
+
+					std::vector<glm::ivec3> dirty(void);
+
+					void erase(
+						__in const glm::ivec3 &coordinate
+						);
+
+					gaea::engine::chunk::base *find(
+						__in const glm::ivec3 &coordinate
+						);
+
+					void initialize(void);
+
+					gaea::engine::chunk::base &insert(
+						__in const glm::ivec3 &coordinate,
+						__in_opt gaea::block_t block = BLOCK_AIR
+						);
+
+					static bool is_allocated(void);
+
+					bool is_initialized(void);
+
+					std::recursive_mutex &lock(void);
+
+					size_t memory(void);
+
+					void set_block(
+						__in const glm::ivec3 &position,
+						__in gaea::block_t block
+						);
+
+					void set_chunk(
+						__in const glm::ivec3 &coordinate,
+						__in const gaea::engine::chunk::base &chunk
+						);
+
+					size_t size(void);
+
+					std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+					void uninitialize(void);
+
+				protected:
+
+					_manager(void);
+
+					_manager(
+						__in const _manager &other
+						);
+
+					_manager &operator=(
+						__in const _manager &other
+						);
+
+					static void _delete(void);
+
+					void clear(void);
+
+					void set_dirty(
+						__in const glm::ivec3 &coordinate
+						);
+
+					std::unordered_map<glm::ivec3, gaea::engine::chunk::base, gaea::engine::chunk::hash_t> m_entry;
+
+					bool m_initialized;
+
+					static _manager *m_instance;
+
+					std::recursive_mutex m_lock;
+
+			} manager;
+		}
+	}
+}
+
+#endif // GAEA_WORLD_H_
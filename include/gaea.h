@@ -22,11 +22,24 @@
 
 #include "gaea_define.h"
 #include "gaea_exception.h"
+#include "engine/gaea_arena.h"
+#include "engine/gaea_pool.h"
 #include "engine/gaea_uid.h"
+#include "engine/gaea_archive.h"
 #include "engine/gaea_signal.h"
 #include "engine/gaea_object.h"
 #include "engine/gaea_event.h"
+#include "engine/gaea_channel.h"
 #include "engine/gaea_observer.h"
+#include "engine/gaea_action.h"
+#include "engine/gaea_replay.h"
+#include "engine/gaea_chunk.h"
+#include "engine/gaea_world.h"
+#include "engine/gaea_region.h"
+#include "engine/gaea_ray.h"
+#include "engine/gaea_occlusion.h"
+#include "engine/gaea_noise.h"
+#include "engine/gaea_terrain.h"
 #include "graphics/gaea_gl.h"
 #include "graphics/gaea_vbo.h"
 #include "graphics/gaea_vao.h"
@@ -34,15 +47,35 @@
 #include "graphics/gaea_program.h"
 #include "graphics/gaea_texture.h"
 #include "graphics/gaea_cubemap.h"
+#include "graphics/gaea_query.h"
 #include "engine/gaea_entity.h"
+#include "engine/gaea_frame.h"
 #include "engine/gaea_camera.h"
 #include "engine/gaea_model.h"
+#include "engine/gaea_mesh.h"
+#include "engine/gaea_stream.h"
+#include "engine/gaea_profile.h"
 
 namespace gaea {
 
 	#define FULLSCREEN_INIT false
+	#define HEADLESS_FRAMES_INIT 600
+	#define HEADLESS_INIT false
+	#define PACING_INIT PACING_VSYNC
+	#define PACING_MAX PACING_UNCAPPED
+	#define PACING_RATE_INIT 60
+	#define PATH_STEP_INIT 60
+	#define PIPELINE_INIT false
 	#define TICK_INIT 0
 	#define TICK_INVALID SCALAR_INVALID(gaea::tick_t)
+	#define TICK_RATE_INIT 60
+
+	typedef enum {
+		PACING_VSYNC = 0,
+		PACING_VSYNC_ADAPTIVE,
+		PACING_TARGET,
+		PACING_UNCAPPED,
+	} pacing_t;
 
 	typedef uint32_t tick_t;
 
@@ -50,6 +83,26 @@ namespace gaea {
 		__in_opt bool verbose = false
 		);
 
+	/*
+	 * The simulation advances in fixed steps of 1/TICK_RATE seconds, taken from
+	 * an accumulator of real time. Rendering interpolates entities by the
+	 * fraction of a step left over. Frames are paced by vsync, adaptive vsync,
+	 * a target rate, or not at all.
+	 *
+	 * When pipelined, the simulation runs on its own thread and publishes each
+	 * step as a frame packet. The main thread owns the GL context, handles
+	 * input, meshing and streaming, and draws the newest packet. Rendering reads
+	 * only packet transforms and per-frame state, and the camera locks the
+	 * state it shares with the input threads. Pipelining stays off by default.
+	 *
+	 * When headless, there is no window. An EGL context renders into an
+	 * offscreen framebuffer. Each frame advances exactly one step and draws that
+	 * step's state at alpha 1, so a camera path replays identically on any
+	 * host. Frame statistics print at teardown.
+	 *
+	 * Live input can be recorded to a file, or replaced by a recorded file
+	 * that is fed back through the same event path, frame by frame.
+	 */
 	typedef class _manager {
 
 		public:
@@ -62,10 +115,47 @@ namespace gaea {
 
 			static bool is_allocated(void);
 
+			bool is_headless(void);
+
 			bool is_initialized(void);
 
+			bool is_pipelined(void);
+
 			bool is_started(void);
 
+			gaea::pacing_t pacing(void);
+
+			void set_headless(
+				__in bool value,
+				__in_opt uint32_t frames = HEADLESS_FRAMES_INIT
+				);
+
+			void set_pacing(
+				__in gaea::pacing_t pacing,
+				__in_opt uint32_t rate = PACING_RATE_INIT
+				);
+
+			void set_path(
+				__in const std::vector<gaea::engine::entity::transform_t> &path,
+				__in_opt uint32_t step = PATH_STEP_INIT
+				);
+
+			void set_pipelined(
+				__in bool value
+				);
+
+			void set_record(
+				__in const std::string &path
+				);
+
+			void set_replay(
+				__in const std::string &path
+				);
+
+			void set_tick_rate(
+				__in uint32_t rate
+				);
+
 			void start(
 				__in const std::string &title,
 				__in const glm::uvec2 &dimensions,
@@ -100,8 +190,50 @@ namespace gaea {
 
 			static void _delete(void);
 
+			static void _input(
+				__in uint32_t specifier,
+				__in void *context,
+				__in size_t length
+				);
+
+			static void _thread(void);
+
+			void capture(
+				__in uint64_t step
+				);
+
+			void dispatch(
+				__in uint32_t specifier,
+				__in void *context,
+				__in size_t length
+				);
+
+			void follow(void);
+
+			void input(
+				__in uint32_t specifier,
+				__in void *context,
+				__in size_t length
+				);
+
+			void pace(
+				__in uint64_t begin
+				);
+
+			void prepare(
+				__in const glm::dvec3 &position,
+				__in const glm::mat4 &transform
+				);
+
+			void present(
+				__in uint64_t now,
+				__in_opt bool current = false
+				);
+
 			void render(
-				__in gaea::engine::camera::base &camera
+				__in const gaea::engine::entity::transform_t &camera,
+				__in const glm::mat4 &projection,
+				__in const glm::mat4 &view
 				);
 
 			void setup(
@@ -114,34 +246,126 @@ namespace gaea {
 				__in_opt gaea::tick_t tick = TICK_INIT
 				);
 
+			void setup_framebuffer(
+				__in const glm::uvec2 &dimensions
+				);
+
+			void setup_headless(void);
+
+			void setup_window(
+				__in const std::string &title,
+				__in const glm::uvec2 &dimensions,
+				__in bool fullscreen
+				);
+
+			uint32_t simulate(
+				__in uint64_t now
+				);
+
+			void swap_interval(void);
+
 			void teardown(void);
 
+			void teardown_headless(void);
+
+			void teardown_window(void);
+
 			void update(
 				__in GLfloat delta
 				);
 
+			gaea::engine::action::manager &m_action_manager;
+
+			gaea::engine::archive::manager &m_archive_manager;
+
+			gaea::engine::arena::manager &m_arena_manager;
+
 			gaea::engine::camera::manager &m_camera_manager;
 
+			std::condition_variable m_condition;
+
+			EGLContext m_context;
+
+			EGLDisplay m_display;
+
 			gaea::engine::entity::manager &m_entity_manager;
 
 			gaea::engine::event::manager &m_event_manager;
 
+			gaea::engine::frame::buffer m_frame;
+
+			uint32_t m_frame_count;
+
+			GLuint m_framebuffer;
+
+			GLuint m_framebuffer_color;
+
+			GLuint m_framebuffer_depth;
+
 			gaea::graphics::manager &m_gfx_manager;
 
+			bool m_headless;
+
+			uint32_t m_headless_frames;
+
 			bool m_initialized;
 
 			static _manager *m_instance;
 
+			std::mutex m_lock;
+
+			gaea::engine::mesh::manager &m_mesh_manager;
+
+			gaea::engine::occlusion::manager &m_occlusion_manager;
+
+			gaea::pacing_t m_pacing;
+
+			uint32_t m_pacing_rate;
+
+			std::vector<gaea::engine::entity::transform_t> m_path;
+
+			uint32_t m_path_step;
+
+			bool m_pipelined;
+
+			gaea::engine::replay::player m_player;
+
+			gaea::engine::profile::manager &m_profile_manager;
+
+			std::string m_record_path;
+
+			gaea::engine::replay::recorder m_recorder;
+
+			gaea::engine::region::manager &m_region_manager;
+
+			std::string m_replay_path;
+
+			bool m_simulating;
+
+			std::thread m_simulation;
+
 			bool m_started;
 
+			gaea::engine::stream::manager &m_stream_manager;
+
+			EGLSurface m_surface;
+
+			gaea::engine::terrain::manager &m_terrain_manager;
+
 			gaea::tick_t m_tick; 
 
+			uint32_t m_tick_rate;
+
+			uint64_t m_time;
+
 			gaea::engine::uid::manager &m_uid_manager;
 
 			SDL_Window *m_window;
 
 			SDL_GLContext m_window_context;
 
+			gaea::engine::world::manager &m_world_manager;
+
 	} manager;
 }
 
@@ -22,6 +22,7 @@
 
 namespace gaea {
 
+	#define GL_FREE_MAX 256
 	#define GL_HANDLE_INVALID 0
 	#define GL_INVALID SCALAR_INVALID(gaea::gl_t)
 	#define GL_OBJECT_MAX GL_OBJECT_VBO
@@ -30,6 +31,7 @@ namespace gaea {
 	typedef enum {
 		GL_OBJECT_CUBEMAP = 0,
 		GL_OBJECT_PROGRAM,
+		GL_OBJECT_QUERY,
 		GL_OBJECT_SHADER,
 		GL_OBJECT_TEXTURE,
 		GL_OBJECT_VAO,
@@ -126,6 +128,10 @@ namespace gaea {
 
 				bool is_initialized(void);
 
+				size_t recycled(
+					__in gaea::gl_t type
+					);
+
 				size_t reference_count(
 					__in gaea::uid_t &id,
 					__in gaea::gl_t type
@@ -165,15 +171,21 @@ namespace gaea {
 					);
 
 				void destroy(
-					__in const std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator &entry
+					__in const gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator &entry
 					);
 
-				std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator find(
+				gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator find(
 					__in gaea::uid_t &id,
 					__in gaea::gl_t type
 					);
 
-				std::vector<std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>> m_entry;
+				bool recycle(
+					__in const gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator &entry
+					);
+
+				std::vector<gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>> m_entry;
+
+				std::vector<std::vector<GLuint>> m_free;
 
 				bool m_initialized;
 
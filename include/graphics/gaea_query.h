@@ -0,0 +1,78 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_QUERY_H_
+#define GAEA_QUERY_H_
+
+namespace gaea {
+
+	#define QUERY_TARGET_INIT GL_ANY_SAMPLES_PASSED
+
+	namespace graphics {
+
+		namespace query {
+
+			typedef class _base :
+					public gaea::graphics::base {
+
+				public:
+
+					_base(
+						__in_opt GLenum target = QUERY_TARGET_INIT
+						);
+
+					_base(
+						__in const _base &other
+						);
+
+					virtual ~_base(void);
+
+					_base &operator=(
+						__in const _base &other
+						);
+
+					static std::string as_string(
+						__in const _base &object,
+						__in_opt bool verbose = false
+						);
+
+					bool is_available(void);
+
+					bool is_issued(void);
+
+					GLuint result(void);
+
+					void start(void);
+
+					void stop(void);
+
+					virtual std::string to_string(
+						__in_opt bool verbose = false
+						);
+
+				protected:
+
+					bool m_issued;
+
+			} base;
+		}
+	}
+}
+
+#endif // GAEA_QUERY_H_
@@ -72,6 +72,23 @@ namespace gaea {
 						__in GLenum usage
 						);
 
+					void set_attribute(
+						__in GLuint index,
+						__in GLint element_size,
+						__in GLenum element_type,
+						__in_opt GLboolean normalized = VAO_NORMALIZED_INIT,
+						__in_opt GLsizei stride = VAO_STRIDE_INIT,
+						__in_opt const GLvoid *pointer = VAO_POINTER_INIT
+						);
+
+					void set_attribute_integer(
+						__in GLuint index,
+						__in GLint element_size,
+						__in GLenum element_type,
+						__in_opt GLsizei stride = VAO_STRIDE_INIT,
+						__in_opt const GLvoid *pointer = VAO_POINTER_INIT
+						);
+
 					void start(void);
 
 					void stop(void);
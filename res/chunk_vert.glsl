@@ -0,0 +1,45 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#version 330 core
+
+layout(location = 0) in uint in_position;
+layout(location = 1) in uint in_layer;
+
+out vec3 out_color;
+
+uniform mat4 model;
+uniform mat4 projection;
+uniform mat4 view;
+
+const float FACE_SHADE[6] = float[](0.8f, 0.8f, 0.6f, 1.f, 0.9f, 0.9f);
+
+void 
+main(void)
+{
+	uint face = (in_position >> 18u) & 0x7u;
+	float ao = float((in_position >> 21u) & 0x3u) / 3.f;
+	vec3 position = vec3(float(in_position & 0x3fu), float((in_position >> 6u) & 0x3fu),
+		float((in_position >> 12u) & 0x3fu));
+	vec3 color = vec3(float((in_layer * 73u) & 0xffu), float((in_layer * 151u) & 0xffu),
+		float((in_layer * 199u) & 0xffu)) / 255.f;
+
+	out_color = color * FACE_SHADE[face] * mix(0.5f, 1.f, ao);
+	gl_Position = projection * view * model * vec4(position, 1.f);
+}
@@ -0,0 +1,774 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "../../include/gaea.h"
+#include "gaea_action_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace action {
+
+			#define ACTION_COMMENT '#'
+			#define ACTION_THRESHOLD 0.5f
+
+			#define ACTION_STRING(_TYPE_) \
+				((_TYPE_) > ACTION_MAX ? STRING_UNKNOWN : \
+				STRING_CHECK(ACTION_STR[_TYPE_]))
+
+			#define AXIS_STRING(_TYPE_) \
+				((_TYPE_) > AXIS_MAX ? STRING_UNKNOWN : \
+				STRING_CHECK(AXIS_STR[_TYPE_]))
+
+			static const std::string ACTION_STR[] = {
+				"BACKWARD", "FORWARD", "LEFT", "RIGHT", "ASCEND", "DESCEND",
+				};
+
+			static const std::string AXIS_STR[] = {
+				"LOOK_X", "LOOK_Y", "MOVE_X", "MOVE_Y",
+				};
+
+			static const std::string MOUSE_STR[] = {
+				"LEFT", "MIDDLE", "RIGHT", "X1", "X2",
+				};
+
+			static size_t 
+			lookup(
+				__in const std::string *entry,
+				__in size_t count,
+				__in const std::string &name
+				)
+			{
+				size_t result = 0;
+
+				for(; result < count; ++result) {
+
+					if(entry[result] == name) {
+						break;
+					}
+				}
+
+				return result;
+			}
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_dead_zone(ACTION_DEAD_ZONE_INIT),
+				m_initialized(false),
+				m_motion(glm::vec2()),
+				m_sensitivity(INPUT_SENSITIVITY_INIT),
+				m_speed(INPUT_SPEED_INIT),
+				m_wheel(0.f)
+			{
+				std::atexit(gaea::engine::action::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				uninitialize();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::action::manager::m_instance) {
+					delete gaea::engine::action::manager::m_instance;
+					gaea::engine::action::manager::m_instance = nullptr;
+				}
+			}
+
+			_manager & 
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::action::manager::m_instance) {
+
+					gaea::engine::action::manager::m_instance = new gaea::engine::action::manager;
+					if(!gaea::engine::action::manager::m_instance) {
+						THROW_GAEA_ACTION_EXCEPTION(GAEA_ACTION_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::action::manager::m_instance;
+			}
+
+			void 
+			_manager::attach(
+				__in int32_t index
+				)
+			{
+				SDL_JoystickID id;
+				SDL_GameController *controller = nullptr;
+
+				if(!m_initialized) {
+					THROW_GAEA_ACTION_EXCEPTION(GAEA_ACTION_EXCEPTION_UNINITIALIZED);
+				}
+
+				if(!SDL_IsGameController(index)) {
+					return;
+				}
+
+				controller = SDL_GameControllerOpen(index);
+				if(!controller) {
+					THROW_GAEA_ACTION_EXCEPTION_FORMAT(GAEA_ACTION_EXCEPTION_EXTERNAL, "SDL_GameControllerOpen failed: %s",
+						SDL_GetError());
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				id = SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(controller));
+				if(m_controller.find(id) != m_controller.end()) {
+					SDL_GameControllerClose(controller);
+				} else {
+					m_controller.insert(std::pair<SDL_JoystickID, SDL_GameController *>(id, controller));
+				}
+			}
+
+			bool 
+			_manager::bind(
+				__in const std::string &line,
+				__inout std::vector<std::vector<binding_t>> &action,
+				__inout std::vector<std::vector<binding_t>> &axis
+				)
+			{
+				size_t index;
+				GLfloat setting;
+				binding_t binding;
+				std::stringstream stream(line);
+				std::string code, name, other, source, type;
+
+				if(!(stream >> type)) {
+					return true;
+				}
+
+				if((type == "dead_zone") || (type == "sensitivity") || (type == "speed")) {
+
+					if(!(stream >> setting) || (stream >> name) || !std::isfinite(setting)) {
+						return false;
+					}
+
+					if(type == "dead_zone") {
+
+						if((setting < 0.f) || (setting >= 1.f)) {
+							return false;
+						}
+
+						m_dead_zone = setting;
+					} else if(setting <= 0.f) {
+
+						// a zero or negative scale would freeze or invert movement
+						return false;
+					} else if(type == "sensitivity") {
+						m_sensitivity = setting;
+					} else {
+						m_speed = setting;
+					}
+
+					return true;
+				}
+
+				if(!(stream >> name >> source >> code)) {
+					return false;
+				}
+
+				binding.code = 0;
+				binding.negative = 0;
+				binding.scale = 1.f;
+				std::replace(code.begin(), code.end(), '_', ' ');
+
+				if(source == "button") {
+					binding.source = SOURCE_CONTROLLER_BUTTON;
+					binding.code = SDL_GameControllerGetButtonFromString(code.c_str());
+					if((int32_t) binding.code == SDL_CONTROLLER_BUTTON_INVALID) {
+						return false;
+					}
+				} else if(source == "controller") {
+					binding.source = SOURCE_CONTROLLER_AXIS;
+					binding.code = SDL_GameControllerGetAxisFromString(code.c_str());
+					if((int32_t) binding.code == SDL_CONTROLLER_AXIS_INVALID) {
+						return false;
+					}
+				} else if(source == "key") {
+					binding.source = SOURCE_KEY;
+					binding.code = SDL_GetScancodeFromName(code.c_str());
+					if(binding.code == SDL_SCANCODE_UNKNOWN) {
+						return false;
+					}
+
+					// a second key makes a pair, the first pulling negative
+					if((type == "axis") && (stream >> other)) {
+						std::replace(other.begin(), other.end(), '_', ' ');
+						binding.negative = binding.code;
+						binding.code = SDL_GetScancodeFromName(other.c_str());
+						if(binding.code == SDL_SCANCODE_UNKNOWN) {
+							return false;
+						}
+
+						binding.source = SOURCE_KEY_PAIR;
+					}
+				} else if(source == "mouse") {
+
+					if(type == "axis") {
+
+						if(code == "x") {
+							binding.source = SOURCE_MOTION_X;
+						} else if(code == "y") {
+							binding.source = SOURCE_MOTION_Y;
+						} else if(code == "wheel") {
+							binding.source = SOURCE_WHEEL;
+						} else {
+							return false;
+						}
+					} else {
+						binding.source = SOURCE_BUTTON;
+						binding.code = lookup(MOUSE_STR, BUTTON_COUNT, code);
+						if(binding.code > BUTTON_MAX) {
+							return false;
+						}
+					}
+				} else {
+					return false;
+				}
+
+				if(stream >> binding.scale) {
+
+					if(stream >> other) {
+						return false;
+					}
+				} else if(!stream.eof()) {
+					return false;
+				}
+
+				if(type == "action") {
+
+					index = lookup(ACTION_STR, ACTION_COUNT, name);
+					if(index > ACTION_MAX) {
+						return false;
+					}
+
+					action.at(index).push_back(binding);
+				} else if(type == "axis") {
+
+					index = lookup(AXIS_STR, AXIS_COUNT, name);
+					if(index > AXIS_MAX) {
+						return false;
+					}
+
+					axis.at(index).push_back(binding);
+				} else {
+					return false;
+				}
+
+				return true;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+				std::map<SDL_JoystickID, SDL_GameController *>::iterator iter;
+
+				for(iter = m_controller.begin(); iter != m_controller.end(); ++iter) {
+					SDL_GameControllerClose(iter->second);
+				}
+
+				m_action.clear();
+				m_axis.clear();
+				m_controller.clear();
+				std::memset(&m_current, 0, sizeof(m_current));
+				m_dead_zone = ACTION_DEAD_ZONE_INIT;
+				m_live.clear();
+				m_motion = glm::vec2();
+				std::memset(&m_pressed, 0, sizeof(m_pressed));
+				m_sensitivity = INPUT_SENSITIVITY_INIT;
+				m_speed = INPUT_SPEED_INIT;
+				std::memset(&m_state, 0, sizeof(m_state));
+				m_wheel = 0.f;
+			}
+
+			GLfloat 
+			_manager::dead_zone(void)
+			{
+				return m_dead_zone;
+			}
+
+			void 
+			_manager::detach(
+				__in SDL_JoystickID id
+				)
+			{
+				std::map<SDL_JoystickID, SDL_GameController *>::iterator iter;
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				iter = m_controller.find(id);
+				if(iter != m_controller.end()) {
+					SDL_GameControllerClose(iter->second);
+					m_controller.erase(iter);
+				}
+
+				// controller state is shared, so a stale stick or button must not stay held
+				m_live.clear_controller();
+			}
+
+			void 
+			_manager::initialize(
+				__in_opt const std::map<gaea::key_t, SDL_Scancode> &key_map,
+				__in_opt GLfloat speed,
+				__in_opt GLfloat sensitivity
+				)
+			{
+				size_t iter = 0;
+				std::vector<SDL_Scancode> key(KEY_COUNT, SDL_SCANCODE_UNKNOWN);
+				std::map<gaea::key_t, SDL_Scancode>::const_iterator key_iter;
+
+				if(m_initialized) {
+					THROW_GAEA_ACTION_EXCEPTION(GAEA_ACTION_EXCEPTION_INITIALIZED);
+				}
+
+				if(!std::isfinite(speed) || (speed <= 0.f) || !std::isfinite(sensitivity) || (sensitivity <= 0.f)) {
+					THROW_GAEA_ACTION_EXCEPTION_FORMAT(GAEA_ACTION_EXCEPTION_INVALID, "Speed=%f, Sensitivity=%f",
+						speed, sensitivity);
+				}
+
+				for(; iter <= KEY_MAX; ++iter) {
+
+					key_iter = key_map.find((gaea::key_t) iter);
+					if(key_iter == key_map.end()) {
+						THROW_GAEA_ACTION_EXCEPTION_FORMAT(GAEA_ACTION_EXCEPTION_INVALID, "Key=%x", iter);
+					}
+
+					key.at(iter) = key_iter->second;
+				}
+
+				clear();
+				m_action.resize(ACTION_COUNT, std::vector<binding_t>());
+				m_axis.resize(AXIS_COUNT, std::vector<binding_t>());
+
+				for(iter = 0; iter <= KEY_MAX; ++iter) {
+					m_action.at(iter).push_back({ key.at(iter), 0, 1.f, SOURCE_KEY });
+				}
+
+				m_action.at(ACTION_ASCEND).push_back({ SDL_SCANCODE_SPACE, 0, 1.f, SOURCE_KEY });
+				m_action.at(ACTION_ASCEND).push_back({ SDL_CONTROLLER_BUTTON_A, 0, 1.f, SOURCE_CONTROLLER_BUTTON });
+				m_action.at(ACTION_DESCEND).push_back({ SDL_SCANCODE_LSHIFT, 0, 1.f, SOURCE_KEY });
+				m_action.at(ACTION_DESCEND).push_back({ SDL_CONTROLLER_BUTTON_B, 0, 1.f, SOURCE_CONTROLLER_BUTTON });
+				m_axis.at(AXIS_LOOK_X).push_back({ 0, 0, 1.f, SOURCE_MOTION_X });
+				m_axis.at(AXIS_LOOK_X).push_back({ SDL_CONTROLLER_AXIS_RIGHTX, 0, ACTION_LOOK_SCALE_INIT,
+					SOURCE_CONTROLLER_AXIS });
+				m_axis.at(AXIS_LOOK_Y).push_back({ 0, 0, 1.f, SOURCE_MOTION_Y });
+				m_axis.at(AXIS_LOOK_Y).push_back({ SDL_CONTROLLER_AXIS_RIGHTY, 0, ACTION_LOOK_SCALE_INIT,
+					SOURCE_CONTROLLER_AXIS });
+				m_axis.at(AXIS_MOVE_X).push_back({ key.at(KEY_RIGHT), key.at(KEY_LEFT), 1.f, SOURCE_KEY_PAIR });
+				m_axis.at(AXIS_MOVE_X).push_back({ SDL_CONTROLLER_AXIS_LEFTX, 0, 1.f, SOURCE_CONTROLLER_AXIS });
+				m_axis.at(AXIS_MOVE_Y).push_back({ key.at(KEY_FORWARD), key.at(KEY_BACKWARD), 1.f, SOURCE_KEY_PAIR });
+
+				// stick y grows downward
+				m_axis.at(AXIS_MOVE_Y).push_back({ SDL_CONTROLLER_AXIS_LEFTY, 0, -1.f, SOURCE_CONTROLLER_AXIS });
+
+				m_sensitivity = sensitivity;
+				m_speed = speed;
+				m_initialized = true;
+			}
+
+			void 
+			_manager::input(
+				__in uint32_t specifier,
+				__in const void *context,
+				__in size_t length
+				)
+			{
+				const SDL_KeyboardEvent *key = nullptr;
+				const SDL_MouseWheelEvent *wheel = nullptr;
+				const SDL_MouseButtonEvent *button = nullptr;
+				const SDL_MouseMotionEvent *motion = nullptr;
+				const SDL_ControllerAxisEvent *controller_axis = nullptr;
+				const SDL_ControllerButtonEvent *controller_button = nullptr;
+
+				if(!m_initialized) {
+					THROW_GAEA_ACTION_EXCEPTION(GAEA_ACTION_EXCEPTION_UNINITIALIZED);
+				}
+
+				switch(specifier) {
+					case EVENT_INPUT_BUTTON:
+
+						button = (const SDL_MouseButtonEvent *) context;
+						if(button && (length == sizeof(SDL_MouseButtonEvent))) {
+							m_live.on_button(*button);
+						}
+						break;
+					case EVENT_INPUT_CONTROLLER_AXIS:
+
+						controller_axis = (const SDL_ControllerAxisEvent *) context;
+						if(controller_axis && (length == sizeof(SDL_ControllerAxisEvent))) {
+							m_live.on_controller_axis(*controller_axis);
+						}
+						break;
+					case EVENT_INPUT_CONTROLLER_BUTTON:
+
+						controller_button = (const SDL_ControllerButtonEvent *) context;
+						if(controller_button && (length == sizeof(SDL_ControllerButtonEvent))) {
+							m_live.on_controller_button(*controller_button);
+						}
+						break;
+					case EVENT_INPUT_KEY:
+
+						key = (const SDL_KeyboardEvent *) context;
+						if(key && (length == sizeof(SDL_KeyboardEvent))) {
+							m_live.on_key(*key);
+						}
+						break;
+					case EVENT_INPUT_MOTION:
+
+						motion = (const SDL_MouseMotionEvent *) context;
+						if(motion && (length == sizeof(SDL_MouseMotionEvent))) {
+							m_live.on_motion(*motion);
+						}
+						break;
+					case EVENT_INPUT_WHEEL:
+
+						wheel = (const SDL_MouseWheelEvent *) context;
+						if(wheel && (length == sizeof(SDL_MouseWheelEvent))) {
+							m_live.on_wheel(*wheel);
+						}
+						break;
+					default:
+						THROW_GAEA_ACTION_EXCEPTION_FORMAT(GAEA_ACTION_EXCEPTION_INVALID, "Specifier=%x", specifier);
+				}
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::action::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_down(
+				__in const binding_t &binding
+				)
+			{
+				bool result = false;
+
+				switch(binding.source) {
+					case SOURCE_BUTTON:
+						result = ((m_current.button & INPUT_BIT(binding.code)) != 0);
+						break;
+					case SOURCE_CONTROLLER_AXIS:
+						result = (value(binding) > ACTION_THRESHOLD);
+						break;
+					case SOURCE_CONTROLLER_BUTTON:
+						result = ((m_current.controller_button & INPUT_BIT(binding.code)) != 0);
+						break;
+					case SOURCE_KEY:
+						result = INPUT_TEST(m_current.key, binding.code);
+						break;
+					default:
+						break;
+				}
+
+				return result;
+			}
+
+			bool 
+			_manager::is_initialized(void)
+			{
+				return m_initialized;
+			}
+
+			bool 
+			_manager::is_pressed(
+				__in const binding_t &binding
+				)
+			{
+				bool result = false;
+
+				switch(binding.source) {
+					case SOURCE_BUTTON:
+						result = ((m_pressed.button & INPUT_BIT(binding.code)) != 0);
+						break;
+					case SOURCE_CONTROLLER_BUTTON:
+						result = ((m_pressed.controller_button & INPUT_BIT(binding.code)) != 0);
+						break;
+					case SOURCE_KEY:
+						result = INPUT_TEST(m_pressed.key, binding.code);
+						break;
+					default:
+						break;
+				}
+
+				return result;
+			}
+
+			bool 
+			_manager::load(
+				__in const std::string &path,
+				__in_opt bool optional
+				)
+			{
+				size_t iter;
+				std::ifstream file;
+				uint32_t number = 0;
+				std::string line;
+				GLfloat dead_zone = m_dead_zone, sensitivity = m_sensitivity, speed = m_speed;
+				std::vector<std::vector<binding_t>> action(ACTION_COUNT, std::vector<binding_t>()),
+					axis(AXIS_COUNT, std::vector<binding_t>());
+
+				if(!m_initialized) {
+					THROW_GAEA_ACTION_EXCEPTION(GAEA_ACTION_EXCEPTION_UNINITIALIZED);
+				}
+
+				file = std::ifstream(path.c_str(), std::ios::in);
+				if(!file) {
+
+					if(optional) {
+						return false;
+					}
+
+					THROW_GAEA_ACTION_EXCEPTION_FORMAT(GAEA_ACTION_EXCEPTION_NOT_FOUND, "%s", STRING_CHECK(path));
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				while(std::getline(file, line)) {
+					++number;
+
+					iter = line.find(ACTION_COMMENT);
+					if(iter != std::string::npos) {
+						line.erase(iter);
+					}
+
+					if(!bind(line, action, axis)) {
+						m_dead_zone = dead_zone;
+						m_sensitivity = sensitivity;
+						m_speed = speed;
+						THROW_GAEA_ACTION_EXCEPTION_FORMAT(GAEA_ACTION_EXCEPTION_MALFORMED, "%s:%u: %s",
+							STRING_CHECK(path), number, STRING_CHECK(line));
+					}
+				}
+
+				// bindings from the file replace the defaults, per action and axis
+				for(iter = 0; iter <= ACTION_MAX; ++iter) {
+
+					if(!action.at(iter).empty()) {
+						m_action.at(iter) = action.at(iter);
+					}
+				}
+
+				for(iter = 0; iter <= AXIS_MAX; ++iter) {
+
+					if(!axis.at(iter).empty()) {
+						m_axis.at(iter) = axis.at(iter);
+					}
+				}
+
+				return true;
+			}
+
+			GLfloat 
+			_manager::sensitivity(void)
+			{
+				return m_sensitivity;
+			}
+
+			size_t 
+			_manager::size(void)
+			{
+				size_t iter = 0, result = 0;
+
+				for(; iter < m_action.size(); ++iter) {
+					result += m_action.at(iter).size();
+				}
+
+				for(iter = 0; iter < m_axis.size(); ++iter) {
+					result += m_axis.at(iter).size();
+				}
+
+				return result;
+			}
+
+			GLfloat 
+			_manager::speed(void)
+			{
+				return m_speed;
+			}
+
+			gaea::engine::action::state_t 
+			_manager::state(void)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_ACTION_EXCEPTION(GAEA_ACTION_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				return m_state;
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				size_t iter = 0;
+				std::stringstream result;
+
+				result << GAEA_ACTION_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
+
+				if(m_initialized) {
+					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+						<< ", BINDINGS=" << size()
+						<< ", CONTROLLERS=" << m_controller.size()
+						<< ", DEAD=" << m_dead_zone
+						<< ", FRAME=" << m_state.frame;
+
+					if(verbose) {
+						result << ", DOWN={";
+
+						for(; iter <= ACTION_MAX; ++iter) {
+
+							if(m_state.down & ACTION_BIT(iter)) {
+								result << " " << ACTION_STRING(iter);
+							}
+						}
+
+						result << " }, AXIS={";
+
+						for(iter = 0; iter <= AXIS_MAX; ++iter) {
+							result << (iter ? ", " : "") << AXIS_STRING(iter) << "=" << m_state.axis[iter];
+						}
+
+						result << "}";
+					}
+				}
+
+				return result.str();
+			}
+
+			void 
+			_manager::uninitialize(void)
+			{
+
+				if(m_initialized) {
+					m_initialized = false;
+					clear();
+				}
+			}
+
+			void 
+			_manager::update(void)
+			{
+				size_t iter = 0;
+				glm::ivec2 motion;
+				uint32_t down = 0, latched = 0, previous;
+				gaea::engine::observer::state_t released;
+				std::vector<binding_t>::iterator binding_iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_ACTION_EXCEPTION(GAEA_ACTION_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				// releases are derived from the held state, so only the latched presses are kept
+				m_live.latch(m_pressed, released);
+				m_live.snapshot(m_current);
+				motion = m_live.motion();
+				m_motion = glm::vec2(motion);
+				m_wheel = m_live.wheel();
+
+				for(; iter <= ACTION_MAX; ++iter) {
+
+					for(binding_iter = m_action.at(iter).begin(); binding_iter != m_action.at(iter).end();
+							++binding_iter) {
+
+						if(is_down(*binding_iter)) {
+							down |= ACTION_BIT(iter);
+						}
+
+						if(is_pressed(*binding_iter)) {
+							latched |= ACTION_BIT(iter);
+						}
+					}
+				}
+
+				// a press latched while the action was up counts as an edge, even if it was already released
+				previous = m_state.down;
+				m_state.down = down;
+				m_state.pressed = ((down | latched) & ~previous);
+				m_state.released = ((previous & ~down) | (latched & ~previous & ~down));
+
+				for(iter = 0; iter <= AXIS_MAX; ++iter) {
+					m_state.axis[iter] = 0.f;
+
+					for(binding_iter = m_axis.at(iter).begin(); binding_iter != m_axis.at(iter).end();
+							++binding_iter) {
+						m_state.axis[iter] += value(*binding_iter);
+					}
+				}
+
+				++m_state.frame;
+			}
+
+			GLfloat 
+			_manager::value(
+				__in const binding_t &binding
+				)
+			{
+				GLfloat result = 0.f;
+
+				switch(binding.source) {
+					case SOURCE_CONTROLLER_AXIS:
+						result = m_live.axis(binding.code);
+
+						if(std::fabs(result) <= m_dead_zone) {
+							result = 0.f;
+						} else {
+							result = (std::copysign(std::fabs(result) - m_dead_zone, result) / (1.f - m_dead_zone));
+						}
+						break;
+					case SOURCE_KEY_PAIR:
+						result = (INPUT_TEST(m_current.key, binding.code) ? 1.f : 0.f);
+						result -= (INPUT_TEST(m_current.key, binding.negative) ? 1.f : 0.f);
+						break;
+					case SOURCE_MOTION_X:
+						result = m_motion.x;
+						break;
+					case SOURCE_MOTION_Y:
+						result = m_motion.y;
+						break;
+					case SOURCE_WHEEL:
+						result = m_wheel;
+						break;
+					default:
+						result = (is_down(binding) ? 1.f : 0.f);
+						break;
+				}
+
+				return (result * binding.scale);
+			}
+		}
+	}
+}
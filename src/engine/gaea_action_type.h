@@ -0,0 +1,70 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_ACTION_TYPE_H_
+#define GAEA_ACTION_TYPE_H_
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace action {
+
+			#define GAEA_ACTION_HEADER "[GAEA::ENGINE::ACTION]"
+#ifndef NDEBUG
+			#define GAEA_ACTION_EXCEPTION_HEADER GAEA_ACTION_HEADER " "
+#else
+			#define GAEA_ACTION_EXCEPTION_HEADER
+#endif // NDEBUG
+
+			enum {
+				GAEA_ACTION_EXCEPTION_ALLOCATED = 0,
+				GAEA_ACTION_EXCEPTION_EXTERNAL,
+				GAEA_ACTION_EXCEPTION_INITIALIZED,
+				GAEA_ACTION_EXCEPTION_INVALID,
+				GAEA_ACTION_EXCEPTION_MALFORMED,
+				GAEA_ACTION_EXCEPTION_NOT_FOUND,
+				GAEA_ACTION_EXCEPTION_UNINITIALIZED,
+			};
+
+			#define GAEA_ACTION_EXCEPTION_MAX GAEA_ACTION_EXCEPTION_UNINITIALIZED
+
+			static const std::string GAEA_ACTION_EXCEPTION_STR[] = {
+				GAEA_ACTION_EXCEPTION_HEADER "Failed to allocate action manager",
+				GAEA_ACTION_EXCEPTION_HEADER "External exception",
+				GAEA_ACTION_EXCEPTION_HEADER "Action manager is initialized",
+				GAEA_ACTION_EXCEPTION_HEADER "Invalid action or axis type",
+				GAEA_ACTION_EXCEPTION_HEADER "Malformed input configuration",
+				GAEA_ACTION_EXCEPTION_HEADER "Input configuration does not exist",
+				GAEA_ACTION_EXCEPTION_HEADER "Action manager is uninitialized",
+				};
+
+			#define GAEA_ACTION_EXCEPTION_STRING(_TYPE_) \
+				((_TYPE_) > GAEA_ACTION_EXCEPTION_MAX ? GAEA_ACTION_EXCEPTION_HEADER EXCEPTION_UNKNOWN : \
+				STRING_CHECK(GAEA_ACTION_EXCEPTION_STR[_TYPE_]))
+
+			#define THROW_GAEA_ACTION_EXCEPTION(_EXCEPT_) \
+				THROW_EXCEPTION(GAEA_ACTION_EXCEPTION_STRING(_EXCEPT_))
+			#define THROW_GAEA_ACTION_EXCEPTION_FORMAT(_EXCEPT_, _FORMAT_, ...) \
+				THROW_EXCEPTION_FORMAT(GAEA_ACTION_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+		}
+	}
+}
+
+#endif // GAEA_ACTION_TYPE_H_
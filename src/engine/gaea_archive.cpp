@@ -0,0 +1,920 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <lz4.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zstd.h>
+#include "../../include/gaea.h"
+#include "gaea_archive_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace archive {
+
+			#define ARCHIVE_FILE_INVALID -1
+			#define ARCHIVE_HASH_OFFSET 0xcbf29ce484222325ULL
+			#define ARCHIVE_HASH_PRIME 0x100000001b3ULL
+			#define ARCHIVE_INDEX_ALIGNMENT sizeof(uint64_t)
+			#define ARCHIVE_NAME_PREFIX "./"
+			#define ARCHIVE_ZSTD_LEVEL 19
+
+			static const std::string ARCHIVE_COMPRESSION_STR[] = {
+				"NONE", "LZ4", "ZSTD",
+				};
+
+			#define ARCHIVE_COMPRESSION_STRING(_TYPE_) \
+				((_TYPE_) > ARCHIVE_COMPRESSION_MAX ? STRING_UNKNOWN : \
+				STRING_CHECK(ARCHIVE_COMPRESSION_STR[_TYPE_]))
+
+			static std::string 
+			normalize(
+				__in const std::string &name
+				)
+			{
+				size_t position = 0;
+
+				while(!name.compare(position, std::strlen(ARCHIVE_NAME_PREFIX), ARCHIVE_NAME_PREFIX)) {
+					position += std::strlen(ARCHIVE_NAME_PREFIX);
+				}
+
+				return name.substr(position);
+			}
+
+			static bool 
+			read_file(
+				__in const std::string &path,
+				__out std::vector<uint8_t> &data
+				)
+			{
+				std::ifstream file;
+				std::streamoff length;
+
+				data.clear();
+
+				file = std::ifstream(path.c_str(), std::ios::in | std::ios::binary);
+				if(!file) {
+					return false;
+				}
+
+				file.seekg(0, std::ios::end);
+				length = file.tellg();
+				file.seekg(0, std::ios::beg);
+
+				if(length > 0) {
+					data.resize(length, 0);
+					file.read((char *) &data[0], length);
+				}
+
+				file.close();
+
+				return (length >= 0);
+			}
+
+			void 
+			compress(
+				__in gaea::compression_t type,
+				__in const uint8_t *data,
+				__in size_t length,
+				__out std::vector<uint8_t> &output
+				)
+			{
+				int result;
+				size_t bound;
+
+				output.clear();
+
+				switch(type) {
+					case ARCHIVE_COMPRESSION_NONE:
+						output.insert(output.end(), data, data + length);
+						break;
+					case ARCHIVE_COMPRESSION_LZ4:
+						bound = LZ4_compressBound(length);
+						output.resize(bound, 0);
+
+						result = LZ4_compress_default((const char *) data, (char *) output.data(), length, bound);
+						if(result <= 0) {
+							THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_EXTERNAL,
+								"LZ4_compress_default failed: %i", result);
+						}
+
+						output.resize(result);
+						break;
+					case ARCHIVE_COMPRESSION_ZSTD:
+						bound = ZSTD_compressBound(length);
+						output.resize(bound, 0);
+
+						bound = ZSTD_compress(output.data(), bound, data, length, ARCHIVE_ZSTD_LEVEL);
+						if(ZSTD_isError(bound)) {
+							THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_EXTERNAL,
+								"ZSTD_compress failed: %s", ZSTD_getErrorName(bound));
+						}
+
+						output.resize(bound);
+						break;
+					default:
+						THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_INVALID,
+							"%x", type);
+				}
+			}
+
+			void 
+			decompress(
+				__in gaea::compression_t type,
+				__in const uint8_t *data,
+				__in size_t length,
+				__out std::vector<uint8_t> &output,
+				__in size_t output_length
+				)
+			{
+				int result;
+				size_t count;
+
+				output.clear();
+				output.resize(output_length, 0);
+
+				switch(type) {
+					case ARCHIVE_COMPRESSION_NONE:
+
+						if(length != output_length) {
+							THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_MALFORMED,
+								"Length mismatch: %zu (expecting %zu)", length, output_length);
+						}
+
+						output.assign(data, data + length);
+						break;
+					case ARCHIVE_COMPRESSION_LZ4:
+
+						result = LZ4_decompress_safe((const char *) data, (char *) output.data(), length,
+							output_length);
+						if((result < 0) || ((size_t) result != output_length)) {
+							THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_EXTERNAL,
+								"LZ4_decompress_safe failed: %i", result);
+						}
+						break;
+					case ARCHIVE_COMPRESSION_ZSTD:
+
+						count = ZSTD_decompress(output.data(), output_length, data, length);
+						if(ZSTD_isError(count) || (count != output_length)) {
+							THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_EXTERNAL,
+								"ZSTD_decompress failed: %s", ZSTD_isError(count) ? ZSTD_getErrorName(count)
+								: "Length mismatch");
+						}
+						break;
+					default:
+						THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_INVALID,
+							"%x", type);
+				}
+			}
+
+			uint64_t 
+			hash(
+				__in const std::string &name
+				)
+			{
+				uint64_t result = ARCHIVE_HASH_OFFSET;
+				std::string::const_iterator iter;
+				std::string normal = normalize(name);
+
+				for(iter = normal.begin(); iter != normal.end(); ++iter) {
+					result ^= (uint8_t) *iter;
+					result *= ARCHIVE_HASH_PRIME;
+				}
+
+				return result;
+			}
+
+			bool 
+			load(
+				__in const std::string &name,
+				__out std::vector<uint8_t> &data
+				)
+			{
+				bool result = false;
+
+				if(gaea::engine::archive::manager::is_allocated()) {
+
+					gaea::engine::archive::manager &instance = gaea::engine::archive::manager::acquire();
+					if(instance.is_initialized()) {
+						result = instance.load(name, data);
+					}
+				}
+
+				if(!result) {
+					result = read_file(name, data);
+				}
+
+				return result;
+			}
+
+			bool 
+			map(
+				__in const std::string &name,
+				__out std::shared_ptr<const uint8_t> &data,
+				__out size_t &length
+				)
+			{
+				bool result = false;
+
+				data.reset();
+				length = 0;
+
+				if(gaea::engine::archive::manager::is_allocated()) {
+
+					gaea::engine::archive::manager &instance = gaea::engine::archive::manager::acquire();
+					if(instance.is_initialized()) {
+						result = instance.map(name, data, length);
+					}
+				}
+
+				return result;
+			}
+
+			_base::_base(
+				__in const std::string &path
+				) :
+					m_count(0),
+					m_data(nullptr),
+					m_file(ARCHIVE_FILE_INVALID),
+					m_length(0),
+					m_path(path)
+			{
+				open();
+			}
+
+			_base::~_base(void)
+			{
+				close();
+			}
+
+			std::string 
+			_base::as_string(
+				__in const _base &object,
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << STRING_CHECK(object.m_path)
+					<< ", ENTRIES=" << object.m_count
+					<< ", SIZE=" << (object.m_length / BYTES_PER_KBYTE) << " KB";
+
+				return result.str();
+			}
+
+			void 
+			_base::close(void)
+			{
+
+				if(m_data) {
+					munmap((void *) m_data, m_length);
+					m_data = nullptr;
+				}
+
+				if(m_file != ARCHIVE_FILE_INVALID) {
+					::close(m_file);
+					m_file = ARCHIVE_FILE_INVALID;
+				}
+
+				m_count = 0;
+				m_length = 0;
+			}
+
+			bool 
+			_base::contains(
+				__in const std::string &name
+				)
+			{
+				return (find(name) != nullptr);
+			}
+
+			const void * 
+			_base::find(
+				__in const std::string &name
+				)
+			{
+				uint64_t key = hash(name);
+				std::string normal = normalize(name);
+				const gaea::engine::archive::archive_entry_t *begin, *end, *iter;
+				const gaea::engine::archive::archive_header_t *header =
+					(const gaea::engine::archive::archive_header_t *) m_data;
+
+				begin = (const gaea::engine::archive::archive_entry_t *) (m_data + header->index_offset);
+				end = begin + m_count;
+
+				iter = std::lower_bound(begin, end, key,
+					[](const gaea::engine::archive::archive_entry_t &entry, uint64_t value) {
+						return (entry.hash < value);
+					});
+
+				for(; (iter != end) && (iter->hash == key); ++iter) {
+
+					if(!normal.compare(0, std::string::npos, (const char *) (m_data + header->name_offset
+							+ iter->name_offset), iter->name_length)) {
+						return iter;
+					}
+				}
+
+				return nullptr;
+			}
+
+			bool 
+			_base::map(
+				__in const std::string &name,
+				__out const uint8_t *&data,
+				__out size_t &length
+				)
+			{
+				bool result;
+				const gaea::engine::archive::archive_entry_t *entry =
+					(const gaea::engine::archive::archive_entry_t *) find(name);
+
+				result = (entry && (entry->compression == ARCHIVE_COMPRESSION_NONE));
+				if(result) {
+					data = (m_data + entry->offset);
+					length = entry->length;
+				}
+
+				return result;
+			}
+
+			void 
+			_base::open(void)
+			{
+				struct stat status;
+				const gaea::engine::archive::archive_entry_t *entry, *end;
+				const gaea::engine::archive::archive_header_t *header = nullptr;
+
+				m_file = ::open(m_path.c_str(), O_RDONLY);
+				if(m_file == ARCHIVE_FILE_INVALID) {
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_NOT_FOUND,
+						"%s", STRING_CHECK(m_path));
+				}
+
+				if(fstat(m_file, &status) || (status.st_size < (off_t) sizeof(*header))) {
+					close();
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_MALFORMED,
+						"%s", STRING_CHECK(m_path));
+				}
+
+				m_length = status.st_size;
+				m_data = (const uint8_t *) mmap(nullptr, m_length, PROT_READ, MAP_PRIVATE, m_file, 0);
+				if(m_data == MAP_FAILED) {
+					m_data = nullptr;
+					close();
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_EXTERNAL,
+						"mmap failed: %s", STRING_CHECK(m_path));
+				}
+
+				header = (const gaea::engine::archive::archive_header_t *) m_data;
+				if((header->magic != ARCHIVE_MAGIC) || (header->version != ARCHIVE_VERSION)
+						|| (header->index_offset > m_length)
+						|| (header->index_offset % ARCHIVE_INDEX_ALIGNMENT)
+						|| (header->count > ((m_length - header->index_offset) / sizeof(*entry)))
+						|| (header->name_offset > m_length)
+						|| (header->name_length > (m_length - header->name_offset))) {
+					close();
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_MALFORMED,
+						"%s", STRING_CHECK(m_path));
+				}
+
+				entry = (const gaea::engine::archive::archive_entry_t *) (m_data + header->index_offset);
+				for(end = entry + header->count; entry != end; ++entry) {
+
+					if((entry->compression > ARCHIVE_COMPRESSION_MAX)
+							|| (entry->offset > m_length) || (entry->size > (m_length - entry->offset))
+							|| (entry->name_offset > header->name_length)
+							|| (entry->name_length > (header->name_length - entry->name_offset))) {
+						close();
+						THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_MALFORMED,
+							"%s", STRING_CHECK(m_path));
+					}
+				}
+
+				m_count = header->count;
+			}
+
+			const std::string & 
+			_base::path(void)
+			{
+				return m_path;
+			}
+
+			void 
+			_base::read(
+				__in const std::string &name,
+				__out std::vector<uint8_t> &data
+				)
+			{
+				const gaea::engine::archive::archive_entry_t *entry =
+					(const gaea::engine::archive::archive_entry_t *) find(name);
+
+				if(!entry) {
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_NOT_FOUND,
+						"%s", STRING_CHECK(name));
+				}
+
+				decompress((gaea::compression_t) entry->compression, m_data + entry->offset, entry->size,
+					data, entry->length);
+			}
+
+			size_t 
+			_base::size(void)
+			{
+				return m_count;
+			}
+
+			std::string 
+			_base::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::engine::archive::base::as_string(*this, verbose);
+			}
+
+			_builder::_builder(void)
+			{
+				return;
+			}
+
+			_builder::_builder(
+				__in const _builder &other
+				) :
+					m_entry(other.m_entry)
+			{
+				return;
+			}
+
+			_builder::~_builder(void)
+			{
+				return;
+			}
+
+			_builder & 
+			_builder::operator=(
+				__in const _builder &other
+				)
+			{
+
+				if(this != &other) {
+					m_entry = other.m_entry;
+				}
+
+				return *this;
+			}
+
+			void 
+			_builder::add(
+				__in const std::string &name,
+				__in const std::vector<uint8_t> &data,
+				__in_opt gaea::compression_t compression
+				)
+			{
+				std::string normal = normalize(name);
+
+				if(compression > ARCHIVE_COMPRESSION_MAX) {
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_INVALID,
+						"%x", compression);
+				}
+
+				if(m_entry.find(normal) != m_entry.end()) {
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_DUPLICATE,
+						"%s", STRING_CHECK(normal));
+				}
+
+				m_entry.insert(std::pair<std::string, std::pair<std::vector<uint8_t>, gaea::compression_t>>(
+					normal, std::pair<std::vector<uint8_t>, gaea::compression_t>(data, compression)));
+			}
+
+			void 
+			_builder::add_file(
+				__in const std::string &path,
+				__in_opt gaea::compression_t compression
+				)
+			{
+				std::vector<uint8_t> data;
+
+				if(!read_file(path, data)) {
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_NOT_FOUND,
+						"%s", STRING_CHECK(path));
+				}
+
+				add(path, data, compression);
+			}
+
+			std::string 
+			_builder::as_string(
+				__in const _builder &object,
+				__in_opt bool verbose
+				)
+			{
+				size_t count = 0;
+				std::stringstream result;
+				std::map<std::string, std::pair<std::vector<uint8_t>, gaea::compression_t>>::const_iterator iter;
+
+				result << "ENTRIES=" << object.m_entry.size();
+
+				if(verbose) {
+
+					for(iter = object.m_entry.begin(); iter != object.m_entry.end(); ++count, ++iter) {
+						result << std::endl << "[" << count << "] " << STRING_CHECK(iter->first)
+							<< ", LEN=" << iter->second.first.size()
+							<< ", COMP=" << ARCHIVE_COMPRESSION_STRING(iter->second.second);
+					}
+				}
+
+				return result.str();
+			}
+
+			void 
+			_builder::clear(void)
+			{
+				m_entry.clear();
+			}
+
+			size_t 
+			_builder::size(void)
+			{
+				return m_entry.size();
+			}
+
+			std::string 
+			_builder::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::engine::archive::builder::as_string(*this, verbose);
+			}
+
+			void 
+			_builder::write(
+				__in const std::string &path
+				)
+			{
+				uint64_t offset;
+				std::ofstream file;
+				std::string names;
+				std::vector<uint8_t> output;
+				gaea::engine::archive::archive_entry_t entry;
+				gaea::engine::archive::archive_header_t header;
+				std::vector<gaea::engine::archive::archive_entry_t> index;
+				std::vector<gaea::engine::archive::archive_entry_t>::iterator index_iter;
+				std::map<std::string, std::pair<std::vector<uint8_t>, gaea::compression_t>>::iterator iter;
+
+				file = std::ofstream(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+				if(!file) {
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_NOT_FOUND,
+						"%s", STRING_CHECK(path));
+				}
+
+				std::memset(&header, 0, sizeof(header));
+				file.write((const char *) &header, sizeof(header));
+				offset = sizeof(header);
+
+				for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
+					std::memset(&entry, 0, sizeof(entry));
+					compress(iter->second.second, iter->second.first.data(),
+						iter->second.first.size(), output);
+
+					if(iter->second.second == ARCHIVE_COMPRESSION_NONE) {
+						output.insert(output.begin(), (ARCHIVE_ALIGNMENT - (offset % ARCHIVE_ALIGNMENT))
+							% ARCHIVE_ALIGNMENT, 0);
+						entry.offset = (offset + output.size() - iter->second.first.size());
+					} else {
+						entry.offset = offset;
+					}
+
+					entry.hash = hash(iter->first);
+					entry.size = (offset + output.size() - entry.offset);
+					entry.length = iter->second.first.size();
+					entry.name_offset = names.size();
+					entry.name_length = iter->first.size();
+					entry.compression = iter->second.second;
+					index.push_back(entry);
+					names += iter->first;
+
+					if(!output.empty()) {
+						file.write((const char *) &output[0], output.size());
+					}
+
+					offset += output.size();
+				}
+
+				std::stable_sort(index.begin(), index.end(),
+					[](const gaea::engine::archive::archive_entry_t &left,
+							const gaea::engine::archive::archive_entry_t &right) {
+						return (left.hash < right.hash);
+					});
+
+				header.magic = ARCHIVE_MAGIC;
+				header.version = ARCHIVE_VERSION;
+				header.count = index.size();
+
+				// the index is read in place, so its 64-bit fields have to start aligned
+				output.assign((ARCHIVE_INDEX_ALIGNMENT - (offset % ARCHIVE_INDEX_ALIGNMENT)) % ARCHIVE_INDEX_ALIGNMENT, 0);
+				if(!output.empty()) {
+					file.write((const char *) &output[0], output.size());
+				}
+
+				offset += output.size();
+				header.index_offset = offset;
+
+				for(index_iter = index.begin(); index_iter != index.end(); ++index_iter) {
+					file.write((const char *) &(*index_iter), sizeof(*index_iter));
+					offset += sizeof(*index_iter);
+				}
+
+				header.name_offset = offset;
+				header.name_length = names.size();
+				file.write(names.c_str(), names.size());
+
+				file.seekp(0, std::ios::beg);
+				file.write((const char *) &header, sizeof(header));
+
+				if(!file) {
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_EXTERNAL,
+						"Failed to write archive: %s", STRING_CHECK(path));
+				}
+
+				file.close();
+			}
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_initialized(false)
+			{
+				std::atexit(gaea::engine::archive::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				uninitialize();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::archive::manager::m_instance) {
+					delete gaea::engine::archive::manager::m_instance;
+					gaea::engine::archive::manager::m_instance = nullptr;
+				}
+			}
+
+			_manager & 
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::archive::manager::m_instance) {
+
+					gaea::engine::archive::manager::m_instance = new gaea::engine::archive::manager;
+					if(!gaea::engine::archive::manager::m_instance) {
+						THROW_GAEA_ARCHIVE_EXCEPTION(GAEA_ARCHIVE_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::archive::manager::m_instance;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+				m_entry.clear();
+			}
+
+			std::vector<std::shared_ptr<gaea::engine::archive::base>>::iterator 
+			_manager::find(
+				__in const std::string &path
+				)
+			{
+				std::vector<std::shared_ptr<gaea::engine::archive::base>>::iterator result;
+
+				for(result = m_entry.begin(); result != m_entry.end(); ++result) {
+
+					if((*result)->path() == path) {
+						break;
+					}
+				}
+
+				return result;
+			}
+
+			void 
+			_manager::initialize(void)
+			{
+
+				if(m_initialized) {
+					THROW_GAEA_ARCHIVE_EXCEPTION(GAEA_ARCHIVE_EXCEPTION_INITIALIZED);
+				}
+
+				m_initialized = true;
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::archive::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_initialized(void)
+			{
+				return m_initialized;
+			}
+
+			bool 
+			_manager::is_mounted(
+				__in const std::string &path
+				)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				if(!m_initialized) {
+					THROW_GAEA_ARCHIVE_EXCEPTION(GAEA_ARCHIVE_EXCEPTION_UNINITIALIZED);
+				}
+
+				return (find(path) != m_entry.end());
+			}
+
+			bool 
+			_manager::load(
+				__in const std::string &name,
+				__out std::vector<uint8_t> &data
+				)
+			{
+				bool result = false;
+				std::lock_guard<std::mutex> lock(m_lock);
+				std::vector<std::shared_ptr<gaea::engine::archive::base>>::reverse_iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_ARCHIVE_EXCEPTION(GAEA_ARCHIVE_EXCEPTION_UNINITIALIZED);
+				}
+
+				for(iter = m_entry.rbegin(); iter != m_entry.rend(); ++iter) {
+
+					if((*iter)->contains(name)) {
+						(*iter)->read(name, data);
+						result = true;
+						break;
+					}
+				}
+
+				return result;
+			}
+
+			bool 
+			_manager::map(
+				__in const std::string &name,
+				__out std::shared_ptr<const uint8_t> &data,
+				__out size_t &length
+				)
+			{
+				bool result = false;
+				const uint8_t *entry = nullptr;
+				std::lock_guard<std::mutex> lock(m_lock);
+				std::vector<std::shared_ptr<gaea::engine::archive::base>>::reverse_iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_ARCHIVE_EXCEPTION(GAEA_ARCHIVE_EXCEPTION_UNINITIALIZED);
+				}
+
+				for(iter = m_entry.rbegin(); iter != m_entry.rend(); ++iter) {
+
+					if((*iter)->contains(name)) {
+
+						// the handle shares ownership of the archive, so an unmount cannot unmap it
+						result = (*iter)->map(name, entry, length);
+						if(result) {
+							data = std::shared_ptr<const uint8_t>(*iter, entry);
+						}
+						break;
+					}
+				}
+
+				return result;
+			}
+
+			bool 
+			_manager::mount(
+				__in const std::string &path,
+				__in_opt bool optional
+				)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				if(!m_initialized) {
+					THROW_GAEA_ARCHIVE_EXCEPTION(GAEA_ARCHIVE_EXCEPTION_UNINITIALIZED);
+				}
+
+				if(find(path) != m_entry.end()) {
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_DUPLICATE,
+						"%s", STRING_CHECK(path));
+				}
+
+				if(optional && access(path.c_str(), R_OK)) {
+					return false;
+				}
+
+				m_entry.push_back(std::make_shared<gaea::engine::archive::base>(path));
+				if(!m_entry.back()) {
+					m_entry.pop_back();
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_ALLOCATED,
+						"%s", STRING_CHECK(path));
+				}
+
+				return true;
+			}
+
+			size_t 
+			_manager::size(void)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				return m_entry.size();
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				size_t count = 0;
+				std::stringstream result;
+				std::lock_guard<std::mutex> lock(m_lock);
+				std::vector<std::shared_ptr<gaea::engine::archive::base>>::iterator iter;
+
+				result << GAEA_ARCHIVE_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
+
+				if(m_initialized) {
+					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+						<< ", ENTRIES=" << m_entry.size();
+
+					if(verbose) {
+
+						for(iter = m_entry.begin(); iter != m_entry.end(); ++count, ++iter) {
+							result << std::endl << "[" << count << "] " << (*iter)->to_string(verbose);
+						}
+					}
+				}
+
+				return result.str();
+			}
+
+			void 
+			_manager::uninitialize(void)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				if(m_initialized) {
+					m_initialized = false;
+					clear();
+				}
+			}
+
+			void 
+			_manager::unmount(
+				__in const std::string &path
+				)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				std::vector<std::shared_ptr<gaea::engine::archive::base>>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_ARCHIVE_EXCEPTION(GAEA_ARCHIVE_EXCEPTION_UNINITIALIZED);
+				}
+
+				iter = find(path);
+				if(iter == m_entry.end()) {
+					THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_NOT_FOUND,
+						"%s", STRING_CHECK(path));
+				}
+
+				m_entry.erase(iter);
+			}
+		}
+	}
+}
@@ -0,0 +1,104 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_ARCHIVE_TYPE_H_
+#define GAEA_ARCHIVE_TYPE_H_
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace archive {
+
+			#define GAEA_ARCHIVE_HEADER "[GAEA::ENGINE::ARCHIVE]"
+#ifndef NDEBUG
+			#define GAEA_ARCHIVE_EXCEPTION_HEADER GAEA_ARCHIVE_HEADER " "
+#else
+			#define GAEA_ARCHIVE_EXCEPTION_HEADER
+#endif // NDEBUG
+
+			enum {
+				GAEA_ARCHIVE_EXCEPTION_ALLOCATED = 0,
+				GAEA_ARCHIVE_EXCEPTION_DUPLICATE,
+				GAEA_ARCHIVE_EXCEPTION_EXTERNAL,
+				GAEA_ARCHIVE_EXCEPTION_INITIALIZED,
+				GAEA_ARCHIVE_EXCEPTION_INVALID,
+				GAEA_ARCHIVE_EXCEPTION_MALFORMED,
+				GAEA_ARCHIVE_EXCEPTION_NOT_FOUND,
+				GAEA_ARCHIVE_EXCEPTION_UNINITIALIZED,
+			};
+
+			#define GAEA_ARCHIVE_EXCEPTION_MAX GAEA_ARCHIVE_EXCEPTION_UNINITIALIZED
+
+			static const std::string GAEA_ARCHIVE_EXCEPTION_STR[] = {
+				GAEA_ARCHIVE_EXCEPTION_HEADER "Failed to allocate archive manager",
+				GAEA_ARCHIVE_EXCEPTION_HEADER "Duplicate archive entry",
+				GAEA_ARCHIVE_EXCEPTION_HEADER "External exception",
+				GAEA_ARCHIVE_EXCEPTION_HEADER "Archive manager is initialized",
+				GAEA_ARCHIVE_EXCEPTION_HEADER "Invalid compression type",
+				GAEA_ARCHIVE_EXCEPTION_HEADER "Malformed archive",
+				GAEA_ARCHIVE_EXCEPTION_HEADER "Archive entry does not exist",
+				GAEA_ARCHIVE_EXCEPTION_HEADER "Archive manager is uninitialized",
+				};
+
+			#define GAEA_ARCHIVE_EXCEPTION_STRING(_TYPE_) \
+				((_TYPE_) > GAEA_ARCHIVE_EXCEPTION_MAX ? GAEA_ARCHIVE_EXCEPTION_HEADER EXCEPTION_UNKNOWN : \
+				STRING_CHECK(GAEA_ARCHIVE_EXCEPTION_STR[_TYPE_]))
+
+			#define THROW_GAEA_ARCHIVE_EXCEPTION(_EXCEPT_) \
+				THROW_EXCEPTION(GAEA_ARCHIVE_EXCEPTION_STRING(_EXCEPT_))
+			#define THROW_GAEA_ARCHIVE_EXCEPTION_FORMAT(_EXCEPT_, _FORMAT_, ...) \
+				THROW_EXCEPTION_FORMAT(GAEA_ARCHIVE_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+			/*
+			 * On-disk layout (little-endian):
+			 *   header | entry data ... | index (sorted by hash) | names
+			 * Uncompressed entries start on an ARCHIVE_ALIGNMENT boundary so they can be
+			 * used directly out of the mapped file. The index starts on an 8-byte
+			 * boundary, since it is read in place.
+			 */
+
+			#define ARCHIVE_MAGIC 0x41454147 // "GAEA"
+			#define ARCHIVE_VERSION 1
+
+			typedef struct __attribute__((packed)) {
+				uint32_t magic;
+				uint16_t version;
+				uint16_t reserved;
+				uint32_t count;
+				uint32_t name_length;
+				uint64_t index_offset;
+				uint64_t name_offset;
+			} archive_header_t;
+
+			typedef struct __attribute__((packed)) {
+				uint64_t hash;
+				uint64_t offset;
+				uint64_t size;
+				uint64_t length;
+				uint32_t name_offset;
+				uint16_t name_length;
+				uint8_t compression;
+				uint8_t reserved;
+			} archive_entry_t;
+		}
+	}
+}
+
+#endif // GAEA_ARCHIVE_TYPE_H_
@@ -0,0 +1,304 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include "../../include/gaea.h"
+#include "gaea_arena_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace arena {
+
+			void *
+			allocate(
+				__in size_t length,
+				__in_opt size_t alignment
+				)
+			{
+
+				if(gaea::engine::arena::manager::is_allocated()) {
+
+					gaea::engine::arena::manager &instance = gaea::engine::arena::manager::acquire();
+					if(instance.is_initialized()) {
+						return instance.allocate(length, alignment);
+					}
+				}
+
+				return std::malloc(length);
+			}
+
+			void 
+			deallocate(
+				__in void *data
+				)
+			{
+
+				if(gaea::engine::arena::manager::is_allocated()) {
+
+					gaea::engine::arena::manager &instance = gaea::engine::arena::manager::acquire();
+					if(instance.is_initialized()) {
+						instance.deallocate(data);
+						return;
+					}
+				}
+
+				std::free(data);
+			}
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_block(nullptr),
+				m_capacity(0),
+				m_count(0),
+				m_high_water(0),
+				m_initialized(false),
+				m_offset(0),
+				m_overflow(0),
+				m_overflow_length(0)
+			{
+				std::atexit(gaea::engine::arena::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				uninitialize();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::arena::manager::m_instance) {
+					delete gaea::engine::arena::manager::m_instance;
+					gaea::engine::arena::manager::m_instance = nullptr;
+				}
+			}
+
+			_manager & 
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::arena::manager::m_instance) {
+
+					gaea::engine::arena::manager::m_instance = new gaea::engine::arena::manager;
+					if(!gaea::engine::arena::manager::m_instance) {
+						THROW_GAEA_ARENA_EXCEPTION(GAEA_ARENA_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::arena::manager::m_instance;
+			}
+
+			void *
+			_manager::allocate(
+				__in size_t length,
+				__in_opt size_t alignment
+				)
+			{
+				size_t padding;
+				void *result = nullptr;
+
+				if(!m_initialized) {
+					THROW_GAEA_ARENA_EXCEPTION(GAEA_ARENA_EXCEPTION_UNINITIALIZED);
+				}
+
+				if(std::this_thread::get_id() == m_owner) {
+					padding = ((alignment - (((uintptr_t) m_block + m_offset) % alignment)) % alignment);
+
+					if((m_offset + padding + length) <= m_capacity) {
+						result = (m_block + m_offset + padding);
+						m_offset += (padding + length);
+						++m_count;
+					} else {
+						m_overflow_length += length;
+						++m_overflow;
+					}
+				}
+
+				if(!result) {
+
+					result = std::malloc(length);
+					if(!result) {
+						THROW_GAEA_ARENA_EXCEPTION_FORMAT(GAEA_ARENA_EXCEPTION_ALLOCATED, "Length=%u",
+							(uint32_t) length);
+					}
+				}
+
+				return result;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+
+				if(m_block) {
+					std::free(m_block);
+					m_block = nullptr;
+				}
+
+				m_capacity = 0;
+				m_count = 0;
+				m_high_water = 0;
+				m_offset = 0;
+				m_overflow = 0;
+				m_overflow_length = 0;
+			}
+
+			void 
+			_manager::deallocate(
+				__in void *data
+				)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_ARENA_EXCEPTION(GAEA_ARENA_EXCEPTION_UNINITIALIZED);
+				}
+
+				// block memory is reclaimed all at once by reset
+				if(((uint8_t *) data < m_block) || ((uint8_t *) data >= (m_block + m_capacity))) {
+					std::free(data);
+				}
+			}
+
+			void 
+			_manager::initialize(
+				__in_opt size_t capacity
+				)
+			{
+
+				if(m_initialized) {
+					THROW_GAEA_ARENA_EXCEPTION(GAEA_ARENA_EXCEPTION_INITIALIZED);
+				}
+
+				if(!capacity || (capacity > ARENA_CAPACITY_MAX)) {
+					THROW_GAEA_ARENA_EXCEPTION_FORMAT(GAEA_ARENA_EXCEPTION_INVALID, "Capacity=%u", (uint32_t) capacity);
+				}
+
+				m_block = (uint8_t *) std::malloc(capacity);
+				if(!m_block) {
+					THROW_GAEA_ARENA_EXCEPTION_FORMAT(GAEA_ARENA_EXCEPTION_ALLOCATED, "Capacity=%u", (uint32_t) capacity);
+				}
+
+				m_capacity = capacity;
+				m_owner = std::this_thread::get_id();
+				m_initialized = true;
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::arena::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_initialized(void)
+			{
+				return m_initialized;
+			}
+
+			void 
+			_manager::reset(void)
+			{
+				uint8_t *block;
+				size_t capacity;
+
+				if(!m_initialized) {
+					THROW_GAEA_ARENA_EXCEPTION(GAEA_ARENA_EXCEPTION_UNINITIALIZED);
+				}
+
+				m_high_water = std::max(m_high_water, m_offset + m_overflow_length);
+
+				if((m_high_water > m_capacity) && (m_capacity < ARENA_CAPACITY_MAX)) {
+
+					capacity = m_capacity;
+					while(capacity < m_high_water) {
+						capacity <<= 1;
+					}
+
+					capacity = std::min(capacity, (size_t) ARENA_CAPACITY_MAX);
+
+					block = (uint8_t *) std::malloc(capacity);
+					if(block) {
+						std::free(m_block);
+						m_block = block;
+						m_capacity = capacity;
+					}
+				}
+
+				m_count = 0;
+				m_offset = 0;
+				m_overflow_length = 0;
+			}
+
+			gaea::engine::arena::statistic_t 
+			_manager::statistic(void)
+			{
+				gaea::engine::arena::statistic_t result;
+
+				if(!m_initialized) {
+					THROW_GAEA_ARENA_EXCEPTION(GAEA_ARENA_EXCEPTION_UNINITIALIZED);
+				}
+
+				result.allocated = m_offset;
+				result.capacity = m_capacity;
+				result.count = m_count;
+				result.high_water = std::max(m_high_water, m_offset + m_overflow_length);
+				result.overflow = m_overflow;
+
+				return result;
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << GAEA_ARENA_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
+
+				if(m_initialized) {
+					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+						<< ", CAP=" << (m_capacity / BYTES_PER_KBYTE) << " KB"
+						<< ", HIGH=" << (std::max(m_high_water, m_offset + m_overflow_length) / BYTES_PER_KBYTE) << " KB"
+						<< ", OVERFLOW=" << m_overflow;
+
+					if(verbose) {
+						result << ", FRAME={" << m_count << ", " << m_offset << " bytes}";
+					}
+				}
+
+				return result.str();
+			}
+
+			void 
+			_manager::uninitialize(void)
+			{
+
+				if(m_initialized) {
+					m_initialized = false;
+					clear();
+				}
+			}
+		}
+	}
+}
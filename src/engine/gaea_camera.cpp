@@ -26,11 +26,17 @@ namespace gaea {
 
 		namespace camera {
 
+			#define CAMERA_CHANNEL_LIST \
+				gaea::engine::camera::clip_set_t, gaea::engine::camera::dimensions_set_t, \
+				gaea::engine::camera::fov_delta_t, gaea::engine::camera::fov_set_t, \
+				gaea::engine::camera::position_delta_t, gaea::engine::camera::position_set_t, \
+				gaea::engine::camera::rotation_delta_t, gaea::engine::camera::rotation_set_t, \
+				gaea::engine::camera::up_delta_t, gaea::engine::camera::up_set_t
 			#define CAMERA_DIMENSION_MIN 1.f
 
 			_base::_base(
 				__in const glm::ivec2 &dimensions,
-				__in_opt const glm::vec3 &position,
+				__in_opt const glm::dvec3 &position,
 				__in_opt const glm::vec3 &rotation,
 				__in_opt const glm::vec3 &up,
 				__in_opt const glm::vec2 &clip,
@@ -71,7 +77,7 @@ namespace gaea {
 
 			_base::~_base(void)
 			{
-				return;
+				gaea::engine::event::unsubscribe<CAMERA_CHANNEL_LIST>(this);
 			}
 
 			_base &
@@ -83,6 +89,7 @@ namespace gaea {
 				if(this != &other) {
 					gaea::engine::entity::base_position::operator=(other);
 					gaea::engine::observer::base::operator=(other);
+					gaea::engine::event::unsubscribe<CAMERA_CHANNEL_LIST>(this);
 					m_clip = other.m_clip;
 					m_dimensions = other.m_dimensions;
 					m_fov = other.m_fov;
@@ -144,8 +151,7 @@ namespace gaea {
 									"%s", STRING_CHECK(event.to_string(true)));
 							}
 
-							instance->set_clip(*vec2_data);
-							instance->update_projection();
+							instance->receive(gaea::engine::camera::clip_set_t { *vec2_data });
 							break;
 						case EVENT_CAMERA_DIMENSIONS_SET:
 
@@ -155,8 +161,7 @@ namespace gaea {
 									"%s", STRING_CHECK(event.to_string(true)));
 							}
 
-							instance->set_dimensions(*ivec2_data);
-							instance->update_projection();
+							instance->receive(gaea::engine::camera::dimensions_set_t { *ivec2_data });
 							break;
 						case EVENT_CAMERA_FOV_DELTA:
 						case EVENT_CAMERA_FOV_SET:
@@ -169,11 +174,10 @@ namespace gaea {
 
 							switch(specifier) {
 								case EVENT_CAMERA_FOV_DELTA:
-									instance->m_fov_delta -= *float_data;
+									instance->receive(gaea::engine::camera::fov_delta_t { *float_data });
 									break;
 								case EVENT_CAMERA_FOV_SET:
-									instance->set_fov(*float_data);
-									instance->update_projection();
+									instance->receive(gaea::engine::camera::fov_set_t { *float_data });
 									break;
 								default:
 									break;
@@ -194,22 +198,22 @@ namespace gaea {
 
 							switch(specifier) {
 								case EVENT_CAMERA_POSITION_DELTA:
-									instance->m_position_delta += *vec3_data;
+									instance->receive(gaea::engine::camera::position_delta_t { *vec3_data });
 									break;
 								case EVENT_CAMERA_POSITION_SET:
-									instance->m_position = *vec3_data;
+									instance->receive(gaea::engine::camera::position_set_t { glm::dvec3(*vec3_data) });
 									break;
 								case EVENT_CAMERA_ROTATION_DELTA:
-									instance->m_rotation_delta += *vec3_data;
+									instance->receive(gaea::engine::camera::rotation_delta_t { *vec3_data });
 									break;
 								case EVENT_CAMERA_ROTATION_SET:
-									instance->m_rotation = *vec3_data;
+									instance->receive(gaea::engine::camera::rotation_set_t { *vec3_data });
 									break;
 								case EVENT_CAMERA_UP_DELTA:
-									instance->m_up_delta += *vec3_data;
+									instance->receive(gaea::engine::camera::up_delta_t { *vec3_data });
 									break;
 								case EVENT_CAMERA_UP_SET:
-									instance->m_up = *vec3_data;
+									instance->receive(gaea::engine::camera::up_set_t { *vec3_data });
 									break;
 								default:
 									break;
@@ -221,15 +225,156 @@ namespace gaea {
 				}
 			}
 
-			const glm::mat4 &
+			bool 
+			_base::capture(
+				__out gaea::engine::entity::transform_t &previous,
+				__out gaea::engine::entity::transform_t &current
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				return gaea::engine::entity::base_position::capture(previous, current);
+			}
+
+			glm::ivec2 
+			_base::dimensions(void)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				return m_dimensions;
+			}
+
+			glm::dvec3 
+			_base::origin(void)
+			{
+				return interpolated().position;
+			}
+
+			void 
+			_base::present(
+				__in const gaea::engine::entity::transform_t &previous,
+				__in const gaea::engine::entity::transform_t &current,
+				__in GLfloat alpha
+				)
+			{
+				gaea::engine::entity::base_position::present(previous, current, alpha);
+				update_view();
+			}
+
+			glm::mat4 
 			_base::projection(void)
 			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
 				return m_projection;
 			}
 
+			void 
+			_base::receive(
+				__in const gaea::engine::camera::clip_set_t &message
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				set_clip(message.value);
+				update_projection();
+			}
+
+			void 
+			_base::receive(
+				__in const gaea::engine::camera::dimensions_set_t &message
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				set_dimensions(message.value);
+				update_projection();
+			}
+
+			void 
+			_base::receive(
+				__in const gaea::engine::camera::fov_delta_t &message
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				m_fov_delta -= message.value;
+			}
+
+			void 
+			_base::receive(
+				__in const gaea::engine::camera::fov_set_t &message
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				set_fov(message.value);
+				update_projection();
+			}
+
+			void 
+			_base::receive(
+				__in const gaea::engine::camera::position_delta_t &message
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				m_position_delta += message.value;
+			}
+
+			void 
+			_base::receive(
+				__in const gaea::engine::camera::position_set_t &message
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				m_position = message.value;
+			}
+
+			void 
+			_base::receive(
+				__in const gaea::engine::camera::rotation_delta_t &message
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				m_rotation_delta += message.value;
+			}
+
+			void 
+			_base::receive(
+				__in const gaea::engine::camera::rotation_set_t &message
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				m_rotation = message.value;
+			}
+
+			void 
+			_base::receive(
+				__in const gaea::engine::camera::up_delta_t &message
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				m_up_delta += message.value;
+			}
+
+			void 
+			_base::receive(
+				__in const gaea::engine::camera::up_set_t &message
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				m_up = message.value;
+			}
+
 			void 
 			_base::render(
-				__in const glm::vec3 &position,
+				__in const glm::dvec3 &position,
 				__in const glm::vec3 &rotation,
 				__in const glm::vec3 &up,
 				__in const glm::mat4 &projection,
@@ -244,6 +389,7 @@ namespace gaea {
 				__in const glm::vec2 &clip
 				)
 			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
 
 				m_clip = clip;
 				if(m_clip.x < CAMERA_CLIP_MIN) {
@@ -268,6 +414,7 @@ namespace gaea {
 				__in const glm::ivec2 &dimensions
 				)
 			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
 
 				m_dimensions = dimensions;
 				if(m_dimensions.x < CAMERA_DIMENSION_MIN) {
@@ -284,6 +431,7 @@ namespace gaea {
 				__in GLfloat fov
 				)
 			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
 
 				m_fov = fov;
 				if(m_fov < CAMERA_FOV_MIN) {
@@ -297,6 +445,7 @@ namespace gaea {
 			_base::setup(void)
 			{
 				gaea::engine::observer::base::register_handler(&base::event_handler, EVENT_CAMERA, this);
+				gaea::engine::event::subscribe<CAMERA_CHANNEL_LIST>(this);
 				update_projection();
 				update_view();
 			}
@@ -314,6 +463,14 @@ namespace gaea {
 				setup();
 			}
 
+			void 
+			_base::snapshot(void)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				gaea::engine::entity::base_position::snapshot();
+			}
+
 			std::string 
 			_base::to_string(
 				__in_opt bool verbose
@@ -327,6 +484,7 @@ namespace gaea {
 				__in GLfloat delta
 				)
 			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
 
 				if(m_fov_delta) {
 
@@ -342,7 +500,7 @@ namespace gaea {
 				}
 
 				if(m_position_delta != glm::vec3()) {
-					m_position += m_position_delta;
+					m_position += glm::dvec3(m_position_delta);
 					m_position_delta = glm::vec3();
 				}
 
@@ -355,8 +513,6 @@ namespace gaea {
 					m_up += m_up_delta;
 					m_up_delta = glm::vec3();
 				}
-
-				update_view();
 			}
 
 			void 
@@ -369,7 +525,9 @@ namespace gaea {
 			void 
 			_base::update_view(void)
 			{
-				m_view = glm::lookAt(m_position, m_position + m_rotation, m_up);
+				gaea::engine::entity::transform_t transform = interpolated();
+
+				m_view = glm::lookAt(glm::vec3(), transform.rotation, transform.up);
 			}
 
 			const glm::mat4 &
@@ -431,7 +589,7 @@ namespace gaea {
 			void 
 			_manager::initialize(
 				__in const glm::ivec2 &dimensions,
-				__in_opt const glm::vec3 &position,
+				__in_opt const glm::dvec3 &position,
 				__in_opt const glm::vec3 &rotation,
 				__in_opt const glm::vec3 &up,
 				__in_opt const glm::vec2 &clip,
@@ -0,0 +1,256 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include "../../include/gaea.h"
+#include "gaea_channel_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace event {
+
+			// channels and slots this thread is publishing on, innermost last
+			static thread_local std::vector<std::pair<const gaea::engine::event::base_channel *, uint32_t>> channel_reader;
+
+			typedef class _channel_guard {
+
+				public:
+
+					_channel_guard(
+						__in const gaea::engine::event::base_channel *channel,
+						__in std::atomic<size_t> *reader,
+						__in const std::atomic<uint64_t> &epoch
+						) :
+							m_reader(nullptr)
+					{
+						uint64_t current;
+
+						// counting in under an epoch that has since moved would hide this publisher from the drain
+						for(;;) {
+							current = epoch;
+							m_reader = &reader[current % CHANNEL_SLOT_COUNT];
+							++(*m_reader);
+
+							if(epoch == current) {
+								break;
+							}
+
+							--(*m_reader);
+						}
+
+						channel_reader.push_back(std::make_pair(channel, (uint32_t) (current % CHANNEL_SLOT_COUNT)));
+					}
+
+					~_channel_guard(void)
+					{
+						channel_reader.pop_back();
+						--(*m_reader);
+					}
+
+				protected:
+
+					_channel_guard(
+						__in const _channel_guard &other
+						);
+
+					_channel_guard &operator=(
+						__in const _channel_guard &other
+						);
+
+					std::atomic<size_t> *m_reader;
+
+			} channel_guard;
+
+			_base_channel::_base_channel(void) :
+				m_epoch(0),
+				m_receiver(std::make_shared<const gaea::engine::event::base_channel::receiver_list_t>())
+			{
+				size_t iter = 0;
+
+				for(; iter < CHANNEL_SLOT_COUNT; ++iter) {
+					m_reader[iter] = 0;
+				}
+			}
+
+			_base_channel::~_base_channel(void)
+			{
+				return;
+			}
+
+			std::string 
+			_base_channel::as_string(
+				__in const _base_channel &object,
+				__in_opt bool verbose
+				)
+			{
+				size_t count = 0;
+				std::stringstream result;
+				gaea::engine::event::base_channel::receiver_list_t::const_iterator iter;
+				std::shared_ptr<const gaea::engine::event::base_channel::receiver_list_t> receiver;
+
+				receiver = std::atomic_load(&object.m_receiver);
+				result << "RCV=" << receiver->size();
+
+				if(verbose) {
+
+					for(iter = receiver->begin(); iter != receiver->end(); ++count, ++iter) {
+						result << std::endl << "[" << count << "] RCV=" << SCALAR_AS_HEX(uintptr_t, iter->first)
+							<< ", CTX=" << SCALAR_AS_HEX(uintptr_t, iter->second);
+					}
+				}
+
+				return result.str();
+			}
+
+			bool 
+			_base_channel::contains(
+				__in gaea::engine::event::base_channel::receive_cb receive,
+				__in void *context
+				) const
+			{
+				std::shared_ptr<const gaea::engine::event::base_channel::receiver_list_t> receiver;
+
+				receiver = std::atomic_load(&m_receiver);
+
+				return (std::find(receiver->begin(), receiver->end(), 
+					std::pair<gaea::engine::event::base_channel::receive_cb, void *>(receive, context)) 
+					!= receiver->end());
+			}
+
+			void 
+			_base_channel::publish(
+				__in const void *payload
+				) const
+			{
+				gaea::engine::event::base_channel::receiver_list_t::const_iterator iter;
+				std::shared_ptr<const gaea::engine::event::base_channel::receiver_list_t> receiver;
+				gaea::engine::event::channel_guard guard(this, m_reader, m_epoch);
+
+				receiver = std::atomic_load(&m_receiver);
+
+				for(iter = receiver->begin(); iter != receiver->end(); ++iter) {
+					(*(iter->first))(payload, iter->second);
+				}
+			}
+
+			size_t 
+			_base_channel::size(void) const
+			{
+				return std::atomic_load(&m_receiver)->size();
+			}
+
+			void 
+			_base_channel::subscribe(
+				__in gaea::engine::event::base_channel::receive_cb receive,
+				__in void *context
+				)
+			{
+				std::shared_ptr<gaea::engine::event::base_channel::receiver_list_t> receiver;
+
+				if(!context) {
+					THROW_GAEA_CHANNEL_EXCEPTION_FORMAT(GAEA_CHANNEL_EXCEPTION_INVALID_RECEIVER,
+						"%p(%p)", receive, context);
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				receiver = std::make_shared<gaea::engine::event::base_channel::receiver_list_t>(
+					*std::atomic_load(&m_receiver));
+				if(std::find(receiver->begin(), receiver->end(), 
+						std::pair<gaea::engine::event::base_channel::receive_cb, void *>(receive, context)) 
+						!= receiver->end()) {
+					THROW_GAEA_CHANNEL_EXCEPTION_FORMAT(GAEA_CHANNEL_EXCEPTION_DUPLICATE,
+						"%p(%p)", receive, context);
+				}
+
+				receiver->push_back(std::pair<gaea::engine::event::base_channel::receive_cb, void *>(receive, context));
+				std::atomic_store(&m_receiver, 
+					std::shared_ptr<const gaea::engine::event::base_channel::receiver_list_t>(receiver));
+			}
+
+			std::string 
+			_base_channel::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::engine::event::base_channel::as_string(*this, verbose);
+			}
+
+			void 
+			_base_channel::unsubscribe(
+				__in gaea::engine::event::base_channel::receive_cb receive,
+				__in void *context
+				)
+			{
+				uint64_t epoch;
+				uint32_t slot = 0;
+				size_t own[CHANNEL_SLOT_COUNT];
+				std::shared_ptr<gaea::engine::event::base_channel::receiver_list_t> receiver;
+				gaea::engine::event::base_channel::receiver_list_t::iterator iter;
+
+				for(; slot < CHANNEL_SLOT_COUNT; ++slot) {
+					own[slot] = std::count(channel_reader.begin(), channel_reader.end(), std::make_pair(
+						(const gaea::engine::event::base_channel *) this, slot));
+				}
+
+				std::unique_lock<std::mutex> lock(m_lock);
+
+				// publishers from older epochs may still hold this receiver, and with the epoch held they only drain
+				for(;;) {
+					slot = ((m_epoch + 1) % CHANNEL_SLOT_COUNT);
+					if(m_reader[slot] <= own[slot]) {
+						slot = ((m_epoch + 2) % CHANNEL_SLOT_COUNT);
+						if(m_reader[slot] <= own[slot]) {
+							break;
+						}
+					}
+
+					lock.unlock();
+					std::this_thread::yield();
+					lock.lock();
+				}
+
+				receiver = std::make_shared<gaea::engine::event::base_channel::receiver_list_t>(
+					*std::atomic_load(&m_receiver));
+
+				iter = std::find(receiver->begin(), receiver->end(), 
+					std::pair<gaea::engine::event::base_channel::receive_cb, void *>(receive, context));
+				if(iter == receiver->end()) {
+					THROW_GAEA_CHANNEL_EXCEPTION_FORMAT(GAEA_CHANNEL_EXCEPTION_NOT_FOUND,
+						"%p(%p)", receive, context);
+				}
+
+				receiver->erase(iter);
+				std::atomic_store(&m_receiver, 
+					std::shared_ptr<const gaea::engine::event::base_channel::receiver_list_t>(receiver));
+				epoch = m_epoch;
+				m_epoch = (epoch + 1);
+				lock.unlock();
+
+				// a receiver on another thread may need the lock itself, so wait after releasing it
+				slot = (epoch % CHANNEL_SLOT_COUNT);
+				while(m_reader[slot] > own[slot]) {
+					std::this_thread::yield();
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,512 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/gaea.h"
+#include "gaea_chunk_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace chunk {
+
+			#define CHUNK_BITS_MAX 16
+			#define CHUNK_HASH_X 73856093
+			#define CHUNK_HASH_Y 19349663
+			#define CHUNK_HASH_Z 83492791
+			#define CHUNK_WORD_SHIFT 6
+			#define CHUNK_WORD_WIDTH (1 << CHUNK_WORD_SHIFT)
+
+			glm::ivec3 
+			coordinate(
+				__in const glm::ivec3 &position
+				)
+			{
+				return glm::ivec3(position.x >> CHUNK_WIDTH_SHIFT, position.y >> CHUNK_WIDTH_SHIFT,
+					position.z >> CHUNK_WIDTH_SHIFT);
+			}
+
+			glm::uvec3 
+			local(
+				__in const glm::ivec3 &position
+				)
+			{
+				return glm::uvec3(position.x & (CHUNK_WIDTH - 1), position.y & (CHUNK_WIDTH - 1),
+					position.z & (CHUNK_WIDTH - 1));
+			}
+
+			size_t 
+			hash_t::operator()(
+				__in const glm::ivec3 &coordinate
+				) const
+			{
+				return (((uint32_t) coordinate.x * CHUNK_HASH_X) ^ ((uint32_t) coordinate.y * CHUNK_HASH_Y)
+					^ ((uint32_t) coordinate.z * CHUNK_HASH_Z));
+			}
+
+			_base::_base(
+				__in_opt gaea::block_t block
+				) :
+					m_bits(0),
+					m_dirty(true)
+			{
+				clear(block);
+			}
+
+			_base::_base(
+				__in const _base &other
+				) :
+					m_bits(other.m_bits),
+					m_data(other.m_data),
+					m_dirty(other.m_dirty),
+					m_free(other.m_free),
+					m_palette(other.m_palette),
+					m_palette_index(other.m_palette_index)
+			{
+				return;
+			}
+
+			_base::~_base(void)
+			{
+				return;
+			}
+
+			_base &
+			_base::operator=(
+				__in const _base &other
+				)
+			{
+
+				if(this != &other) {
+					m_bits = other.m_bits;
+					m_data = other.m_data;
+					m_dirty = other.m_dirty;
+					m_free = other.m_free;
+					m_palette = other.m_palette;
+					m_palette_index = other.m_palette_index;
+				}
+
+				return *this;
+			}
+
+			uint32_t 
+			_base::acquire_palette(
+				__in gaea::block_t block
+				)
+			{
+				uint8_t bits;
+				uint32_t result;
+				std::unordered_map<gaea::block_t, uint32_t>::iterator iter;
+
+				iter = m_palette_index.find(block);
+				if(iter != m_palette_index.end()) {
+					++m_palette[iter->second].second;
+					return iter->second;
+				}
+
+				if(!m_free.empty()) {
+					result = m_free.back();
+					m_free.pop_back();
+					m_palette[result] = std::pair<gaea::block_t, uint32_t>(block, REFERENCE_INIT);
+				} else {
+					result = m_palette.size();
+					m_palette.push_back(std::pair<gaea::block_t, uint32_t>(block, REFERENCE_INIT));
+
+					if(m_palette.size() > (1UL << m_bits)) {
+
+						for(bits = (m_bits ? m_bits : 1); (1UL << bits) < m_palette.size(); bits <<= 1);
+						resize(bits);
+					}
+				}
+
+				m_palette_index.insert(std::pair<gaea::block_t, uint32_t>(block, result));
+
+				return result;
+			}
+
+			std::string 
+			_base::as_string(
+				__in const _base &object,
+				__in_opt bool verbose
+				)
+			{
+				size_t count = 0;
+				std::stringstream result;
+				std::vector<std::pair<gaea::block_t, uint32_t>>::const_iterator iter;
+
+				result << "BITS=" << (int) object.m_bits
+					<< ", PALETTE=" << object.m_palette_index.size() << "/" << object.m_palette.size()
+					<< ", MEM=" << object.memory() << " bytes"
+					<< ", DIRTY=" << (object.m_dirty ? "true" : "false");
+
+				if(verbose) {
+
+					for(iter = object.m_palette.begin(); iter != object.m_palette.end(); ++count, ++iter) {
+
+						if(iter->second) {
+							result << std::endl << "[" << count << "] " << SCALAR_AS_HEX(gaea::block_t, iter->first)
+								<< ", REF=" << iter->second;
+						}
+					}
+				}
+
+				return result.str();
+			}
+
+			size_t 
+			_base::bits(void) const
+			{
+				return m_bits;
+			}
+
+			void 
+			_base::clear(
+				__in_opt gaea::block_t block
+				)
+			{
+				m_bits = 0;
+				m_data.clear();
+				m_free.clear();
+				m_palette.clear();
+				m_palette.push_back(std::pair<gaea::block_t, uint32_t>(block, CHUNK_VOLUME));
+				m_palette_index.clear();
+				m_palette_index.insert(std::pair<gaea::block_t, uint32_t>(block, 0));
+				m_dirty = true;
+			}
+
+			void 
+			_base::compact(void)
+			{
+				size_t iter = 0;
+				uint8_t bits = 0;
+				std::vector<uint32_t> remap;
+				gaea::engine::chunk::base result;
+
+				if(m_free.empty()) {
+					return;
+				}
+
+				remap.resize(m_palette.size(), 0);
+				result.m_palette.clear();
+				result.m_palette_index.clear();
+
+				for(; iter < m_palette.size(); ++iter) {
+
+					if(m_palette[iter].second) {
+						remap[iter] = result.m_palette.size();
+						result.m_palette_index.insert(std::pair<gaea::block_t, uint32_t>(m_palette[iter].first,
+							result.m_palette.size()));
+						result.m_palette.push_back(m_palette[iter]);
+					}
+				}
+
+				if(result.m_palette.size() > 1) {
+					for(bits = 1; (1UL << bits) < result.m_palette.size(); bits <<= 1);
+				}
+
+				result.resize(bits);
+
+				if(bits) {
+
+					for(iter = 0; iter < CHUNK_VOLUME; ++iter) {
+						result.write(iter, remap[read(iter)]);
+					}
+				}
+
+				m_bits = result.m_bits;
+				m_data.swap(result.m_data);
+				m_free.clear();
+				m_palette.swap(result.m_palette);
+				m_palette_index.swap(result.m_palette_index);
+			}
+
+			size_t 
+			_base::count(
+				__in gaea::block_t block
+				) const
+			{
+				size_t result = 0;
+				std::unordered_map<gaea::block_t, uint32_t>::const_iterator iter;
+
+				iter = m_palette_index.find(block);
+				if(iter != m_palette_index.end()) {
+					result = m_palette[iter->second].second;
+				}
+
+				return result;
+			}
+
+			void 
+			_base::deserialize(
+				__in const std::vector<gaea::block_t> &data
+				)
+			{
+				size_t iter = 0;
+				uint8_t bits = 0;
+				std::vector<uint32_t> entry;
+				gaea::block_t previous = BLOCK_INVALID;
+				uint32_t previous_entry = 0;
+				std::unordered_map<gaea::block_t, uint32_t>::iterator palette_iter;
+
+				if(data.size() != CHUNK_VOLUME) {
+					THROW_GAEA_CHUNK_EXCEPTION_FORMAT(GAEA_CHUNK_EXCEPTION_INVALID,
+						"Length=%u (expecting %u)", (uint32_t) data.size(), CHUNK_VOLUME);
+				}
+
+				entry.resize(CHUNK_VOLUME, 0);
+				m_free.clear();
+				m_palette.clear();
+				m_palette_index.clear();
+
+				for(; iter < CHUNK_VOLUME; ++iter) {
+
+					if(data[iter] != previous) {
+						previous = data[iter];
+
+						palette_iter = m_palette_index.find(previous);
+						if(palette_iter == m_palette_index.end()) {
+							palette_iter = m_palette_index.insert(std::pair<gaea::block_t, uint32_t>(previous,
+								m_palette.size())).first;
+							m_palette.push_back(std::pair<gaea::block_t, uint32_t>(previous, 0));
+						}
+
+						previous_entry = palette_iter->second;
+					}
+
+					++m_palette[previous_entry].second;
+					entry[iter] = previous_entry;
+				}
+
+				if(m_palette.size() > 1) {
+					for(bits = 1; (1UL << bits) < m_palette.size(); bits <<= 1);
+				}
+
+				m_bits = bits;
+				m_data.assign((CHUNK_VOLUME * bits) / CHUNK_WORD_WIDTH, 0);
+
+				if(m_bits) {
+
+					for(iter = 0; iter < CHUNK_VOLUME; ++iter) {
+						write(iter, entry[iter]);
+					}
+				}
+
+				m_dirty = true;
+			}
+
+			gaea::block_t 
+			_base::get(
+				__in uint32_t x,
+				__in uint32_t y,
+				__in uint32_t z
+				) const
+			{
+				return m_palette[read(index(x, y, z))].first;
+			}
+
+			gaea::block_t 
+			_base::get(
+				__in const glm::uvec3 &position
+				) const
+			{
+				return get(position.x, position.y, position.z);
+			}
+
+			size_t 
+			_base::index(
+				__in uint32_t x,
+				__in uint32_t y,
+				__in uint32_t z
+				)
+			{
+
+				if((x >= CHUNK_WIDTH) || (y >= CHUNK_WIDTH) || (z >= CHUNK_WIDTH)) {
+					THROW_GAEA_CHUNK_EXCEPTION_FORMAT(GAEA_CHUNK_EXCEPTION_INVALID,
+						"{%u, %u, %u}", x, y, z);
+				}
+
+				return ((((y << CHUNK_WIDTH_SHIFT) | z) << CHUNK_WIDTH_SHIFT) | x);
+			}
+
+			bool 
+			_base::is_dirty(void) const
+			{
+				return m_dirty;
+			}
+
+			bool 
+			_base::is_empty(void) const
+			{
+				return (count(BLOCK_AIR) == CHUNK_VOLUME);
+			}
+
+			size_t 
+			_base::memory(void) const
+			{
+				return (sizeof(*this) + (m_data.capacity() * sizeof(uint64_t))
+					+ (m_free.capacity() * sizeof(uint32_t))
+					+ (m_palette.capacity() * sizeof(std::pair<gaea::block_t, uint32_t>))
+					+ (m_palette_index.size() * (sizeof(std::pair<gaea::block_t, uint32_t>) + sizeof(void *)))
+					+ (m_palette_index.bucket_count() * sizeof(void *)));
+			}
+
+			size_t 
+			_base::palette_size(void) const
+			{
+				return m_palette_index.size();
+			}
+
+			uint32_t 
+			_base::read(
+				__in size_t index
+				) const
+			{
+				size_t offset;
+
+				if(!m_bits) {
+					return 0;
+				}
+
+				offset = (index * m_bits);
+
+				return ((m_data[offset >> CHUNK_WORD_SHIFT] >> (offset & (CHUNK_WORD_WIDTH - 1)))
+					& ((1ULL << m_bits) - 1));
+			}
+
+			void 
+			_base::release_palette(
+				__in uint32_t entry
+				)
+			{
+				std::pair<gaea::block_t, uint32_t> &palette = m_palette[entry];
+
+				if(!--palette.second) {
+					m_palette_index.erase(palette.first);
+					m_free.push_back(entry);
+				}
+			}
+
+			void 
+			_base::resize(
+				__in uint8_t bits
+				)
+			{
+				size_t iter = 0;
+				gaea::engine::chunk::base result;
+
+				if(bits > CHUNK_BITS_MAX) {
+					THROW_GAEA_CHUNK_EXCEPTION_FORMAT(GAEA_CHUNK_EXCEPTION_INVALID,
+						"Bits=%u (must be <=%u)", bits, CHUNK_BITS_MAX);
+				}
+
+				if(bits == m_bits) {
+					return;
+				}
+
+				result.m_bits = bits;
+				result.m_data.resize((CHUNK_VOLUME * bits) / CHUNK_WORD_WIDTH, 0);
+
+				if(m_bits && bits) {
+
+					for(; iter < CHUNK_VOLUME; ++iter) {
+						result.write(iter, read(iter));
+					}
+				}
+
+				m_bits = result.m_bits;
+				m_data.swap(result.m_data);
+			}
+
+			void 
+			_base::serialize(
+				__out std::vector<gaea::block_t> &data
+				) const
+			{
+				size_t iter = 0;
+
+				data.resize(CHUNK_VOLUME, BLOCK_AIR);
+
+				for(; iter < CHUNK_VOLUME; ++iter) {
+					data[iter] = m_palette[read(iter)].first;
+				}
+			}
+
+			void 
+			_base::set(
+				__in uint32_t x,
+				__in uint32_t y,
+				__in uint32_t z,
+				__in gaea::block_t block
+				)
+			{
+				uint32_t entry;
+				size_t position = index(x, y, z);
+
+				entry = read(position);
+				if(m_palette[entry].first != block) {
+					write(position, acquire_palette(block));
+					release_palette(entry);
+					m_dirty = true;
+				}
+			}
+
+			void 
+			_base::set(
+				__in const glm::uvec3 &position,
+				__in gaea::block_t block
+				)
+			{
+				set(position.x, position.y, position.z, block);
+			}
+
+			void 
+			_base::set_dirty(
+				__in_opt bool dirty
+				)
+			{
+				m_dirty = dirty;
+			}
+
+			std::string 
+			_base::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::engine::chunk::base::as_string(*this, verbose);
+			}
+
+			void 
+			_base::write(
+				__in size_t index,
+				__in uint32_t entry
+				)
+			{
+				size_t offset;
+				uint64_t mask;
+
+				if(m_bits) {
+					offset = (index * m_bits);
+					mask = (((1ULL << m_bits) - 1) << (offset & (CHUNK_WORD_WIDTH - 1)));
+					uint64_t &word = m_data[offset >> CHUNK_WORD_SHIFT];
+					word = ((word & ~mask) | (((uint64_t) entry << (offset & (CHUNK_WORD_WIDTH - 1))) & mask));
+				}
+			}
+		}
+	}
+}
@@ -26,14 +26,40 @@ namespace gaea {
 
 		namespace entity {
 
+			#define ENTITY_INTERPOLATE_MIN 1e-6f
 			#define ENTITY_STRING(_TYPE_) \
 				((_TYPE_) > ENTITY_MAX ? STRING_UNKNOWN : \
 				STRING_CHECK(ENTITY_STR[_TYPE_]))
 
 			static const std::string ENTITY_STR[] = {
-				"CAMERA", "SURFACE",
+				"CAMERA", "SURFACE", "CHUNK",
 				};
 
+			gaea::engine::entity::transform_t 
+			interpolate(
+				__in const gaea::engine::entity::transform_t &previous,
+				__in const gaea::engine::entity::transform_t &current,
+				__in GLfloat alpha
+				)
+			{
+				gaea::engine::entity::transform_t result;
+
+				alpha = glm::clamp(alpha, 0.f, 1.f);
+				result.position = glm::mix(previous.position, current.position, (double) alpha);
+				result.rotation = glm::mix(previous.rotation, current.rotation, alpha);
+				result.up = glm::mix(previous.up, current.up, alpha);
+
+				if(glm::dot(result.rotation, result.rotation) <= ENTITY_INTERPOLATE_MIN) {
+					result.rotation = current.rotation;
+				}
+
+				if(glm::dot(result.up, result.up) <= ENTITY_INTERPOLATE_MIN) {
+					result.up = current.up;
+				}
+
+				return result;
+			}
+
 			_base::_base(
 				__in gaea::entity_t type,
 				__in_opt uint32_t specifier,
@@ -145,12 +171,62 @@ namespace gaea {
 				}
 			}
 
+			bool 
+			_base::bounds(
+				__in const glm::dvec3 &position,
+				__out gaea::engine::occlusion::box_t &box
+				)
+			{
+				return false;
+			}
+
+			bool 
+			_base::capture(
+				__out gaea::engine::entity::transform_t &previous,
+				__out gaea::engine::entity::transform_t &current
+				)
+			{
+				return false;
+			}
+
+			bool 
+			_base::is_occluded(void)
+			{
+				return false;
+			}
+
 			bool 
 			_base::is_visible(void)
 			{
 				return m_visible;
 			}
 
+			void 
+			_base::present(
+				__in const gaea::engine::entity::transform_t &previous,
+				__in const gaea::engine::entity::transform_t &current,
+				__in GLfloat alpha
+				)
+			{
+				return;
+			}
+
+			void 
+			_base::query(
+				__in const glm::dvec3 &position,
+				__in const glm::mat4 &projection,
+				__in const glm::mat4 &view
+				)
+			{
+				return;
+			}
+
+			void 
+			_base::snapshot(void)
+			{
+				return;
+			}
+
 			uint32_t 
 			_base::specifier(void)
 			{
@@ -182,24 +258,33 @@ namespace gaea {
 			_base_position::_base_position(
 				__in gaea::entity_t type,
 				__in_opt uint32_t specifier,
-				__in_opt const glm::vec3 &position,
+				__in_opt const glm::dvec3 &position,
 				__in_opt const glm::vec3 &rotation,
 				__in_opt const glm::vec3 &up,
 				__in_opt bool visible
 				) :
 					gaea::engine::entity::base(type, specifier, visible),
+					m_alpha(ENTITY_ALPHA_INIT),
 					m_position(position),
 					m_rotation(rotation),
 					m_up(up)
 			{
-				return;
+				m_previous.position = position;
+				m_previous.rotation = rotation;
+				m_previous.up = up;
+				m_frame_current = m_previous;
+				m_frame_previous = m_previous;
 			}
 
 			_base_position::_base_position(
 				__in const _base_position &other
 				) :
 					gaea::engine::entity::base(other),
+					m_alpha(other.m_alpha),
+					m_frame_current(other.m_frame_current),
+					m_frame_previous(other.m_frame_previous),
 					m_position(other.m_position),
+					m_previous(other.m_previous),
 					m_rotation(other.m_rotation),
 					m_up(other.m_up)
 			{
@@ -219,7 +304,11 @@ namespace gaea {
 
 				if(this != &other) {
 					gaea::engine::entity::base::operator=(other);
+					m_alpha = other.m_alpha;
+					m_frame_current = other.m_frame_current;
+					m_frame_previous = other.m_frame_previous;
 					m_position = other.m_position;
+					m_previous = other.m_previous;
 					m_rotation = other.m_rotation;
 					m_up = other.m_up;
 				}
@@ -243,18 +332,58 @@ namespace gaea {
 				return result.str();
 			}
 
-			glm::vec3 &
+			bool 
+			_base_position::capture(
+				__out gaea::engine::entity::transform_t &previous,
+				__out gaea::engine::entity::transform_t &current
+				)
+			{
+				previous = m_previous;
+				current.position = m_position;
+				current.rotation = m_rotation;
+				current.up = m_up;
+
+				return true;
+			}
+
+			gaea::engine::entity::transform_t 
+			_base_position::interpolated(void)
+			{
+				return gaea::engine::entity::interpolate(m_frame_previous, m_frame_current, m_alpha);
+			}
+
+			glm::dvec3 &
 			_base_position::position(void)
 			{
 				return m_position;
 			}
 
+			void 
+			_base_position::present(
+				__in const gaea::engine::entity::transform_t &previous,
+				__in const gaea::engine::entity::transform_t &current,
+				__in GLfloat alpha
+				)
+			{
+				m_alpha = alpha;
+				m_frame_current = current;
+				m_frame_previous = previous;
+			}
+
 			glm::vec3 &
 			_base_position::rotation(void)
 			{
 				return m_rotation;
 			}
 
+			void 
+			_base_position::snapshot(void)
+			{
+				m_previous.position = m_position;
+				m_previous.rotation = m_rotation;
+				m_previous.up = m_up;
+			}
+
 			std::string 
 			_base_position::to_string(
 				__in_opt bool verbose
@@ -272,7 +401,7 @@ namespace gaea {
 			_base_model::_base_model(
 				__in gaea::entity_t type,
 				__in_opt uint32_t specifier,
-				__in_opt const glm::vec3 &position,
+				__in_opt const glm::dvec3 &position,
 				__in_opt const glm::vec3 &rotation,
 				__in_opt const glm::vec3 &up,
 				__in_opt GLuint model_id,
@@ -363,9 +492,15 @@ namespace gaea {
 			}
 
 			void 
-			_base_model::update_model(void)
+			_base_model::update_model(
+				__in_opt const glm::dvec3 &position
+				)
 			{
-				m_model = glm::lookAt(m_position, m_position + m_rotation, m_up);
+				glm::vec3 relative;
+				gaea::engine::entity::transform_t transform = interpolated();
+
+				relative = glm::vec3(transform.position - position);
+				m_model = glm::lookAt(relative, relative + transform.rotation, transform.up);
 			}
 
 			GLint &
@@ -377,8 +512,11 @@ namespace gaea {
 			_manager *_manager::m_instance = nullptr;
 
 			_manager::_manager(void) :
-				m_initialized(false)
+				m_drawn(0),
+				m_initialized(false),
+				m_occluded(0)
 			{
+				gaea::engine::pool::manager::acquire();
 				std::atexit(gaea::engine::entity::manager::_delete);
 			}
 
@@ -414,7 +552,36 @@ namespace gaea {
 			void 
 			_manager::clear(void)
 			{
+				m_drawn = 0;
 				m_entry.clear();
+				m_occluded = 0;
+			}
+
+			void 
+			_manager::capture(
+				__out std::vector<gaea::engine::entity::snapshot_t> &snapshot
+				)
+			{
+				size_t iter = 0;
+				gaea::engine::entity::snapshot_t entry;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator entry_iter;
+
+				for(; iter < m_entry.size(); ++iter) {
+
+					if((iter == ENTITY_CAMERA) || (iter == ENTITY_CHUNK)) {
+						continue;
+					}
+
+					for(entry_iter = m_entry.at(iter).begin(); entry_iter != m_entry.at(iter).end();
+							++entry_iter) {
+
+						if(entry_iter->second.first.capture(entry.previous, entry.current)) {
+							entry.id = entry_iter->first;
+							entry.type = (gaea::entity_t) iter;
+							snapshot.push_back(entry);
+						}
+					}
+				}
 			}
 
 			bool 
@@ -443,7 +610,7 @@ namespace gaea {
 				)
 			{
 				size_t result = 0;
-				std::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator iter;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator iter;
 
 				iter = find(id, type);
 				if(iter->second.second <= REFERENCE_INIT) {
@@ -455,13 +622,24 @@ namespace gaea {
 				return result;
 			}
 
-			std::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator 
+			size_t 
+			_manager::drawn(void)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_ENTITY_EXCEPTION(GAEA_ENTITY_EXCEPTION_UNINITIALIZED);
+				}
+
+				return m_drawn;
+			}
+
+			gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator 
 			_manager::find(
 				__in gaea::uid_t id,
 				__in gaea::entity_t type
 				)
 			{
-				std::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator result;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator result;
 
 				if(!m_initialized) {
 					THROW_GAEA_ENTITY_EXCEPTION(GAEA_ENTITY_EXCEPTION_UNINITIALIZED);
@@ -527,7 +705,7 @@ namespace gaea {
 				}
 
 				m_entry.resize(ENTITY_MAX + 1,
-					std::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>());
+					gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>());
 				m_initialized = true;
 			}
 
@@ -543,6 +721,39 @@ namespace gaea {
 				return m_initialized;
 			}
 
+			size_t 
+			_manager::occluded(void)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_ENTITY_EXCEPTION(GAEA_ENTITY_EXCEPTION_UNINITIALIZED);
+				}
+
+				return m_occluded;
+			}
+
+			void 
+			_manager::present(
+				__in const std::vector<gaea::engine::entity::snapshot_t> &snapshot,
+				__in GLfloat alpha
+				)
+			{
+				std::vector<gaea::engine::entity::snapshot_t>::const_iterator iter;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator entry_iter;
+
+				for(iter = snapshot.begin(); iter != snapshot.end(); ++iter) {
+
+					if(iter->type >= m_entry.size()) {
+						continue;
+					}
+
+					entry_iter = m_entry.at(iter->type).find(iter->id);
+					if(entry_iter != m_entry.at(iter->type).end()) {
+						entry_iter->second.first.present(iter->previous, iter->current, alpha);
+					}
+				}
+			}
+
 			size_t 
 			_manager::reference_count(
 				__in gaea::uid_t id,
@@ -554,7 +765,7 @@ namespace gaea {
 
 			void 
 			_manager::render(
-				__in const glm::vec3 &position,
+				__in const glm::dvec3 &position,
 				__in const glm::vec3 &rotation,
 				__in const glm::vec3 &up,
 				__in const glm::mat4 &projection,
@@ -562,7 +773,13 @@ namespace gaea {
 				)
 			{
 				size_t iter = 0;
-				std::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator entry_iter;
+				gaea::engine::occlusion::box_t box;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator entry_iter;
+				gaea::engine::occlusion::manager &occlusion = gaea::engine::occlusion::manager::acquire();
+				bool culling = occlusion.is_initialized();
+
+				m_drawn = 0;
+				m_occluded = 0;
 
 				for(; iter < m_entry.size(); ++iter) {
 
@@ -575,10 +792,39 @@ namespace gaea {
 
 						gaea::engine::entity::base &object = entry_iter->second.first;
 						if(object.is_visible()) {
-							object.render(position, rotation, up, projection, view);
+
+							if((culling && object.bounds(position, box) && !occlusion.visible(box))
+									|| object.is_occluded()) {
+								++m_occluded;
+							} else {
+								object.render(position, rotation, up, projection, view);
+								++m_drawn;
+							}
+						}
+					}
+				}
+
+				GL_CHECK(glColorMask, GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+				GL_CHECK(glDepthMask, GL_FALSE);
+
+				for(iter = 0; iter < m_entry.size(); ++iter) {
+
+					if(iter == ENTITY_CAMERA) {
+						continue;
+					}
+
+					for(entry_iter = m_entry.at(iter).begin(); entry_iter != m_entry.at(iter).end();
+							++entry_iter) {
+
+						gaea::engine::entity::base &object = entry_iter->second.first;
+						if(object.is_visible()) {
+							object.query(position, projection, view);
 						}
 					}
 				}
+
+				GL_CHECK(glDepthMask, GL_TRUE);
+				GL_CHECK(glColorMask, GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 			}
 
 			size_t 
@@ -614,13 +860,15 @@ namespace gaea {
 			{
 				size_t count, iter = 0;
 				std::stringstream result;
-				std::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator entry_iter;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator entry_iter;
 
 				result << GAEA_ENTITY_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
 
 				if(m_initialized) {
 					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
-						<< ", ENTRIES=" << size();
+						<< ", ENTRIES=" << size()
+						<< ", DRAWN=" << m_drawn
+						<< ", OCCLUDED=" << m_occluded;
 
 					if(verbose) {
 
@@ -659,12 +907,17 @@ namespace gaea {
 				)
 			{
 				size_t iter = 0;
-				std::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator entry_iter;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::entity::base &, size_t>>::iterator entry_iter;
 
 				for(; iter < m_entry.size(); ++iter) {
 
+					if(iter == ENTITY_CHUNK) {
+						continue;
+					}
+
 					for(entry_iter = m_entry.at(iter).begin(); entry_iter != m_entry.at(iter).end();
 							++entry_iter) {
+						entry_iter->second.first.snapshot();
 						entry_iter->second.first.update(delta);
 					}
 				}
@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cmath>
 #include "../../include/gaea.h"
 #include "gaea_event_type.h"
 
@@ -26,6 +28,9 @@ namespace gaea {
 
 		namespace event {
 
+			#define EVENT_PERCENTILE_MEDIAN 0.50
+			#define EVENT_PERCENTILE_TAIL 0.99
+
 			#define REFERENCE_OFFSET 3
 
 			#define EVENT_CAMERA_STRING(_TYPE_) \
@@ -42,15 +47,20 @@ namespace gaea {
 				};
 
 			static const std::string EVENT_INPUT_STR[] = {
-				"BUTTON", "KEY", "MOTION", "WHEEL",
+				"BUTTON", "KEY", "MOTION", "WHEEL", "CONTROLLER AXIS", "CONTROLLER BUTTON",
 				};
 
+			static_assert((sizeof(EVENT_INPUT_STR) / sizeof(EVENT_INPUT_STR[0])) == (EVENT_INPUT_MAX + 1),
+				"EVENT_INPUT_STR must name every input specifier");
+
 			void 
 			notify(
 				__in gaea::event_t type,
 				__in_opt uint32_t specifier,
 				__in_opt void *context,
-				__in_opt size_t length
+				__in_opt size_t length,
+				__in_opt gaea::event_priority_t priority,
+				__in_opt uint64_t timeout
 				)
 			{
 
@@ -58,9 +68,30 @@ namespace gaea {
 
 					gaea::engine::event::manager &instance = gaea::engine::event::manager::acquire();
 					if(instance.is_initialized()) {
-						instance.generate(type, specifier, context, length);
+						instance.generate(type, specifier, context, length, priority, timeout);
+					}
+				}
+			}
+
+			static uint64_t 
+			percentile(
+				__in const gaea::engine::event::statistic_t &statistic,
+				__in double fraction
+				)
+			{
+				size_t iter = 0;
+				uint64_t count = 0, target;
+
+				target = (uint64_t) std::ceil(statistic.count * fraction);
+				for(; iter < EVENT_HISTOGRAM_COUNT; ++iter) {
+
+					count += statistic.histogram[iter];
+					if(count && (count >= target)) {
+						return (iter ? (1ULL << iter) : 0);
 					}
 				}
+
+				return 0;
 			}
 
 			_base::_base(
@@ -211,8 +242,10 @@ namespace gaea {
 			_manager *_manager::m_instance = nullptr;
 
 			_manager::_manager(void) :
+				m_dispatch(0),
 				m_initialized(false)
 			{
+				gaea::engine::pool::manager::acquire();
 				std::atexit(gaea::engine::event::manager::_delete);
 			}
 
@@ -234,9 +267,13 @@ namespace gaea {
 			void 
 			_manager::_thread(void)
 			{
-				size_t iter, count[EVENT_MAX + 1], total;
-				std::set<std::pair<gaea::engine::event::handler_cb, void *>>::iterator handler_iter;
-				std::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator event_iter;
+				uint64_t latency, time;
+				size_t bucket, priority;
+				gaea::engine::event::base *event;
+				gaea::engine::event::manager::queue_t entry;
+				gaea::engine::event::handler_list_t::const_iterator handler_iter;
+				std::shared_ptr<const gaea::engine::event::handler_list_t> handler;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator event_iter;
 
 				if(gaea::engine::event::manager::is_allocated()) {
 
@@ -244,40 +281,62 @@ namespace gaea {
 					while(instance.is_initialized()) {
 						instance.m_signal.wait();
 
-						if(!instance.is_initialized()) {
-							break;
-						}
-
 						while(instance.is_initialized()) {
-							total = 0;
-
-							for(iter = 0; iter <= EVENT_MAX; ++iter) {
-								count[iter] = instance.m_event_queue.at(iter).size();
-								total += count[iter];
+							event = nullptr;
+
+							instance.m_lock.lock();
+							time = gaea::engine::profile::now();
+
+							for(priority = 0; !event && (priority <= EVENT_PRIORITY_MAX); ++priority) {
+
+								std::queue<gaea::engine::event::manager::queue_t> &queue = instance.m_event_queue.at(priority);
+								while(!event && !queue.empty()) {
+									entry = queue.front();
+									queue.pop();
+
+									event_iter = instance.m_event.at(entry.type).find(entry.id);
+									if(event_iter == instance.m_event.at(entry.type).end()) {
+										continue;
+									}
+
+									gaea::engine::event::statistic_t &statistic = instance.m_statistic.at(priority);
+									if(entry.expire && (time > entry.expire)) {
+										instance.m_event.at(entry.type).erase(event_iter);
+										++statistic.dropped;
+										continue;
+									}
+
+									latency = ((time > entry.time) ? (time - entry.time) : 0);
+									bucket = (latency ? (64 - __builtin_clzll(latency)) : 0);
+									++statistic.histogram[std::min(bucket, (size_t) (EVENT_HISTOGRAM_COUNT - 1))];
+									statistic.maximum = std::max(statistic.maximum, latency);
+									++statistic.count;
+
+									// the dispatch reference keeps the event alive while handlers run unlocked
+									event = &event_iter->second.first;
+									++event_iter->second.second;
+								}
 							}
 
-							if(!total) {
+							instance.m_lock.unlock();
+
+							if(!event) {
 								break;
 							}
 
-							for(iter = 0; iter <= EVENT_MAX; ++iter) {
+							++instance.m_dispatch;
+							handler = std::atomic_load(&instance.m_handler.at(entry.type));
 
-								if(!count[iter]) {
-									continue;
-								}
-
-								std::lock_guard<std::recursive_mutex> lock(instance.m_lock);
-								event_iter = instance.m_event.at(iter).find(instance.m_event_queue.at(iter).front());
+							for(handler_iter = handler->begin(); handler_iter != handler->end(); ++handler_iter) {
+								(*(handler_iter->first))(*event, handler_iter->second);
+							}
 
-								for(handler_iter = instance.m_handler.at(iter).begin(); 
-										handler_iter != instance.m_handler.at(iter).end();
-										++handler_iter) {
-									(*(handler_iter->first))(event_iter->second.first, handler_iter->second);
-								}
+							handler.reset();
+							++instance.m_dispatch;
 
-								instance.m_event.at(iter).erase(event_iter);
-								instance.m_event_queue.at(iter).pop();
-							}
+							instance.m_lock.lock();
+							instance.m_event.at(entry.type).erase(entry.id);
+							instance.m_lock.unlock();
 						}
 					}
 				}
@@ -304,6 +363,8 @@ namespace gaea {
 				m_event.clear();
 				m_event_queue.clear();
 				m_handler.clear();
+				m_priority.clear();
+				m_statistic.clear();
 			}
 
 			bool 
@@ -349,8 +410,10 @@ namespace gaea {
 						"%p", handler);
 				}
 
-				return (m_handler.at(type).find(std::pair<gaea::engine::event::handler_cb, void *>(handler, context)) 
-						!= m_handler.at(type).end());
+				std::shared_ptr<const gaea::engine::event::handler_list_t> list = std::atomic_load(&m_handler.at(type));
+
+				return (std::find(list->begin(), list->end(), std::pair<gaea::engine::event::handler_cb, void *>(
+					handler, context)) != list->end());
 			}
 
 			size_t 
@@ -360,7 +423,7 @@ namespace gaea {
 				)
 			{
 				size_t result = 0;
-				std::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator iter;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator iter;
 
 				std::lock_guard<std::recursive_mutex> lock(m_lock);
 
@@ -374,13 +437,13 @@ namespace gaea {
 				return result;
 			}
 
-			std::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator 
+			gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator 
 			_manager::find_event(
 				__in gaea::uid_t id,
 				__in gaea::event_t type
 				)
 			{
-				std::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator result;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator result;
 
 				std::lock_guard<std::recursive_mutex> lock(m_lock);
 
@@ -402,31 +465,19 @@ namespace gaea {
 				return result;
 			}
 
-			std::set<std::pair<gaea::engine::event::handler_cb, void *>>::iterator 
+			gaea::engine::event::handler_list_t::const_iterator 
 			_manager::find_handler(
+				__in const gaea::engine::event::handler_list_t &list,
 				__in gaea::engine::event::handler_cb handler,
 				__in gaea::event_t type,
 				__in_opt void *context
 				)
 			{
-				std::set<std::pair<gaea::engine::event::handler_cb, void *>>::iterator result;
-
-				if(!m_initialized) {
-					THROW_GAEA_EVENT_EXCEPTION(GAEA_EVENT_EXCEPTION_UNINITIALIZED);
-				}
+				gaea::engine::event::handler_list_t::const_iterator result;
 
-				if(type >= m_handler.size()) {
-					THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_INVALID_TYPE,
-						"%x", type);
-				}
-
-				if(!handler) {
-					THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_INVALID_HANDLER,
-						"%p", handler);
-				}
-
-				result = m_handler.at(type).find(std::pair<gaea::engine::event::handler_cb, void *>(handler, context));
-				if(result == m_handler.at(type).end()) {
+				result = std::find(list.begin(), list.end(), std::pair<gaea::engine::event::handler_cb, void *>(
+					handler, context));
+				if(result == list.end()) {
 					THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_HANDLER_NOT_FOUND,
 						"[%s (%x)] %p(%p)", EVENT_STRING(type), type, handler, context);
 				}
@@ -439,12 +490,15 @@ namespace gaea {
 				__in gaea::event_t type,
 				__in_opt uint32_t specifier,
 				__in_opt void *context,
-				__in_opt size_t length
+				__in_opt size_t length,
+				__in_opt gaea::event_priority_t priority,
+				__in_opt uint64_t timeout
 				)
 			{
+				uint64_t time;
 				std::vector<uint8_t> data;
 				gaea::uid_t result = UID_INVALID;
-				std::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator iter;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator iter;
 
 				std::lock_guard<std::recursive_mutex> lock(m_lock);
 
@@ -457,7 +511,14 @@ namespace gaea {
 						"%x", type);
 				}
 
-				if(!m_handler.at(type).empty()) {
+				if(priority == EVENT_PRIORITY_TYPE) {
+					priority = m_priority.at(type);
+				} else if(priority > EVENT_PRIORITY_MAX) {
+					THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_INVALID_PRIORITY,
+						"%x", priority);
+				}
+
+				if(!std::atomic_load(&m_handler.at(type))->empty()) {
 
 					if((!context && length) || (context && !length)) {
 						THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_INVALID_CONTEXT,
@@ -475,7 +536,9 @@ namespace gaea {
 
 					m_event.at(type).insert(std::pair<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>(result, 
 						std::pair<gaea::engine::event::base, size_t>(entry, REFERENCE_INIT + REFERENCE_OFFSET)));
-					m_event_queue.at(type).push(result);
+					time = gaea::engine::profile::now();
+					m_event_queue.at(priority).push({ (timeout != EVENT_TIMEOUT_NONE) ? (time + timeout) : 0, 
+						result, time, type });
 					m_signal.notify();
 				}
 
@@ -499,9 +562,11 @@ namespace gaea {
 					THROW_GAEA_EVENT_EXCEPTION(GAEA_EVENT_EXCEPTION_INITIALIZED);
 				}
 
-				m_event.resize(EVENT_MAX + 1, std::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>());
-				m_event_queue.resize(EVENT_MAX + 1, std::queue<gaea::uid_t>());
-				m_handler.resize(EVENT_MAX + 1, std::set<std::pair<gaea::engine::event::handler_cb, void *>>());
+				m_event.resize(EVENT_MAX + 1, gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>());
+				m_event_queue.resize(EVENT_PRIORITY_COUNT, std::queue<gaea::engine::event::manager::queue_t>());
+				m_handler.resize(EVENT_MAX + 1, std::make_shared<const gaea::engine::event::handler_list_t>());
+				m_priority.assign(EVENT_PRIORITY_INIT, EVENT_PRIORITY_INIT + EVENT_MAX + 1);
+				m_statistic.resize(EVENT_PRIORITY_COUNT, gaea::engine::event::statistic_t());
 				m_initialized = true;
 				m_thread = std::thread(gaea::engine::event::manager::_thread);
 			}
@@ -518,6 +583,26 @@ namespace gaea {
 				return m_initialized;
 			}
 
+			gaea::event_priority_t 
+			_manager::priority(
+				__in gaea::event_t type
+				)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_EVENT_EXCEPTION(GAEA_EVENT_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				if(type >= m_priority.size()) {
+					THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_INVALID_TYPE,
+						"%x", type);
+				}
+
+				return m_priority.at(type);
+			}
+
 			size_t 
 			_manager::reference_count(
 				__in gaea::uid_t id,
@@ -534,7 +619,7 @@ namespace gaea {
 				__in_opt void *context
 				)
 			{
-				std::set<std::pair<gaea::engine::event::handler_cb, void *>>::iterator iter;
+				std::shared_ptr<gaea::engine::event::handler_list_t> list;
 
 				if(!m_initialized) {
 					THROW_GAEA_EVENT_EXCEPTION(GAEA_EVENT_EXCEPTION_UNINITIALIZED);
@@ -550,13 +635,68 @@ namespace gaea {
 						"%p", handler);
 				}
 
-				iter = m_handler.at(type).find(std::pair<gaea::engine::event::handler_cb, void *>(handler, context));
-				if(iter != m_handler.at(type).end()) {
+				std::lock_guard<std::mutex> lock(m_handler_lock);
+
+				list = std::make_shared<gaea::engine::event::handler_list_t>(*std::atomic_load(&m_handler.at(type)));
+				if(std::find(list->begin(), list->end(), std::pair<gaea::engine::event::handler_cb, void *>(
+						handler, context)) != list->end()) {
 					THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_DUPLICATE_HANDLER, "[%s (%x)] %p(%p)", 
 						EVENT_STRING(type), type, handler, context);
 				}
 
-				m_handler.at(type).insert(std::pair<gaea::engine::event::handler_cb, void *>(handler, context));
+				list->push_back(std::pair<gaea::engine::event::handler_cb, void *>(handler, context));
+				std::atomic_store(&m_handler.at(type), std::shared_ptr<const gaea::engine::event::handler_list_t>(list));
+			}
+
+			void 
+			_manager::set_priority(
+				__in gaea::event_t type,
+				__in gaea::event_priority_t priority
+				)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_EVENT_EXCEPTION(GAEA_EVENT_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				if(type >= m_priority.size()) {
+					THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_INVALID_TYPE,
+						"%x", type);
+				}
+
+				if(priority > EVENT_PRIORITY_MAX) {
+					THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_INVALID_PRIORITY,
+						"%x", priority);
+				}
+
+				m_priority.at(type) = priority;
+			}
+
+			gaea::engine::event::statistic_t 
+			_manager::statistic(
+				__in gaea::event_priority_t priority
+				)
+			{
+				gaea::engine::event::statistic_t result;
+
+				if(!m_initialized) {
+					THROW_GAEA_EVENT_EXCEPTION(GAEA_EVENT_EXCEPTION_UNINITIALIZED);
+				}
+
+				if(priority > EVENT_PRIORITY_MAX) {
+					THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_INVALID_PRIORITY,
+						"%x", priority);
+				}
+
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				result = m_statistic.at(priority);
+				result.p50 = gaea::engine::event::percentile(result, EVENT_PERCENTILE_MEDIAN);
+				result.p99 = gaea::engine::event::percentile(result, EVENT_PERCENTILE_TAIL);
+
+				return result;
 			}
 
 			std::string 
@@ -566,8 +706,9 @@ namespace gaea {
 			{
 				size_t count, iter = 0;
 				std::stringstream result;
-				std::set<std::pair<gaea::engine::event::handler_cb, void *>>::iterator handler_iter;
-				std::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator event_iter;
+				std::shared_ptr<const gaea::engine::event::handler_list_t> handler;
+				gaea::engine::event::handler_list_t::const_iterator handler_iter;
+				gaea::engine::pool::map<gaea::uid_t, std::pair<gaea::engine::event::base, size_t>>::iterator event_iter;
 
 				std::lock_guard<std::recursive_mutex> lock(m_lock);
 
@@ -576,19 +717,32 @@ namespace gaea {
 				if(m_initialized) {
 					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this);
 
+					for(iter = 0; iter <= EVENT_PRIORITY_MAX; ++iter) {
+						const gaea::engine::event::statistic_t &statistic = m_statistic.at(iter);
+
+						result << std::endl << "[" << EVENT_PRIORITY_STRING(iter) << "]"
+							<< "[QUE=" << m_event_queue.at(iter).size()
+							<< ", CNT=" << statistic.count
+							<< ", DROP=" << statistic.dropped
+							<< ", P50=" << gaea::engine::event::percentile(statistic, EVENT_PERCENTILE_MEDIAN) << " ns"
+							<< ", P99=" << gaea::engine::event::percentile(statistic, EVENT_PERCENTILE_TAIL) << " ns"
+							<< ", MAX=" << statistic.maximum << " ns]";
+					}
+
 					if(verbose) {
 
-						for(; iter <= EVENT_MAX; ++iter) {
+						for(iter = 0; iter <= EVENT_MAX; ++iter) {
 
-							if(m_event.at(iter).empty() && m_handler.at(iter).empty()) {
+							handler = std::atomic_load(&m_handler.at(iter));
+							if(m_event.at(iter).empty() && handler->empty()) {
 								continue;
 							}
 
 							result << std::endl << "[" << EVENT_STRING(iter) 
 								<< " (" << SCALAR_AS_HEX(gaea::event_t, iter) << ")]"
 								<< "[EVT=" << m_event.at(iter).size()
-								<< ", QUE=" << m_event_queue.at(iter).size()
-								<< ", HLD=" << m_handler.at(iter).size() << "]";
+								<< ", PRI=" << EVENT_PRIORITY_STRING(m_priority.at(iter))
+								<< ", HLD=" << handler->size() << "]";
 
 							for(count = 0, event_iter = m_event.at(iter).begin(); event_iter != m_event.at(iter).end();
 									++count, ++event_iter) {
@@ -597,8 +751,7 @@ namespace gaea {
 									<< ", REF=" << event_iter->second.second;
 							}
 
-							for(count = 0, handler_iter = m_handler.at(iter).begin(); 
-									handler_iter != m_handler.at(iter).end();
+							for(count = 0, handler_iter = handler->begin(); handler_iter != handler->end();
 									++count, ++handler_iter) {
 								result << std::endl << "[" << count << "]"
 									<< " HDL=" << SCALAR_AS_HEX(uintptr_t, handler_iter->first)
@@ -634,7 +787,7 @@ namespace gaea {
 				__in_opt void *context
 				)
 			{
-				std::set<std::pair<gaea::engine::event::handler_cb, void *>>::iterator iter;
+				std::shared_ptr<gaea::engine::event::handler_list_t> list;
 
 				if(!m_initialized) {
 					THROW_GAEA_EVENT_EXCEPTION(GAEA_EVENT_EXCEPTION_UNINITIALIZED);
@@ -645,7 +798,33 @@ namespace gaea {
 						"%x", type);
 				}
 
-				m_handler.at(type).erase(find_handler(handler, type, context));
+				if(!handler) {
+					THROW_GAEA_EVENT_EXCEPTION_FORMAT(GAEA_EVENT_EXCEPTION_INVALID_HANDLER,
+						"%p", handler);
+				}
+
+				std::unique_lock<std::mutex> lock(m_handler_lock);
+
+				list = std::make_shared<gaea::engine::event::handler_list_t>(*std::atomic_load(&m_handler.at(type)));
+				list->erase(find_handler(*list, handler, type, context));
+				std::atomic_store(&m_handler.at(type), std::shared_ptr<const gaea::engine::event::handler_list_t>(list));
+				lock.unlock();
+
+				// a running handler may need the handler lock itself, so wait after releasing it
+				wait_dispatch();
+			}
+
+			void 
+			_manager::wait_dispatch(void)
+			{
+				uint64_t epoch = m_dispatch;
+
+				if((epoch & 1) && (std::this_thread::get_id() != m_thread.get_id())) {
+
+					while(m_dispatch == epoch) {
+						std::this_thread::yield();
+					}
+				}
 			}
 		}
 	}
@@ -41,6 +41,7 @@ namespace gaea {
 				GAEA_EVENT_EXCEPTION_INITIALIZED,
 				GAEA_EVENT_EXCEPTION_INVALID_CONTEXT,
 				GAEA_EVENT_EXCEPTION_INVALID_HANDLER,
+				GAEA_EVENT_EXCEPTION_INVALID_PRIORITY,
 				GAEA_EVENT_EXCEPTION_INVALID_TYPE,
 				GAEA_EVENT_EXCEPTION_REGISTERED,
 				GAEA_EVENT_EXCEPTION_TYPE_NOT_FOUND,
@@ -57,6 +58,7 @@ namespace gaea {
 				GAEA_EVENT_EXCEPTION_HEADER "Event manager is initialized",
 				GAEA_EVENT_EXCEPTION_HEADER "Invalid event context",
 				GAEA_EVENT_EXCEPTION_HEADER "Invalid event handler",
+				GAEA_EVENT_EXCEPTION_HEADER "Invalid event priority",
 				GAEA_EVENT_EXCEPTION_HEADER "Event handler is registered",
 				GAEA_EVENT_EXCEPTION_HEADER "Invalid event type",
 				GAEA_EVENT_EXCEPTION_HEADER "Event type does not exist",
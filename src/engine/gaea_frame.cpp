@@ -0,0 +1,141 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/gaea.h"
+#include "gaea_frame_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace frame {
+
+			enum {
+				FRAME_BACK = 0,
+				FRAME_READY,
+				FRAME_FRONT,
+			};
+
+			_buffer::_buffer(void) :
+				m_acquired(0),
+				m_back(FRAME_BACK),
+				m_fresh(false),
+				m_front(FRAME_FRONT),
+				m_packet(FRAME_BUFFER_COUNT),
+				m_published(0),
+				m_ready(FRAME_READY)
+			{
+				return;
+			}
+
+			_buffer::~_buffer(void)
+			{
+				return;
+			}
+
+			bool 
+			_buffer::acquire(void)
+			{
+				bool result;
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				result = m_fresh;
+				if(result) {
+					std::swap(m_front, m_ready);
+					m_fresh = false;
+					++m_acquired;
+				}
+
+				return result;
+			}
+
+			std::string 
+			_buffer::as_string(
+				__in const _buffer &object,
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << GAEA_FRAME_HEADER << " PUB=" << object.m_published
+					<< ", ACQ=" << object.m_acquired
+					<< ", DROP=" << (object.m_published - object.m_acquired);
+
+				if(verbose) {
+					result << ", IDX={" << object.m_back << ", " << object.m_ready << ", " << object.m_front << "}"
+						<< ", " << (object.m_fresh ? "FRESH" : "STALE");
+				}
+
+				return result.str();
+			}
+
+			gaea::engine::frame::packet_t &
+			_buffer::back(void)
+			{
+				return m_packet.at(m_back);
+			}
+
+			void 
+			_buffer::clear(void)
+			{
+				std::vector<gaea::engine::frame::packet_t>::iterator iter;
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				for(iter = m_packet.begin(); iter != m_packet.end(); ++iter) {
+					iter->entity.clear();
+				}
+
+				m_acquired = 0;
+				m_back = FRAME_BACK;
+				m_fresh = false;
+				m_front = FRAME_FRONT;
+				m_published = 0;
+				m_ready = FRAME_READY;
+			}
+
+			gaea::engine::frame::packet_t &
+			_buffer::front(void)
+			{
+				return m_packet.at(m_front);
+			}
+
+			void 
+			_buffer::publish(void)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				std::swap(m_back, m_ready);
+				m_fresh = true;
+				++m_published;
+			}
+
+			std::string 
+			_buffer::to_string(
+				__in_opt bool verbose
+				)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				return gaea::engine::frame::buffer::as_string(*this, verbose);
+			}
+		}
+	}
+}
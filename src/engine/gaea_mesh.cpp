@@ -0,0 +1,1210 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstddef>
+#include "../../include/gaea.h"
+#include "gaea_mesh_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace mesh {
+
+			#define MESH_AO_SHIFT 16
+			#define MESH_AO_WIDTH 2
+			#define MESH_BOX_INDEX 36
+			#define MESH_BOX_VERTEX 8
+			#define MESH_KEY_LAYER(_KEY_) ((_KEY_) & UINT16_MAX)
+			#define MESH_KEY_VALID 0x80000000
+			#define MESH_OCCLUSION_MARGIN 1.f
+			#define MESH_QUAD_INDEX 6
+			#define MESH_QUAD_VERTEX 4
+			#define MESH_SAMPLE_MAX (MESH_SAMPLE_WIDTH * MESH_SAMPLE_WIDTH * MESH_SAMPLE_WIDTH)
+			#define MESH_SAMPLE_WIDTH (1 << MESH_LOD_MAX)
+
+			static const uint32_t MESH_BOX_INDICES[MESH_BOX_INDEX] = {
+				0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5, 0, 1, 5, 0, 5, 4,
+				2, 6, 7, 2, 7, 3, 0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6,
+				};
+
+			static const int MESH_CORNER[MESH_QUAD_VERTEX][2] = {
+				{ -1, -1 }, { 1, -1 }, { 1, 1 }, { -1, 1 },
+				};
+
+			static inline size_t 
+			padded_index(
+				__in int x,
+				__in int y,
+				__in int z,
+				__in_opt int width = MESH_PADDED_WIDTH
+				)
+			{
+				return ((((y + 1) * width) + (z + 1)) * width) + (x + 1);
+			}
+
+			static inline bool 
+			padded_solid(
+				__in const std::vector<gaea::block_t> &padded,
+				__in const int position[3],
+				__in int width
+				)
+			{
+				return (padded[padded_index(position[0], position[1], position[2], width)] != BLOCK_AIR);
+			}
+
+			static inline uint32_t 
+			ambient_occlusion(
+				__in bool side_a,
+				__in bool side_b,
+				__in bool corner
+				)
+			{
+				return ((side_a && side_b) ? 0 : (3 - (side_a + side_b + corner)));
+			}
+
+			void 
+			downsample(
+				__in const std::vector<gaea::block_t> &padded,
+				__in uint32_t lod,
+				__out std::vector<gaea::block_t> &coarse
+				)
+			{
+				gaea::block_t block;
+				std::pair<gaea::block_t, uint32_t> sample[MESH_SAMPLE_MAX];
+				uint32_t best, count, iter, solid, used;
+				int begin[3], coarse_width = ((CHUNK_WIDTH >> lod) + 2), end[3], position[3], scale = (1 << lod),
+					voxel[3];
+
+				if(lod > MESH_LOD_MAX) {
+					THROW_GAEA_MESH_EXCEPTION_FORMAT(GAEA_MESH_EXCEPTION_INVALID,
+						"LOD=%u (maximum %u)", lod, MESH_LOD_MAX);
+				}
+
+				if(padded.size() != MESH_PADDED_VOLUME) {
+					THROW_GAEA_MESH_EXCEPTION_FORMAT(GAEA_MESH_EXCEPTION_INVALID,
+						"Padded volume=%u (expecting %u)", (uint32_t) padded.size(), MESH_PADDED_VOLUME);
+				}
+
+				if(!lod) {
+					coarse = padded;
+					return;
+				}
+
+				coarse.assign(coarse_width * coarse_width * coarse_width, BLOCK_AIR);
+
+				for(position[1] = -1; position[1] < (coarse_width - 1); ++position[1]) {
+
+					for(position[2] = -1; position[2] < (coarse_width - 1); ++position[2]) {
+
+						for(position[0] = -1; position[0] < (coarse_width - 1); ++position[0]) {
+
+							if((position[0] < 0) || (position[0] >= (coarse_width - 2))
+									|| (position[2] < 0) || (position[2] >= (coarse_width - 2))) {
+								continue;
+							}
+
+							for(iter = 0; iter < 3; ++iter) {
+
+								if(position[iter] < 0) {
+									begin[iter] = -1;
+									end[iter] = 0;
+								} else if(position[iter] >= (coarse_width - 2)) {
+									begin[iter] = CHUNK_WIDTH;
+									end[iter] = (CHUNK_WIDTH + 1);
+								} else {
+									begin[iter] = (position[iter] * scale);
+									end[iter] = (begin[iter] + scale);
+								}
+							}
+
+							count = 0;
+							solid = 0;
+							used = 0;
+
+							for(voxel[1] = begin[1]; voxel[1] < end[1]; ++voxel[1]) {
+
+								for(voxel[2] = begin[2]; voxel[2] < end[2]; ++voxel[2]) {
+
+									for(voxel[0] = begin[0]; voxel[0] < end[0]; ++voxel[0], ++count) {
+
+										block = padded[padded_index(voxel[0], voxel[1], voxel[2])];
+										if(block == BLOCK_AIR) {
+											continue;
+										}
+
+										++solid;
+
+										for(iter = 0; (iter < used) && (sample[iter].first != block); ++iter);
+
+										if(iter == used) {
+											sample[used++] = std::pair<gaea::block_t, uint32_t>(block, 0);
+										}
+
+										++sample[iter].second;
+									}
+								}
+							}
+
+							if((solid * 2) < count) {
+								continue;
+							}
+
+							for(best = 0, iter = 1; iter < used; ++iter) {
+
+								if(sample[iter].second > sample[best].second) {
+									best = iter;
+								}
+							}
+
+							coarse[padded_index(position[0], position[1], position[2], coarse_width)] =
+								sample[best].first;
+						}
+					}
+				}
+			}
+
+			void 
+			emit(
+				__in uint32_t face,
+				__in uint32_t key,
+				__in const int position[3],
+				__in int axis_u,
+				__in int axis_v,
+				__in int width,
+				__in int height,
+				__in int scale,
+				__out gaea::engine::mesh::data_t &data
+				)
+			{
+				int corner[3];
+				uint32_t ao[MESH_QUAD_VERTEX], iter = 0, order[MESH_QUAD_VERTEX];
+				size_t offset = data.vertex.size();
+				gaea::engine::mesh::vertex_t vertex;
+
+				for(; iter < MESH_QUAD_VERTEX; ++iter) {
+					order[iter] = (face & 1) ? iter : ((MESH_QUAD_VERTEX - iter) % MESH_QUAD_VERTEX);
+				}
+
+				for(iter = 0; iter < MESH_QUAD_VERTEX; ++iter) {
+					corner[0] = position[0];
+					corner[1] = position[1];
+					corner[2] = position[2];
+					corner[axis_u] += ((MESH_CORNER[order[iter]][0] > 0) ? width : 0);
+					corner[axis_v] += ((MESH_CORNER[order[iter]][1] > 0) ? height : 0);
+					ao[iter] = ((key >> (MESH_AO_SHIFT + (order[iter] * MESH_AO_WIDTH))) & 0x3);
+					vertex.position = MESH_VERTEX_PACK(corner[0] * scale, corner[1] * scale, corner[2] * scale,
+						face, ao[iter]);
+					vertex.layer = MESH_KEY_LAYER(key);
+					data.vertex.push_back(vertex);
+				}
+
+				if((ao[0] + ao[2]) >= (ao[1] + ao[3])) {
+					data.index.push_back(offset);
+					data.index.push_back(offset + 1);
+					data.index.push_back(offset + 2);
+					data.index.push_back(offset);
+					data.index.push_back(offset + 2);
+					data.index.push_back(offset + 3);
+				} else {
+					data.index.push_back(offset + 1);
+					data.index.push_back(offset + 2);
+					data.index.push_back(offset + 3);
+					data.index.push_back(offset + 1);
+					data.index.push_back(offset + 3);
+					data.index.push_back(offset);
+				}
+			}
+
+			void 
+			generate(
+				__in const std::vector<gaea::block_t> &padded,
+				__out gaea::engine::mesh::data_t &data,
+				__in_opt uint32_t lod
+				)
+			{
+				gaea::block_t block;
+				std::vector<uint32_t> mask;
+				bool corner_a, corner_b, corner_c;
+				uint32_t corner, face = 0, key;
+				int air[3], axis, axis_u, axis_v, extent = (CHUNK_WIDTH >> lod), height, i, j, k, normal[3],
+					padded_width = (extent + 2), position[3], sample[3], slice, width;
+
+				data.index.clear();
+				data.vertex.clear();
+
+				if((lod > MESH_LOD_MAX) || (padded.size() != (size_t) (padded_width * padded_width * padded_width))) {
+					THROW_GAEA_MESH_EXCEPTION_FORMAT(GAEA_MESH_EXCEPTION_INVALID,
+						"LOD=%u, Padded volume=%u", lod, (uint32_t) padded.size());
+				}
+
+				mask.resize(extent * extent, 0);
+
+				for(; face <= FACE_MAX; ++face) {
+					axis = (face >> 1);
+					axis_u = ((axis + 1) % 3);
+					axis_v = ((axis + 2) % 3);
+					normal[0] = normal[1] = normal[2] = 0;
+					normal[axis] = ((face & 1) ? 1 : -1);
+
+					for(slice = 0; slice < extent; ++slice) {
+						position[axis] = slice;
+
+						for(j = 0; j < extent; ++j) {
+							position[axis_v] = j;
+
+							for(i = 0; i < extent; ++i) {
+								position[axis_u] = i;
+								key = 0;
+
+								block = padded[padded_index(position[0], position[1], position[2], padded_width)];
+								if(block != BLOCK_AIR) {
+									air[0] = position[0] + normal[0];
+									air[1] = position[1] + normal[1];
+									air[2] = position[2] + normal[2];
+
+									if(!padded_solid(padded, air, padded_width)) {
+										key = (MESH_KEY_VALID | block);
+
+										for(corner = 0; corner < MESH_QUAD_VERTEX; ++corner) {
+											sample[0] = air[0];
+											sample[1] = air[1];
+											sample[2] = air[2];
+											sample[axis_u] += MESH_CORNER[corner][0];
+											corner_a = padded_solid(padded, sample, padded_width);
+											sample[axis_v] += MESH_CORNER[corner][1];
+											corner_c = padded_solid(padded, sample, padded_width);
+											sample[axis_u] -= MESH_CORNER[corner][0];
+											corner_b = padded_solid(padded, sample, padded_width);
+											key |= (ambient_occlusion(corner_a, corner_b, corner_c)
+												<< (MESH_AO_SHIFT + (corner * MESH_AO_WIDTH)));
+										}
+									}
+								}
+
+								mask[(j * extent) + i] = key;
+							}
+						}
+
+						position[axis] = (slice + ((face & 1) ? 1 : 0));
+
+						for(j = 0; j < extent; ++j) {
+
+							for(i = 0; i < extent;) {
+
+								key = mask[(j * extent) + i];
+								if(!key) {
+									++i;
+									continue;
+								}
+
+								for(width = 1; ((i + width) < extent)
+										&& (mask[(j * extent) + i + width] == key); ++width);
+
+								for(height = 1; (j + height) < extent; ++height) {
+
+									for(k = 0; k < width; ++k) {
+
+										if(mask[((j + height) * extent) + i + k] != key) {
+											break;
+										}
+									}
+
+									if(k < width) {
+										break;
+									}
+								}
+
+								position[axis_u] = i;
+								position[axis_v] = j;
+								emit(face, key, position, axis_u, axis_v, width, height, (1 << lod), data);
+
+								for(k = 0; k < height; ++k) {
+									std::fill(mask.begin() + ((j + k) * extent) + i,
+										mask.begin() + ((j + k) * extent) + i + width, 0);
+								}
+
+								i += width;
+							}
+						}
+					}
+				}
+			}
+
+			uint32_t 
+			hull(
+				__in const std::vector<gaea::block_t> &padded
+				)
+			{
+				int x, y = 0, z;
+
+				for(; y < CHUNK_WIDTH; ++y) {
+
+					for(z = 0; z < CHUNK_WIDTH; ++z) {
+
+						for(x = 0; x < CHUNK_WIDTH; ++x) {
+
+							if(padded[padded_index(x, y, z)] == BLOCK_AIR) {
+								return y;
+							}
+						}
+					}
+				}
+
+				return y;
+			}
+
+			uint32_t 
+			lod(
+				__in const glm::ivec3 &coordinate,
+				__in const glm::ivec3 &focus,
+				__in int32_t distance
+				)
+			{
+				uint32_t result = 0;
+				int32_t limit = distance, x = (coordinate.x - focus.x), z = (coordinate.z - focus.z);
+
+				if(distance > 0) {
+
+					for(; (result < MESH_LOD_MAX) && (((x * x) + (z * z)) >= (limit * limit)); ++result) {
+						limit <<= 1;
+					}
+				}
+
+				return result;
+			}
+
+			void 
+			pad(
+				__in const gaea::engine::chunk::base *neighbour[MESH_NEIGHBOUR_COUNT],
+				__out std::vector<gaea::block_t> &padded
+				)
+			{
+				int chunk[3], local[3], position[3], iter;
+				const gaea::engine::chunk::base *entry = nullptr;
+
+				padded.resize(MESH_PADDED_VOLUME, BLOCK_AIR);
+
+				for(position[1] = -1; position[1] <= CHUNK_WIDTH; ++position[1]) {
+
+					for(position[2] = -1; position[2] <= CHUNK_WIDTH; ++position[2]) {
+
+						for(position[0] = -1; position[0] <= CHUNK_WIDTH; ++position[0]) {
+
+							for(iter = 0; iter < 3; ++iter) {
+								chunk[iter] = ((position[iter] < 0) ? 0 : ((position[iter] >= CHUNK_WIDTH) ? 2 : 1));
+								local[iter] = (position[iter] & (CHUNK_WIDTH - 1));
+							}
+
+							entry = neighbour[chunk[0] + (chunk[1] * 3) + (chunk[2] * 9)];
+							padded[padded_index(position[0], position[1], position[2])] = (entry
+								? entry->get(local[0], local[1], local[2]) : BLOCK_AIR);
+						}
+					}
+				}
+			}
+
+			_base::_base(
+				__in const glm::ivec3 &coordinate,
+				__in gaea::graphics::program::base &program,
+				__in gaea::graphics::vao::base &box,
+				__in_opt bool visible
+				) :
+					gaea::engine::entity::base_model(ENTITY_CHUNK, ENTITY_SPECIFIER_UNDEFINED,
+						(glm::dvec3(coordinate) * (double) CHUNK_WIDTH), ENTITY_ROTATION_INIT, ENTITY_UP_INIT,
+						program.uniform_location(ENTITY_UNIFORM_MODEL),
+						program.uniform_location(ENTITY_UNIFORM_PROJECTION),
+						program.uniform_location(ENTITY_UNIFORM_VIEW), visible),
+					m_box(box),
+					m_coordinate(coordinate),
+					m_count(0),
+					m_hull(0),
+					m_lod(0),
+					m_memory(0),
+					m_occluded(false),
+					m_program(program)
+			{
+				return;
+			}
+
+			_base::_base(
+				__in const _base &other
+				) :
+					gaea::engine::entity::base_model(other),
+					m_box(other.m_box),
+					m_coordinate(other.m_coordinate),
+					m_count(other.m_count),
+					m_hull(other.m_hull),
+					m_lod(other.m_lod),
+					m_memory(other.m_memory),
+					m_occluded(other.m_occluded),
+					m_program(other.m_program),
+					m_query(other.m_query),
+					m_vao(other.m_vao)
+			{
+				return;
+			}
+
+			_base::~_base(void)
+			{
+				return;
+			}
+
+			_base & 
+			_base::operator=(
+				__in const _base &other
+				)
+			{
+
+				if(this != &other) {
+					gaea::engine::entity::base_model::operator=(other);
+					m_box = other.m_box;
+					m_coordinate = other.m_coordinate;
+					m_count = other.m_count;
+					m_hull = other.m_hull;
+					m_lod = other.m_lod;
+					m_memory = other.m_memory;
+					m_occluded = other.m_occluded;
+					m_program = other.m_program;
+					m_query = other.m_query;
+					m_vao = other.m_vao;
+				}
+
+				return *this;
+			}
+
+			std::string 
+			_base::as_string(
+				__in const _base &object,
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << gaea::engine::entity::base_model::as_string(object, verbose)
+					<< ", COORD={" << object.m_coordinate.x << ", " << object.m_coordinate.y
+						<< ", " << object.m_coordinate.z << "}"
+					<< ", " << gaea::graphics::vao::base::as_string(object.m_vao, verbose)
+					<< ", IDC=" << object.m_count
+					<< ", HULL=" << object.m_hull
+					<< ", LOD=" << object.m_lod
+					<< ", MEM=" << object.m_memory << " bytes"
+					<< ", " << (object.m_occluded ? "OCCLUDED" : "UNOCCLUDED");
+
+				return result.str();
+			}
+
+			bool 
+			_base::bounds(
+				__in const glm::dvec3 &position,
+				__out gaea::engine::occlusion::box_t &box
+				)
+			{
+				box.minimum = glm::vec3(m_position - position);
+				box.maximum = (box.minimum + glm::vec3(CHUNK_WIDTH));
+
+				return (m_count != 0);
+			}
+
+			const glm::ivec3 & 
+			_base::coordinate(void)
+			{
+				return m_coordinate;
+			}
+
+			size_t 
+			_base::count(void)
+			{
+				return m_count;
+			}
+
+			uint32_t 
+			_base::hull(void)
+			{
+				return m_hull;
+			}
+
+			bool 
+			_base::is_occluded(void)
+			{
+
+				if(m_query.is_available()) {
+					m_occluded = !m_query.result();
+				}
+
+				return m_occluded;
+			}
+
+			uint32_t 
+			_base::lod(void)
+			{
+				return m_lod;
+			}
+
+			size_t 
+			_base::memory(void)
+			{
+				return m_memory;
+			}
+
+			void 
+			_base::query(
+				__in const glm::dvec3 &position,
+				__in const glm::mat4 &projection,
+				__in const glm::mat4 &view
+				)
+			{
+				glm::vec3 minimum = glm::vec3(m_position - position),
+					maximum = (minimum + glm::vec3(CHUNK_WIDTH + MESH_OCCLUSION_MARGIN));
+
+				if(!m_count || m_query.is_issued()) {
+					return;
+				}
+
+				minimum -= glm::vec3(MESH_OCCLUSION_MARGIN);
+				if((minimum.x <= 0.f) && (maximum.x >= 0.f)
+						&& (minimum.y <= 0.f) && (maximum.y >= 0.f)
+						&& (minimum.z <= 0.f) && (maximum.z >= 0.f)) {
+					m_occluded = false;
+					return;
+				}
+
+				m_model = glm::translate(glm::mat4(1.f), glm::vec3(m_position - position));
+				m_program.start();
+				m_program.set_uniform(m_model_id, m_model);
+				m_program.set_uniform(m_projection_id, projection);
+				m_program.set_uniform(m_view_id, view);
+				m_box.start();
+				m_query.start();
+				GL_CHECK(glDrawElements, GL_TRIANGLES, MESH_BOX_INDEX, GL_UNSIGNED_INT, nullptr);
+				m_query.stop();
+				m_box.stop();
+				m_program.stop();
+			}
+
+			void 
+			_base::render(
+				__in const glm::dvec3 &position,
+				__in const glm::vec3 &rotation,
+				__in const glm::vec3 &up,
+				__in const glm::mat4 &projection,
+				__in const glm::mat4 &view
+				)
+			{
+
+				if(m_count) {
+					m_model = glm::translate(glm::mat4(1.f), glm::vec3(m_position - position));
+					m_program.start();
+					m_program.set_uniform(m_model_id, m_model);
+					m_program.set_uniform(m_projection_id, projection);
+					m_program.set_uniform(m_view_id, view);
+					m_vao.start();
+					GL_CHECK(glDrawElements, GL_TRIANGLES, m_count, GL_UNSIGNED_INT, nullptr);
+					m_vao.stop();
+					m_program.stop();
+				}
+			}
+
+			std::string 
+			_base::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::engine::mesh::base::as_string(*this, verbose);
+			}
+
+			void 
+			_base::update(
+				__in GLfloat delta
+				)
+			{
+				return;
+			}
+
+			void 
+			_base::upload(
+				__in const gaea::engine::mesh::data_t &data,
+				__in_opt uint32_t lod,
+				__in_opt uint32_t hull
+				)
+			{
+				m_vao = gaea::graphics::vao::base();
+				m_count = data.index.size();
+				m_hull = hull;
+				m_lod = lod;
+				m_memory = ((data.vertex.size() * sizeof(gaea::engine::mesh::vertex_t))
+					+ (data.index.size() * sizeof(uint32_t)));
+
+				if(m_count) {
+					m_vao.add_data(data.vertex.data(), data.vertex.size() * sizeof(gaea::engine::mesh::vertex_t),
+						GL_ARRAY_BUFFER, GL_STATIC_DRAW);
+					m_vao.set_attribute_integer(MESH_ATTRIBUTE_POSITION, 1, GL_UNSIGNED_INT,
+						sizeof(gaea::engine::mesh::vertex_t),
+						(const GLvoid *) offsetof(gaea::engine::mesh::vertex_t, position));
+					m_vao.set_attribute_integer(MESH_ATTRIBUTE_LAYER, 1, GL_UNSIGNED_INT,
+						sizeof(gaea::engine::mesh::vertex_t),
+						(const GLvoid *) offsetof(gaea::engine::mesh::vertex_t, layer));
+					m_vao.add_data(data.index.data(), data.index.size() * sizeof(uint32_t),
+						GL_ELEMENT_ARRAY_BUFFER, GL_STATIC_DRAW);
+				}
+			}
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_box(nullptr),
+				m_distance(MESH_LOD_DISTANCE_INIT),
+				m_focused(false),
+				m_initialized(false),
+				m_program(nullptr)
+			{
+				gaea::engine::pool::manager::acquire();
+				std::atexit(gaea::engine::mesh::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				uninitialize();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::mesh::manager::m_instance) {
+					delete gaea::engine::mesh::manager::m_instance;
+					gaea::engine::mesh::manager::m_instance = nullptr;
+				}
+			}
+
+			void 
+			_manager::_thread(void)
+			{
+
+				if(gaea::engine::mesh::manager::is_allocated()) {
+
+					gaea::engine::mesh::manager &instance = gaea::engine::mesh::manager::acquire();
+					for(;;) {
+						job_t job;
+						std::vector<gaea::block_t> coarse;
+
+						std::unique_lock<std::mutex> lock(instance.m_lock);
+						instance.m_condition.wait(lock, [&instance] {
+								return (!instance.m_initialized || !instance.m_job.empty());
+							});
+
+						if(!instance.m_initialized) {
+							break;
+						}
+
+						job = std::move(instance.m_job.front());
+						instance.m_job.pop();
+						lock.unlock();
+
+						job.hull = gaea::engine::mesh::hull(job.padded);
+						if(job.lod) {
+							gaea::engine::mesh::downsample(job.padded, job.lod, coarse);
+							job.padded.swap(coarse);
+						}
+
+						gaea::engine::mesh::generate(job.padded, job.data, job.lod);
+						job.padded.clear();
+
+						lock.lock();
+						instance.m_result.push_back(std::move(job));
+					}
+				}
+			}
+
+			_manager & 
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::mesh::manager::m_instance) {
+
+					gaea::engine::mesh::manager::m_instance = new gaea::engine::mesh::manager;
+					if(!gaea::engine::mesh::manager::m_instance) {
+						THROW_GAEA_MESH_EXCEPTION(GAEA_MESH_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::mesh::manager::m_instance;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+				std::unordered_map<glm::ivec3, gaea::engine::mesh::base *, gaea::engine::chunk::hash_t>::iterator iter;
+
+				for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
+					gaea::engine::pool::destroy(iter->second);
+				}
+
+				m_entry.clear();
+				m_focused = false;
+				m_generation.clear();
+				m_job = std::queue<job_t>();
+				m_result.clear();
+
+				if(m_box) {
+					delete m_box;
+					m_box = nullptr;
+				}
+
+				if(m_program) {
+					delete m_program;
+					m_program = nullptr;
+				}
+			}
+
+			bool 
+			_manager::contains(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_MESH_EXCEPTION(GAEA_MESH_EXCEPTION_UNINITIALIZED);
+				}
+
+				return (m_entry.find(coordinate) != m_entry.end());
+			}
+
+			size_t 
+			_manager::count(void)
+			{
+				size_t result = 0;
+				std::unordered_map<glm::ivec3, gaea::engine::mesh::base *, gaea::engine::chunk::hash_t>::iterator iter;
+
+				for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
+					result += iter->second->count();
+				}
+
+				return result;
+			}
+
+			int32_t 
+			_manager::distance(void)
+			{
+				return m_distance;
+			}
+
+			void 
+			_manager::erase(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				std::unordered_map<glm::ivec3, gaea::engine::mesh::base *, gaea::engine::chunk::hash_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_MESH_EXCEPTION(GAEA_MESH_EXCEPTION_UNINITIALIZED);
+				}
+
+				iter = m_entry.find(coordinate);
+				if(iter == m_entry.end()) {
+					THROW_GAEA_MESH_EXCEPTION_FORMAT(GAEA_MESH_EXCEPTION_NOT_FOUND,
+						"{%i, %i, %i}", coordinate.x, coordinate.y, coordinate.z);
+				}
+
+				gaea::engine::pool::destroy(iter->second);
+				m_entry.erase(iter);
+
+				std::lock_guard<std::mutex> lock(m_lock);
+				++m_generation[coordinate];
+			}
+
+			void 
+			_manager::initialize(
+				__in_opt size_t workers,
+				__in_opt int32_t distance,
+				__in_opt const std::string &vertex,
+				__in_opt const std::string &fragment
+				)
+			{
+				gaea::engine::mesh::vertex_t box[MESH_BOX_VERTEX];
+				size_t iter = 0;
+
+				if(m_initialized) {
+					THROW_GAEA_MESH_EXCEPTION(GAEA_MESH_EXCEPTION_INITIALIZED);
+				}
+
+				if(distance < 0) {
+					THROW_GAEA_MESH_EXCEPTION_FORMAT(GAEA_MESH_EXCEPTION_INVALID,
+						"Distance=%i", distance);
+				}
+
+				m_program = new gaea::graphics::program::base;
+				if(!m_program) {
+					THROW_GAEA_MESH_EXCEPTION(GAEA_MESH_EXCEPTION_ALLOCATED);
+				}
+
+				m_program->link(vertex, fragment);
+
+				m_box = new gaea::graphics::vao::base;
+				if(!m_box) {
+					THROW_GAEA_MESH_EXCEPTION(GAEA_MESH_EXCEPTION_ALLOCATED);
+				}
+
+				for(; iter < MESH_BOX_VERTEX; ++iter) {
+					box[iter].position = MESH_VERTEX_PACK((iter & 1) * CHUNK_WIDTH, ((iter >> 1) & 1) * CHUNK_WIDTH,
+						((iter >> 2) & 1) * CHUNK_WIDTH, FACE_POSITIVE_Y, 0);
+					box[iter].layer = 0;
+				}
+
+				m_box->add_data(box, sizeof(box), GL_ARRAY_BUFFER, GL_STATIC_DRAW);
+				m_box->set_attribute_integer(MESH_ATTRIBUTE_POSITION, 1, GL_UNSIGNED_INT,
+					sizeof(gaea::engine::mesh::vertex_t),
+					(const GLvoid *) offsetof(gaea::engine::mesh::vertex_t, position));
+				m_box->set_attribute_integer(MESH_ATTRIBUTE_LAYER, 1, GL_UNSIGNED_INT,
+					sizeof(gaea::engine::mesh::vertex_t),
+					(const GLvoid *) offsetof(gaea::engine::mesh::vertex_t, layer));
+				m_box->add_data(MESH_BOX_INDICES, sizeof(MESH_BOX_INDICES), GL_ELEMENT_ARRAY_BUFFER,
+					GL_STATIC_DRAW);
+				m_distance = distance;
+				m_initialized = true;
+
+				for(iter = 0; iter < workers; ++iter) {
+					m_worker.push_back(std::thread(gaea::engine::mesh::manager::_thread));
+				}
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::mesh::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_initialized(void)
+			{
+				return m_initialized;
+			}
+
+			size_t 
+			_manager::memory(void)
+			{
+				size_t result = 0;
+				std::unordered_map<glm::ivec3, gaea::engine::mesh::base *, gaea::engine::chunk::hash_t>::iterator iter;
+
+				for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
+					result += iter->second->memory();
+				}
+
+				return result;
+			}
+
+			size_t 
+			_manager::memory(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				size_t result = 0;
+				std::unordered_map<glm::ivec3, gaea::engine::mesh::base *, gaea::engine::chunk::hash_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_MESH_EXCEPTION(GAEA_MESH_EXCEPTION_UNINITIALIZED);
+				}
+
+				iter = m_entry.find(coordinate);
+				if(iter != m_entry.end()) {
+					result = iter->second->memory();
+				}
+
+				return result;
+			}
+
+			void 
+			_manager::occluders(
+				__in const glm::dvec3 &position,
+				__out gaea::engine::arena::vector<gaea::engine::occlusion::box_t> &occluder,
+				__in_opt size_t count
+				)
+			{
+				glm::dvec3 center;
+				gaea::engine::occlusion::box_t box;
+				gaea::engine::arena::vector<std::pair<GLfloat, gaea::engine::mesh::base *>> entry;
+				gaea::engine::arena::vector<std::pair<GLfloat, gaea::engine::mesh::base *>>::iterator entry_iter;
+				std::unordered_map<glm::ivec3, gaea::engine::mesh::base *, gaea::engine::chunk::hash_t>::iterator iter;
+
+				occluder.clear();
+
+				for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
+
+					if(iter->second->hull()) {
+						center = (((glm::dvec3(iter->first) * (double) CHUNK_WIDTH) + glm::dvec3(CHUNK_WIDTH / 2.0))
+							- position);
+						entry.push_back(std::pair<GLfloat, gaea::engine::mesh::base *>(glm::dot(center, center),
+							iter->second));
+					}
+				}
+
+				count = std::min(count, entry.size());
+				std::partial_sort(entry.begin(), entry.begin() + count, entry.end());
+
+				for(entry_iter = entry.begin(); entry_iter != (entry.begin() + count); ++entry_iter) {
+					box.minimum = glm::vec3((glm::dvec3(entry_iter->second->coordinate()) * (double) CHUNK_WIDTH)
+						- position);
+					box.maximum = (box.minimum + glm::vec3(CHUNK_WIDTH, entry_iter->second->hull(), CHUNK_WIDTH));
+					occluder.push_back(box);
+				}
+			}
+
+			size_t 
+			_manager::pending(void)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				return m_job.size();
+			}
+
+			void 
+			_manager::refresh(void)
+			{
+				std::vector<glm::ivec3> stale;
+				std::vector<glm::ivec3>::iterator stale_iter;
+				gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+				std::unordered_map<glm::ivec3, gaea::engine::mesh::base *, gaea::engine::chunk::hash_t>::iterator iter;
+
+				for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
+
+					if(iter->second->lod() != gaea::engine::mesh::lod(iter->first, m_focus, m_distance)) {
+						stale.push_back(iter->first);
+					}
+				}
+
+				for(stale_iter = stale.begin(); stale_iter != stale.end(); ++stale_iter) {
+
+					if(world.contains(*stale_iter)) {
+						schedule(*stale_iter);
+					}
+				}
+			}
+
+			void 
+			_manager::schedule(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				int x, y, z;
+				job_t job;
+				glm::ivec3 position;
+				const gaea::engine::chunk::base *neighbour[MESH_NEIGHBOUR_COUNT];
+				gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+
+				for(z = -1; z <= 1; ++z) {
+
+					for(y = -1; y <= 1; ++y) {
+
+						for(x = -1; x <= 1; ++x) {
+							position = (coordinate + glm::ivec3(x, y, z));
+							neighbour[(x + 1) + ((y + 1) * 3) + ((z + 1) * 9)] = (world.contains(position)
+								? &world.chunk(position) : nullptr);
+						}
+					}
+				}
+
+				job.coordinate = coordinate;
+				job.lod = gaea::engine::mesh::lod(coordinate, m_focus, m_distance);
+				gaea::engine::mesh::pad(neighbour, job.padded);
+				world.chunk(coordinate).set_dirty(false);
+
+				std::lock_guard<std::mutex> lock(m_lock);
+				job.generation = ++m_generation[coordinate];
+				m_job.push(std::move(job));
+				m_condition.notify_one();
+			}
+
+			size_t 
+			_manager::size(void)
+			{
+				return m_entry.size();
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				size_t count = 0;
+				std::stringstream result;
+				std::unordered_map<glm::ivec3, gaea::engine::mesh::base *, gaea::engine::chunk::hash_t>::iterator iter;
+
+				result << GAEA_MESH_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
+
+				if(m_initialized) {
+					std::lock_guard<std::mutex> lock(m_lock);
+
+					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+						<< ", WORKERS=" << m_worker.size()
+						<< ", LOD_DIST=" << m_distance
+						<< ", FOCUS={" << m_focus.x << ", " << m_focus.y << ", " << m_focus.z << "}"
+						<< ", ENTRIES=" << m_entry.size()
+						<< ", PENDING=" << m_job.size()
+						<< ", COMPLETE=" << m_result.size();
+
+					if(verbose) {
+
+						for(iter = m_entry.begin(); iter != m_entry.end(); ++count, ++iter) {
+							result << std::endl << "[" << count << "] " << iter->second->to_string(verbose);
+						}
+					}
+				}
+
+				return result.str();
+			}
+
+			void 
+			_manager::uninitialize(void)
+			{
+				std::vector<std::thread>::iterator iter;
+
+				if(m_initialized) {
+
+					m_lock.lock();
+					m_initialized = false;
+					m_condition.notify_all();
+					m_lock.unlock();
+
+					for(iter = m_worker.begin(); iter != m_worker.end(); ++iter) {
+
+						if(iter->joinable()) {
+							iter->join();
+						}
+					}
+
+					m_worker.clear();
+					clear();
+				}
+			}
+
+			void 
+			_manager::update(
+				__in const glm::dvec3 &position,
+				__in_opt size_t upload
+				)
+			{
+				bool moved = false, stale;
+				glm::ivec3 focus;
+				std::vector<job_t> result;
+				std::vector<glm::ivec3> dirty;
+				gaea::engine::arena::vector<glm::ivec3> lod;
+				std::vector<job_t>::iterator result_iter;
+				std::vector<glm::ivec3>::iterator dirty_iter;
+				gaea::engine::arena::vector<glm::ivec3>::iterator lod_iter;
+				std::unordered_map<glm::ivec3, gaea::engine::mesh::base *, gaea::engine::chunk::hash_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_MESH_EXCEPTION(GAEA_MESH_EXCEPTION_UNINITIALIZED);
+				}
+
+				focus = gaea::engine::chunk::coordinate(glm::ivec3(glm::floor(position)));
+				if(!m_focused || (focus != m_focus)) {
+					m_focus = focus;
+					m_focused = true;
+					moved = true;
+				}
+
+				if(gaea::engine::world::manager::is_allocated()) {
+
+					gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+					if(world.is_initialized()) {
+						std::lock_guard<std::recursive_mutex> lock(world.lock());
+
+						if(moved) {
+							refresh();
+						}
+
+						dirty = world.dirty();
+						for(dirty_iter = dirty.begin(); dirty_iter != dirty.end(); ++dirty_iter) {
+							schedule(*dirty_iter);
+						}
+					}
+				}
+
+				m_lock.lock();
+				result.swap(m_result);
+				m_lock.unlock();
+
+				for(result_iter = result.begin(); result_iter != result.end(); ++result_iter) {
+
+					if(!upload) {
+						m_lock.lock();
+						m_result.insert(m_result.begin(), std::make_move_iterator(result_iter),
+							std::make_move_iterator(result.end()));
+						m_lock.unlock();
+						break;
+					}
+
+					m_lock.lock();
+					stale = (m_generation[result_iter->coordinate] != result_iter->generation);
+					m_lock.unlock();
+
+					if(stale) {
+						continue;
+					}
+
+					iter = m_entry.find(result_iter->coordinate);
+					if(result_iter->data.index.empty()) {
+
+						if(iter != m_entry.end()) {
+							gaea::engine::pool::destroy(iter->second);
+							m_entry.erase(iter);
+						}
+
+						continue;
+					}
+
+					if(iter == m_entry.end()) {
+
+						gaea::engine::mesh::base *entry = gaea::engine::pool::create<gaea::engine::mesh::base>(
+							result_iter->coordinate, *m_program, *m_box);
+						if(!entry) {
+							THROW_GAEA_MESH_EXCEPTION(GAEA_MESH_EXCEPTION_ALLOCATED);
+						}
+
+						iter = m_entry.insert(std::pair<glm::ivec3, gaea::engine::mesh::base *>(
+							result_iter->coordinate, entry)).first;
+					}
+
+					iter->second->upload(result_iter->data, result_iter->lod, result_iter->hull);
+					--upload;
+
+					if(result_iter->lod != gaea::engine::mesh::lod(result_iter->coordinate, m_focus, m_distance)) {
+						lod.push_back(result_iter->coordinate);
+					}
+				}
+
+				if(!lod.empty()) {
+
+					gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+					if(world.is_initialized()) {
+						std::lock_guard<std::recursive_mutex> lock(world.lock());
+
+						for(lod_iter = lod.begin(); lod_iter != lod.end(); ++lod_iter) {
+
+							if(world.contains(*lod_iter)) {
+								schedule(*lod_iter);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
@@ -27,7 +27,7 @@ namespace gaea {
 		namespace model {
 
 			_base::_base(
-				__in_opt const glm::vec3 &position,
+				__in_opt const glm::dvec3 &position,
 				__in_opt const glm::vec3 &rotation,
 				__in_opt const glm::vec3 &up,
 				__in_opt bool visible
@@ -132,14 +132,14 @@ namespace gaea {
 
 			void 
 			_base::render(
-				__in const glm::vec3 &position,
+				__in const glm::dvec3 &position,
 				__in const glm::vec3 &rotation,
 				__in const glm::vec3 &up,
 				__in const glm::mat4 &projection,
 				__in const glm::mat4 &view
 				)
 			{
-				update_model();
+				update_model(position);
 				m_program.start();
 				m_program.set_uniform(m_model_id, m_model);
 				m_program.set_uniform(m_projection_id, projection);
@@ -175,7 +175,7 @@ namespace gaea {
 			}
 
 			_base_controllable::_base_controllable(
-				__in_opt const glm::vec3 &position,
+				__in_opt const glm::dvec3 &position,
 				__in_opt const glm::vec3 &rotation,
 				__in_opt const glm::vec3 &up,
 				__in_opt bool visible,
@@ -234,7 +234,7 @@ namespace gaea {
 
 			void 
 			_base_controllable::render(
-				__in const glm::vec3 &position,
+				__in const glm::dvec3 &position,
 				__in const glm::vec3 &rotation,
 				__in const glm::vec3 &up,
 				__in const glm::mat4 &projection,
@@ -0,0 +1,416 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <cstring>
+#if defined(__SSE4_1__)
+#include <immintrin.h>
+#endif // __SSE4_1__
+#include "../../include/gaea.h"
+#include "gaea_noise_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace noise {
+
+			#define NOISE_GOLDEN 0x9e3779b97f4a7c15ULL
+			#define NOISE_MASK (NOISE_PERMUTATION - 1)
+
+			static inline float 
+			fade(
+				__in float t
+				)
+			{
+				return t * t * t * ((t * ((t * 6.f) - 15.f)) + 10.f);
+			}
+
+			static const float NOISE_GRADIENT[][3] = {
+				{ 1.f, 1.f, 0.f }, { -1.f, 1.f, 0.f }, { 1.f, -1.f, 0.f }, { -1.f, -1.f, 0.f },
+				{ 1.f, 0.f, 1.f }, { -1.f, 0.f, 1.f }, { 1.f, 0.f, -1.f }, { -1.f, 0.f, -1.f },
+				{ 0.f, 1.f, 1.f }, { 0.f, -1.f, 1.f }, { 0.f, 1.f, -1.f }, { 0.f, -1.f, -1.f },
+				{ 1.f, 1.f, 0.f }, { 0.f, -1.f, 1.f }, { -1.f, 1.f, 0.f }, { 0.f, -1.f, -1.f },
+				};
+
+			static inline float 
+			gradient(
+				__in int32_t hash,
+				__in float x,
+				__in float y,
+				__in float z
+				)
+			{
+				const float *entry = NOISE_GRADIENT[hash & 15];
+
+				return ((entry[0] * x) + (entry[1] * y)) + (entry[2] * z);
+			}
+
+			static inline float 
+			lerp(
+				__in float t,
+				__in float a,
+				__in float b
+				)
+			{
+				return a + (t * (b - a));
+			}
+
+			static inline uint64_t 
+			split_mix(
+				__inout uint64_t &state
+				)
+			{
+				uint64_t result = (state += NOISE_GOLDEN);
+
+				result = ((result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ULL);
+				result = ((result ^ (result >> 27)) * 0x94d049bb133111ebULL);
+
+				return (result ^ (result >> 31));
+			}
+
+#if defined(__SSE4_1__)
+			static_assert(NOISE_LANE == (sizeof(__m128) / sizeof(float)),
+				"NOISE_LANE must match the width of __m128");
+
+			static inline __m128 
+			fade(
+				__in __m128 t
+				)
+			{
+				__m128 result = _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.f)), _mm_set1_ps(15.f));
+
+				result = _mm_add_ps(_mm_mul_ps(t, result), _mm_set1_ps(10.f));
+
+				return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), result);
+			}
+
+			static inline __m128 
+			gradient(
+				__in __m128i hash,
+				__in __m128 x,
+				__in __m128 y,
+				__in __m128 z
+				)
+			{
+				__m128 u, v;
+				__m128i mask_x;
+
+				hash = _mm_and_si128(hash, _mm_set1_epi32(15));
+				u = _mm_blendv_ps(y, x, _mm_castsi128_ps(_mm_cmplt_epi32(hash, _mm_set1_epi32(8))));
+				mask_x = _mm_or_si128(_mm_cmpeq_epi32(hash, _mm_set1_epi32(12)),
+					_mm_cmpeq_epi32(hash, _mm_set1_epi32(14)));
+				v = _mm_blendv_ps(z, x, _mm_castsi128_ps(mask_x));
+				v = _mm_blendv_ps(v, y, _mm_castsi128_ps(_mm_cmplt_epi32(hash, _mm_set1_epi32(4))));
+				u = _mm_xor_ps(u, _mm_castsi128_ps(_mm_slli_epi32(hash, 31)));
+				v = _mm_xor_ps(v, _mm_castsi128_ps(_mm_slli_epi32(_mm_srli_epi32(hash, 1), 31)));
+
+				return _mm_add_ps(u, v);
+			}
+
+			static inline __m128i 
+			lookup(
+				__in const int32_t *table,
+				__in __m128i index
+				)
+			{
+#if defined(__AVX2__)
+				return _mm_i32gather_epi32(table, index, sizeof(int32_t));
+#else
+				int32_t entry[NOISE_LANE];
+
+				_mm_storeu_si128((__m128i *) entry, index);
+
+				return _mm_setr_epi32(table[entry[0]], table[entry[1]], table[entry[2]], table[entry[3]]);
+#endif // __AVX2__
+			}
+
+			static inline __m128 
+			lerp(
+				__in __m128 t,
+				__in __m128 a,
+				__in __m128 b
+				)
+			{
+				return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+			}
+#endif // __SSE4_1__
+
+			_base::_base(
+				__in_opt uint64_t seed
+				) :
+					m_seed(seed)
+			{
+				permute();
+			}
+
+			_base::_base(
+				__in const _base &other
+				) :
+					m_seed(other.m_seed)
+			{
+				std::memcpy(m_permutation, other.m_permutation, sizeof(m_permutation));
+			}
+
+			_base::~_base(void)
+			{
+				return;
+			}
+
+			_base & 
+			_base::operator=(
+				__in const _base &other
+				)
+			{
+
+				if(this != &other) {
+					m_seed = other.m_seed;
+					std::memcpy(m_permutation, other.m_permutation, sizeof(m_permutation));
+				}
+
+				return *this;
+			}
+
+			std::string 
+			_base::as_string(
+				__in const _base &object,
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << "SEED=" << SCALAR_AS_HEX(uint64_t, object.m_seed)
+#if defined(__AVX2__)
+					<< ", KERNEL=AVX2";
+#elif defined(__SSE4_1__)
+					<< ", KERNEL=SSE4.1";
+#else
+					<< ", KERNEL=SCALAR";
+#endif // __AVX2__
+
+				return result.str();
+			}
+
+			float 
+			_base::fbm(
+				__in float x,
+				__in float y,
+				__in float z,
+				__in_opt uint32_t octaves,
+				__in_opt float lacunarity,
+				__in_opt float gain
+				) const
+			{
+				uint32_t iter = 0;
+				float amplitude = 1.f, frequency = 1.f, result = 0.f, total = 0.f;
+
+				if(!octaves || (octaves > NOISE_OCTAVE_MAX)) {
+					THROW_GAEA_NOISE_EXCEPTION_FORMAT(GAEA_NOISE_EXCEPTION_INVALID,
+						"Octaves=%u (expecting 1-%u)", octaves, NOISE_OCTAVE_MAX);
+				}
+
+				for(; iter < octaves; ++iter) {
+					result += (amplitude * perlin(x * frequency, y * frequency, z * frequency));
+					total += amplitude;
+					amplitude *= gain;
+					frequency *= lacunarity;
+				}
+
+				return (result / total);
+			}
+
+			void 
+			_base::fbm(
+				__in const float x[NOISE_LANE],
+				__in const float y[NOISE_LANE],
+				__in const float z[NOISE_LANE],
+				__out float result[NOISE_LANE],
+				__in_opt uint32_t octaves,
+				__in_opt float lacunarity,
+				__in_opt float gain
+				) const
+			{
+				uint32_t iter = 0, lane;
+				float amplitude = 1.f, frequency = 1.f, octave[NOISE_LANE], sample_x[NOISE_LANE],
+					sample_y[NOISE_LANE], sample_z[NOISE_LANE], total = 0.f;
+
+				if(!octaves || (octaves > NOISE_OCTAVE_MAX)) {
+					THROW_GAEA_NOISE_EXCEPTION_FORMAT(GAEA_NOISE_EXCEPTION_INVALID,
+						"Octaves=%u (expecting 1-%u)", octaves, NOISE_OCTAVE_MAX);
+				}
+
+				for(lane = 0; lane < NOISE_LANE; ++lane) {
+					result[lane] = 0.f;
+				}
+
+				for(; iter < octaves; ++iter) {
+
+					for(lane = 0; lane < NOISE_LANE; ++lane) {
+						sample_x[lane] = (x[lane] * frequency);
+						sample_y[lane] = (y[lane] * frequency);
+						sample_z[lane] = (z[lane] * frequency);
+					}
+
+					perlin(sample_x, sample_y, sample_z, octave);
+
+					for(lane = 0; lane < NOISE_LANE; ++lane) {
+						result[lane] += (amplitude * octave[lane]);
+					}
+
+					total += amplitude;
+					amplitude *= gain;
+					frequency *= lacunarity;
+				}
+
+				for(lane = 0; lane < NOISE_LANE; ++lane) {
+					result[lane] /= total;
+				}
+			}
+
+			float 
+			_base::perlin(
+				__in float x,
+				__in float y,
+				__in float z
+				) const
+			{
+				float floor_x = std::floor(x), floor_y = std::floor(y), floor_z = std::floor(z), u, v, w;
+				int32_t a, aa, ab, b, ba, bb, cell_x = ((int32_t) floor_x & NOISE_MASK),
+					cell_y = ((int32_t) floor_y & NOISE_MASK), cell_z = ((int32_t) floor_z & NOISE_MASK);
+
+				x -= floor_x;
+				y -= floor_y;
+				z -= floor_z;
+				u = fade(x);
+				v = fade(y);
+				w = fade(z);
+				a = (m_permutation[cell_x] + cell_y);
+				aa = (m_permutation[a] + cell_z);
+				ab = (m_permutation[a + 1] + cell_z);
+				b = (m_permutation[cell_x + 1] + cell_y);
+				ba = (m_permutation[b] + cell_z);
+				bb = (m_permutation[b + 1] + cell_z);
+
+				return lerp(w, lerp(v, lerp(u, gradient(m_permutation[aa], x, y, z),
+							gradient(m_permutation[ba], x - 1.f, y, z)),
+						lerp(u, gradient(m_permutation[ab], x, y - 1.f, z),
+							gradient(m_permutation[bb], x - 1.f, y - 1.f, z))),
+					lerp(v, lerp(u, gradient(m_permutation[aa + 1], x, y, z - 1.f),
+							gradient(m_permutation[ba + 1], x - 1.f, y, z - 1.f)),
+						lerp(u, gradient(m_permutation[ab + 1], x, y - 1.f, z - 1.f),
+							gradient(m_permutation[bb + 1], x - 1.f, y - 1.f, z - 1.f))));
+			}
+
+			void 
+			_base::perlin(
+				__in const float x[NOISE_LANE],
+				__in const float y[NOISE_LANE],
+				__in const float z[NOISE_LANE],
+				__out float result[NOISE_LANE]
+				) const
+			{
+#if defined(__SSE4_1__)
+				__m128 floor_x, floor_y, floor_z, one = _mm_set1_ps(1.f), position_x, position_y, position_z,
+					u, v, w, x1, y1, z1;
+				__m128i a, aa, ab, b, ba, bb, cell_x, cell_y, cell_z, mask = _mm_set1_epi32(NOISE_MASK),
+					next = _mm_set1_epi32(1);
+
+				position_x = _mm_loadu_ps(x);
+				position_y = _mm_loadu_ps(y);
+				position_z = _mm_loadu_ps(z);
+				floor_x = _mm_floor_ps(position_x);
+				floor_y = _mm_floor_ps(position_y);
+				floor_z = _mm_floor_ps(position_z);
+				cell_x = _mm_and_si128(_mm_cvttps_epi32(floor_x), mask);
+				cell_y = _mm_and_si128(_mm_cvttps_epi32(floor_y), mask);
+				cell_z = _mm_and_si128(_mm_cvttps_epi32(floor_z), mask);
+				position_x = _mm_sub_ps(position_x, floor_x);
+				position_y = _mm_sub_ps(position_y, floor_y);
+				position_z = _mm_sub_ps(position_z, floor_z);
+				x1 = _mm_sub_ps(position_x, one);
+				y1 = _mm_sub_ps(position_y, one);
+				z1 = _mm_sub_ps(position_z, one);
+				u = fade(position_x);
+				v = fade(position_y);
+				w = fade(position_z);
+				a = _mm_add_epi32(lookup(m_permutation, cell_x), cell_y);
+				aa = _mm_add_epi32(lookup(m_permutation, a), cell_z);
+				ab = _mm_add_epi32(lookup(m_permutation, _mm_add_epi32(a, next)), cell_z);
+				b = _mm_add_epi32(lookup(m_permutation, _mm_add_epi32(cell_x, next)), cell_y);
+				ba = _mm_add_epi32(lookup(m_permutation, b), cell_z);
+				bb = _mm_add_epi32(lookup(m_permutation, _mm_add_epi32(b, next)), cell_z);
+
+				_mm_storeu_ps(result, lerp(w,
+					lerp(v, lerp(u, gradient(lookup(m_permutation, aa), position_x, position_y, position_z),
+							gradient(lookup(m_permutation, ba), x1, position_y, position_z)),
+						lerp(u, gradient(lookup(m_permutation, ab), position_x, y1, position_z),
+							gradient(lookup(m_permutation, bb), x1, y1, position_z))),
+					lerp(v, lerp(u, gradient(lookup(m_permutation, _mm_add_epi32(aa, next)),
+								position_x, position_y, z1),
+							gradient(lookup(m_permutation, _mm_add_epi32(ba, next)), x1, position_y, z1)),
+						lerp(u, gradient(lookup(m_permutation, _mm_add_epi32(ab, next)), position_x, y1, z1),
+							gradient(lookup(m_permutation, _mm_add_epi32(bb, next)), x1, y1, z1)))));
+#else
+				size_t lane = 0;
+
+				for(; lane < NOISE_LANE; ++lane) {
+					result[lane] = perlin(x[lane], y[lane], z[lane]);
+				}
+#endif // __SSE4_1__
+			}
+
+			void 
+			_base::permute(void)
+			{
+				int32_t entry;
+				uint64_t state = m_seed;
+				size_t iter = 0, offset;
+
+				for(; iter < NOISE_PERMUTATION; ++iter) {
+					m_permutation[iter] = iter;
+				}
+
+				for(iter = (NOISE_PERMUTATION - 1); iter > 0; --iter) {
+					offset = (split_mix(state) % (iter + 1));
+					entry = m_permutation[iter];
+					m_permutation[iter] = m_permutation[offset];
+					m_permutation[offset] = entry;
+				}
+
+				for(iter = 0; iter < NOISE_PERMUTATION; ++iter) {
+					m_permutation[iter + NOISE_PERMUTATION] = m_permutation[iter];
+				}
+			}
+
+			uint64_t 
+			_base::seed(void) const
+			{
+				return m_seed;
+			}
+
+			std::string 
+			_base::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::engine::noise::base::as_string(*this, verbose);
+			}
+		}
+	}
+}
@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cstring>
 #include "../../include/gaea.h"
 #include "gaea_observer_type.h"
 
@@ -33,6 +35,10 @@ namespace gaea {
 			#define INPUT_YAW_MAX 360.f
 			#define INPUT_YAW_MIN 0.f
 
+			#define INPUT_AXIS_RANGE 32767.f
+			#define INPUT_COORDINATE(_X_, _Y_) \
+				((((uint64_t) (uint32_t) (_X_)) << 32) | ((uint64_t) (uint32_t) (_Y_)))
+
 			#define BUTTON_STRING(_TYPE_) \
 				((_TYPE_) > BUTTON_MAX ? STRING_UNKNOWN : \
 				STRING_CHECK(BUTTON_STR[_TYPE_]))
@@ -41,12 +47,6 @@ namespace gaea {
 				((_TYPE_) > KEY_MAX ? STRING_UNKNOWN : \
 				STRING_CHECK(KEY_STR[_TYPE_]))
 
-			enum {
-				INPUT_BUTTON_CLICK = 0,
-				INPUT_BUTTON_COORDINATE,
-				INPUT_BUTTON_STATE,
-			};
-
 			static const std::string BUTTON_STR[] = {
 				"LEFT", "MIDDLE", "RIGHT", "X1", "X2",
 				};
@@ -247,13 +247,14 @@ namespace gaea {
 			}
 
 			_base_input::_base_input(
-				__in glm::vec3 &position_reference,
+				__in glm::dvec3 &position_reference,
 				__in glm::vec3 &rotation_reference,
 				__in glm::vec3 &up_reference,
 				__in_opt const std::map<gaea::key_t, SDL_Scancode> &key_map,
 				__in_opt GLfloat speed,
 				__in_opt GLfloat sensitivity
 				) :
+					m_action_frame(0),
 					m_position_delta(glm::vec3()),
 					m_position_reference(position_reference),
 					m_rotation_current(glm::vec3()),
@@ -265,6 +266,7 @@ namespace gaea {
 					m_up_reference(up_reference),
 					m_wheel_delta(0)
 			{
+				clear();
 				setup(key_map, speed, sensitivity);
 				setup();
 			}
@@ -273,8 +275,7 @@ namespace gaea {
 				__in const _base_input &other
 				) :
 					gaea::engine::observer::base(other),
-					m_button(other.m_button),
-					m_key(other.m_key),
+					m_action_frame(0),
 					m_key_map(other.m_key_map),
 					m_position_delta(other.m_position_delta),
 					m_position_reference(other.m_position_reference),
@@ -304,8 +305,6 @@ namespace gaea {
 
 				if(this != &other) {
 					gaea::engine::observer::base::operator=(other);
-					m_button = other.m_button;
-					m_key = other.m_key;
 					m_key_map = other.m_key_map;
 					m_position_delta = other.m_position_delta;
 					m_position_reference = other.m_position_reference;
@@ -330,29 +329,38 @@ namespace gaea {
 				__in_opt bool verbose
 				)
 			{
-				std::stringstream result;				
-				std::map<SDL_Scancode, bool>::const_iterator key_iter;				
-				std::map<gaea::key_t, SDL_Scancode>::const_iterator key_map_iter;
-				std::map<gaea::button_t, std::tuple<uint8_t, glm::ivec2, bool>>::const_iterator button_iter;
+				uint8_t click;
+				size_t count = 0, iter = 0;
+				glm::ivec2 coordinate;
+				std::stringstream result;
+
+				for(; iter <= BUTTON_MAX; ++iter) {
+
+					if(object.m_current.button & INPUT_BIT(iter)) {
+						++count;
+					}
+				}
 
 				result << gaea::engine::observer::base::as_string(object, verbose)
-					<< ", BUT[" << object.m_button.size() << "]";
+					<< ", BUT[" << count << "]";
 
-				if(!object.m_button.empty()) {
+				if(count) {
 					result << "={";
 
-					for(button_iter = object.m_button.begin(); button_iter != object.m_button.end();
-							++button_iter) {
+					for(count = 0, iter = 0; iter <= BUTTON_MAX; ++iter) {
+
+						if(!(object.m_current.button & INPUT_BIT(iter))) {
+							continue;
+						}
 
-						if(button_iter != object.m_button.begin()) {
+						if(count++) {
 							result << "; ";
 						}
 
-						result << BUTTON_STRING(button_iter->first) 
-							<< "=(" << TUPLE_ENTRY(button_iter->second, INPUT_BUTTON_CLICK) 
-							<< ", {" << TUPLE_ENTRY(button_iter->second, INPUT_BUTTON_COORDINATE).x
-								<< ", " << TUPLE_ENTRY(button_iter->second, INPUT_BUTTON_COORDINATE).y << "}"
-							<< ", " << TUPLE_ENTRY(button_iter->second, INPUT_BUTTON_STATE) << ")";
+						object.m_live.coordinate((gaea::button_t) iter, coordinate, click);
+						result << BUTTON_STRING(iter)
+							<< "=(" << (int) click
+							<< ", {" << coordinate.x << ", " << coordinate.y << "})";
 					}
 
 					result << "}";
@@ -363,21 +371,15 @@ namespace gaea {
 				if(!object.m_key_map.empty()) {
 					result << "={";
 
-					for(key_map_iter = object.m_key_map.begin(); key_map_iter != object.m_key_map.end();
-							++key_map_iter) {
+					for(iter = 0; iter < object.m_key_map.size(); ++iter) {
 
-						if(key_map_iter != object.m_key_map.begin()) {
+						if(iter) {
 							result << ", ";
 						}
 
-						result << KEY_STRING(key_map_iter->first) 
-							<< "(" << SCALAR_AS_HEX(SDL_Scancode, key_map_iter->second) 
-							<< ")=";
-
-						key_iter = object.m_key.find(key_map_iter->second);
-						if(key_iter != object.m_key.end()) {
-							result << key_iter->second;
-						}
+						result << KEY_STRING(iter)
+							<< "(" << SCALAR_AS_HEX(SDL_Scancode, object.m_key_map.at(iter))
+							<< ")=" << INPUT_TEST(object.m_current.key, object.m_key_map.at(iter));
 					}
 
 					result << "}";
@@ -391,8 +393,11 @@ namespace gaea {
 			void 
 			_base_input::clear(void)
 			{
-				m_button.clear();
-				m_key.clear();
+				m_action_frame = 0;
+				m_live.clear();
+				std::memset(&m_current, 0, sizeof(m_current));
+				std::memset(&m_pressed, 0, sizeof(m_pressed));
+				std::memset(&m_released, 0, sizeof(m_released));
 				m_position_delta = glm::vec3();
 				m_rotation_current = glm::vec3();
 				m_rotation_delta = glm::vec3();
@@ -428,7 +433,7 @@ namespace gaea {
 									"%s", STRING_CHECK(event.to_string(true)));
 							}
 
-							instance->on_button(*button);
+							instance->m_live.on_button(*button);
 							break;
 						case EVENT_INPUT_KEY:
 
@@ -438,7 +443,7 @@ namespace gaea {
 									"%s", STRING_CHECK(event.to_string(true)));
 							}
 
-							instance->on_key(*key);
+							instance->m_live.on_key(*key);
 							break;
 						case EVENT_INPUT_MOTION:
 
@@ -448,7 +453,7 @@ namespace gaea {
 									"%s", STRING_CHECK(event.to_string(true)));
 							}
 
-							instance->on_motion(*motion);
+							instance->m_live.on_motion(*motion);
 							break;
 						case EVENT_INPUT_WHEEL:
 
@@ -458,7 +463,7 @@ namespace gaea {
 									"%s", STRING_CHECK(event.to_string(true)));
 							}
 
-							instance->on_wheel(*wheel);
+							instance->m_live.on_wheel(*wheel);
 							break;
 						default:
 							break;
@@ -473,93 +478,57 @@ namespace gaea {
 				__out uint8_t &click
 				)
 			{
-				bool result = false;
-				std::map<gaea::button_t, std::tuple<uint8_t, glm::ivec2, bool>>::iterator iter;
-
-				coordinate = glm::ivec2();
-				click = 0;
-
-				iter = m_button.find(type);
-				if(iter != m_button.end()) {
-					result = TUPLE_ENTRY(iter->second, INPUT_BUTTON_STATE);
-					coordinate = TUPLE_ENTRY(iter->second, INPUT_BUTTON_COORDINATE);
-					click = TUPLE_ENTRY(iter->second, INPUT_BUTTON_CLICK);
-				}
+				m_live.coordinate(type, coordinate, click);
 
-				return result;
+				return ((type <= BUTTON_MAX) && (m_current.button & INPUT_BIT(type)));
 			}
 
 			bool 
-			_base_input::is_key_pressed(
-				__in gaea::key_t type
+			_base_input::is_button_released(
+				__in gaea::button_t type
 				)
 			{
-				bool result = false;
-				std::map<SDL_Scancode, bool>::iterator key_iter;
-				std::map<gaea::key_t, SDL_Scancode>::iterator key_map_iter;
-
-				key_map_iter = m_key_map.find(type);
-				if(key_map_iter != m_key_map.end()) {
-
-					key_iter = m_key.find(key_map_iter->second);
-					if(key_iter != m_key.end()) {
-						result = key_iter->second;
-					}
-				}
-
-				return result;
+				return ((type <= BUTTON_MAX) && (m_released.button & INPUT_BIT(type)));
 			}
 
-			void 
-			_base_input::on_button(
-				__in const SDL_MouseButtonEvent &event
+			bool 
+			_base_input::is_button_triggered(
+				__in gaea::button_t type
 				)
 			{
-				std::map<gaea::button_t, std::tuple<uint8_t, glm::ivec2, bool>>::iterator iter;
-
-				iter = m_button.find((gaea::button_t) event.button);
-				if(iter == m_button.end()) {
-					m_button.insert(std::pair<gaea::button_t, std::tuple<uint8_t, glm::ivec2, bool>>(
-						(gaea::button_t) event.button, std::make_tuple(event.clicks, glm::ivec2(event.x, event.y),
-						event.state == SDL_PRESSED)));
-				} else {
-					TUPLE_ENTRY(iter->second, INPUT_BUTTON_STATE) = (event.state == SDL_PRESSED);
-				}
+				return ((type <= BUTTON_MAX) && (m_pressed.button & INPUT_BIT(type)));
 			}
 
-			void 
-			_base_input::on_key(
-				__in const SDL_KeyboardEvent &event
+			bool 
+			_base_input::is_key_pressed(
+				__in gaea::key_t type
 				)
 			{
-				std::map<SDL_Scancode, bool>::iterator iter;
-
-				if(!event.repeat) {
+				return ((type <= KEY_MAX) && INPUT_TEST(m_current.key, m_key_map[type]));
+			}
 
-					iter = m_key.find(event.keysym.scancode);
-					if(iter == m_key.end()) {
-						m_key.insert(std::pair<SDL_Scancode, bool>(event.keysym.scancode, 
-							event.state == SDL_PRESSED));
-					} else {
-						iter->second = (event.state == SDL_PRESSED);
-					}
-				}
+			bool 
+			_base_input::is_key_released(
+				__in gaea::key_t type
+				)
+			{
+				return ((type <= KEY_MAX) && INPUT_TEST(m_released.key, m_key_map[type]));
 			}
 
-			void 
-			_base_input::on_motion(
-				__in const SDL_MouseMotionEvent &event
+			bool 
+			_base_input::is_key_triggered(
+				__in gaea::key_t type
 				)
 			{
-				m_rotation_delta += glm::vec3(event.xrel, event.yrel, 0.f);
+				return ((type <= KEY_MAX) && INPUT_TEST(m_pressed.key, m_key_map[type]));
 			}
 
-			void 
-			_base_input::on_wheel(
-				__in const SDL_MouseWheelEvent &event
+			bool 
+			_base_input::is_scancode_pressed(
+				__in SDL_Scancode scancode
 				)
 			{
-				m_wheel_delta += event.y;
+				return ((scancode < SDL_NUM_SCANCODES) && INPUT_TEST(m_current.key, scancode));
 			}
 
 			void 
@@ -577,10 +546,9 @@ namespace gaea {
 				)
 			{
 				size_t iter = 0;
+				std::vector<SDL_Scancode> entry(KEY_COUNT, SDL_SCANCODE_UNKNOWN);
 				std::map<gaea::key_t, SDL_Scancode>::const_iterator key_iter;
 
-				m_key.clear();
-
 				for(; iter <= KEY_MAX; ++iter) {
 
 					key_iter = key_map.find((gaea::key_t) iter);
@@ -588,9 +556,16 @@ namespace gaea {
 						THROW_GAEA_OBSERVER_EXCEPTION_FORMAT(GAEA_OBSERVER_EXCEPTION_MISSING_KEY,
 							"%s(%x)", KEY_STRING(iter), iter);
 					}
+
+					if(key_iter->second >= SDL_NUM_SCANCODES) {
+						THROW_GAEA_OBSERVER_EXCEPTION_FORMAT(GAEA_OBSERVER_EXCEPTION_INVALID_SCANCODE,
+							"%s(%x)", KEY_STRING(iter), key_iter->second);
+					}
+
+					entry.at(iter) = key_iter->second;
 				}
 
-				m_key_map = key_map;
+				m_key_map = entry;
 
 				m_sensitivity = sensitivity;
 				if(m_sensitivity < INPUT_SENSITIVITY_MIN) {
@@ -603,6 +578,14 @@ namespace gaea {
 				}
 			}
 
+			void 
+			_base_input::snapshot(
+				__out gaea::engine::observer::state_t &state
+				) const
+			{
+				m_live.snapshot(state);
+			}
+
 			std::string 
 			_base_input::to_string(
 				__in_opt bool verbose
@@ -616,46 +599,91 @@ namespace gaea {
 				__in GLfloat delta
 				)
 			{
-				std::map<SDL_Scancode, bool>::iterator key_iter;
-				std::map<gaea::key_t, SDL_Scancode>::iterator key_map_iter;
-				GLfloat forward_speed = (m_speed * delta), rotational_speed, 
-						strafe_speed = (forward_speed * INPUT_STRAFE_SCALE);
-
-				for(key_map_iter = m_key_map.begin(); key_map_iter != m_key_map.end(); ++key_map_iter) {
-
-					key_iter = m_key.find(key_map_iter->second);
-					if((key_iter != m_key.end()) && key_iter->second) {
-
-						switch(key_map_iter->first) {
-							case KEY_BACKWARD:
-								m_position_delta -= (m_rotation_reference * forward_speed);
-								break;
-							case KEY_FORWARD:
-								m_position_delta += (m_rotation_reference * forward_speed);
-								break;
-							case KEY_LEFT:
-								m_position_delta -= (glm::normalize(
-									glm::cross(m_rotation_reference, m_up_reference)) 
-									* strafe_speed);
-								break;
-							case KEY_RIGHT:
-								m_position_delta += (glm::normalize(
-									glm::cross(m_rotation_reference, m_up_reference)) 
-									* strafe_speed);
-								break;
-							default:
-								break;
-						}
+				size_t iter = 0;
+				glm::ivec2 motion;
+				gaea::engine::action::state_t state;
+				GLfloat forward_speed, rotational_speed, sensitivity = m_sensitivity, speed = m_speed, strafe_speed;
+				bool action = (gaea::engine::action::manager::is_allocated()
+					&& gaea::engine::action::manager::acquire().is_initialized());
+
+				// edges come only from the latches, so each transition is reported exactly once
+				m_live.latch(m_pressed, m_released);
+				m_live.snapshot(m_current);
+				motion = m_live.motion();
+				m_rotation_delta += glm::vec3(motion.x, motion.y, 0.f);
+				m_wheel_delta += m_live.wheel();
+
+				if(action) {
+					gaea::engine::action::manager &instance = gaea::engine::action::manager::acquire();
+
+					state = instance.state();
+					sensitivity = instance.sensitivity();
+					speed = instance.speed();
+				}
+
+				forward_speed = (speed * delta);
+				strafe_speed = (forward_speed * INPUT_STRAFE_SCALE);
+
+				if(action) {
+
+					// the look axes already carry mouse motion, and are per frame rather than per tick
+					m_rotation_delta = glm::vec3();
+					if(state.frame != m_action_frame) {
+						m_action_frame = state.frame;
+						m_rotation_delta = glm::vec3(state.axis[AXIS_LOOK_X], state.axis[AXIS_LOOK_Y], 0.f);
+					}
+
+					m_position_delta += (m_rotation_reference * (state.axis[AXIS_MOVE_Y] * forward_speed));
+
+					if(state.axis[AXIS_MOVE_X] != 0.f) {
+						m_position_delta += (glm::normalize(glm::cross(m_rotation_reference, m_up_reference))
+							* (state.axis[AXIS_MOVE_X] * strafe_speed));
+					}
+
+					if(state.down & ACTION_BIT(ACTION_ASCEND)) {
+						m_position_delta += (m_up_reference * forward_speed);
+					}
+
+					if(state.down & ACTION_BIT(ACTION_DESCEND)) {
+						m_position_delta -= (m_up_reference * forward_speed);
+					}
+				}
+
+				for(; !action && (iter <= KEY_MAX); ++iter) {
+
+					if(!INPUT_TEST(m_current.key, m_key_map[iter])) {
+						continue;
+					}
+
+					switch(iter) {
+						case KEY_BACKWARD:
+							m_position_delta -= (m_rotation_reference * forward_speed);
+							break;
+						case KEY_FORWARD:
+							m_position_delta += (m_rotation_reference * forward_speed);
+							break;
+						case KEY_LEFT:
+							m_position_delta -= (glm::normalize(
+								glm::cross(m_rotation_reference, m_up_reference)) 
+								* strafe_speed);
+							break;
+						case KEY_RIGHT:
+							m_position_delta += (glm::normalize(
+								glm::cross(m_rotation_reference, m_up_reference)) 
+								* strafe_speed);
+							break;
+						default:
+							break;
 					}
 				}
 
 				if(m_position_delta != glm::vec3()) {
-					m_position_reference += m_position_delta;
+					m_position_reference += glm::dvec3(m_position_delta);
 					m_position_delta = glm::vec3();
 				}
 
 				if(m_rotation_delta != glm::vec3()) {
-					rotational_speed = (m_sensitivity * delta);
+					rotational_speed = (sensitivity * delta);
 
 					m_rotation_current.x -= (m_rotation_delta.y * rotational_speed);
 					if(m_rotation_current.x < -INPUT_PITCH_MAX) {
@@ -686,6 +714,227 @@ namespace gaea {
 					m_wheel_delta = 0;
 				}
 			}
+
+			_live::_live(void)
+			{
+				clear();
+			}
+
+			_live::~_live(void)
+			{
+				return;
+			}
+
+			GLfloat 
+			_live::axis(
+				__in uint32_t index
+				) const
+			{
+				GLfloat result = 0.f;
+
+				if(index < SDL_CONTROLLER_AXIS_MAX) {
+					result = std::max(-1.f, m_controller_axis[index].load() / INPUT_AXIS_RANGE);
+				}
+
+				return result;
+			}
+
+			void 
+			_live::clear(void)
+			{
+				size_t iter = 0;
+
+				m_button = 0;
+				m_button_pressed = 0;
+				m_button_released = 0;
+
+				for(; iter <= BUTTON_MAX; ++iter) {
+					m_button_click[iter] = 0;
+					m_button_coordinate[iter] = 0;
+				}
+
+				for(iter = 0; iter < INPUT_WORD_COUNT; ++iter) {
+					m_key[iter] = 0;
+					m_key_pressed[iter] = 0;
+					m_key_released[iter] = 0;
+				}
+
+				clear_controller();
+				m_controller_button_pressed = 0;
+				m_controller_button_released = 0;
+				m_motion_x = 0;
+				m_motion_y = 0;
+				m_wheel = 0;
+			}
+
+			void 
+			_live::clear_controller(void)
+			{
+				size_t iter = 0;
+
+				for(; iter < SDL_CONTROLLER_AXIS_MAX; ++iter) {
+					m_controller_axis[iter] = 0;
+				}
+
+				m_controller_button = 0;
+			}
+
+			void 
+			_live::coordinate(
+				__in gaea::button_t type,
+				__out glm::ivec2 &coordinate,
+				__out uint8_t &click
+				) const
+			{
+				uint64_t position;
+
+				coordinate = glm::ivec2();
+				click = 0;
+
+				if(type <= BUTTON_MAX) {
+					position = m_button_coordinate[type].load();
+					coordinate = glm::ivec2((int32_t) (position >> 32), (int32_t) (uint32_t) position);
+					click = m_button_click[type].load();
+				}
+			}
+
+			void 
+			_live::latch(
+				__out gaea::engine::observer::state_t &pressed,
+				__out gaea::engine::observer::state_t &released
+				)
+			{
+				size_t iter = 0;
+
+				pressed.button = m_button_pressed.exchange(0);
+				released.button = m_button_released.exchange(0);
+				pressed.controller_button = m_controller_button_pressed.exchange(0);
+				released.controller_button = m_controller_button_released.exchange(0);
+
+				for(; iter < INPUT_WORD_COUNT; ++iter) {
+					pressed.key[iter] = m_key_pressed[iter].exchange(0);
+					released.key[iter] = m_key_released[iter].exchange(0);
+				}
+			}
+
+			glm::ivec2 
+			_live::motion(void)
+			{
+				return glm::ivec2(m_motion_x.exchange(0), m_motion_y.exchange(0));
+			}
+
+			void 
+			_live::on_button(
+				__in const SDL_MouseButtonEvent &event
+				)
+			{
+				uint64_t bit;
+				size_t index = (event.button - SDL_BUTTON_LEFT);
+
+				if(index <= BUTTON_MAX) {
+					bit = INPUT_BIT(index);
+					m_button_click[index] = event.clicks;
+					m_button_coordinate[index] = INPUT_COORDINATE(event.x, event.y);
+
+					if(event.state == SDL_PRESSED) {
+						m_button.fetch_or(bit);
+						m_button_pressed.fetch_or(bit);
+					} else {
+						m_button.fetch_and(~bit);
+						m_button_released.fetch_or(bit);
+					}
+				}
+			}
+
+			void 
+			_live::on_controller_axis(
+				__in const SDL_ControllerAxisEvent &event
+				)
+			{
+
+				if(event.axis < SDL_CONTROLLER_AXIS_MAX) {
+					m_controller_axis[event.axis] = event.value;
+				}
+			}
+
+			void 
+			_live::on_controller_button(
+				__in const SDL_ControllerButtonEvent &event
+				)
+			{
+				uint64_t bit;
+
+				if(event.button < SDL_CONTROLLER_BUTTON_MAX) {
+					bit = INPUT_BIT(event.button);
+
+					if(event.state == SDL_PRESSED) {
+						m_controller_button.fetch_or(bit);
+						m_controller_button_pressed.fetch_or(bit);
+					} else {
+						m_controller_button.fetch_and(~bit);
+						m_controller_button_released.fetch_or(bit);
+					}
+				}
+			}
+
+			void 
+			_live::on_key(
+				__in const SDL_KeyboardEvent &event
+				)
+			{
+				uint64_t bit;
+				size_t index = event.keysym.scancode;
+
+				if(!event.repeat && (index < SDL_NUM_SCANCODES)) {
+					bit = INPUT_BIT(index);
+
+					if(event.state == SDL_PRESSED) {
+						m_key[INPUT_WORD(index)].fetch_or(bit);
+						m_key_pressed[INPUT_WORD(index)].fetch_or(bit);
+					} else {
+						m_key[INPUT_WORD(index)].fetch_and(~bit);
+						m_key_released[INPUT_WORD(index)].fetch_or(bit);
+					}
+				}
+			}
+
+			void 
+			_live::on_motion(
+				__in const SDL_MouseMotionEvent &event
+				)
+			{
+				m_motion_x += event.xrel;
+				m_motion_y += event.yrel;
+			}
+
+			void 
+			_live::on_wheel(
+				__in const SDL_MouseWheelEvent &event
+				)
+			{
+				m_wheel += event.y;
+			}
+
+			void 
+			_live::snapshot(
+				__out gaea::engine::observer::state_t &state
+				) const
+			{
+				size_t iter = 0;
+
+				state.button = m_button.load();
+				state.controller_button = m_controller_button.load();
+
+				for(; iter < INPUT_WORD_COUNT; ++iter) {
+					state.key[iter] = m_key[iter].load();
+				}
+			}
+
+			int32_t 
+			_live::wheel(void)
+			{
+				return m_wheel.exchange(0);
+			}
 		}
 	}
 }
@@ -38,6 +38,7 @@ namespace gaea {
 				GAEA_OBSERVER_EXCEPTION_INVALID_HANDLER,
 				GAEA_OBSERVER_EXCEPTION_INVALID_CONTEXT,
 				GAEA_OBSERVER_EXCEPTION_INVALID_EVENT,
+				GAEA_OBSERVER_EXCEPTION_INVALID_SCANCODE,
 				GAEA_OBSERVER_EXCEPTION_INVALID_TYPE,
 				GAEA_OBSERVER_EXCEPTION_MISSING_KEY,
 				GAEA_OBSERVER_EXCEPTION_REGISTERED,
@@ -50,6 +51,7 @@ namespace gaea {
 				GAEA_OBSERVER_EXCEPTION_HEADER "Invalid event handler",
 				GAEA_OBSERVER_EXCEPTION_HEADER "Invalid context",
 				GAEA_OBSERVER_EXCEPTION_HEADER "Invalid event context",
+				GAEA_OBSERVER_EXCEPTION_HEADER "Invalid key scancode",
 				GAEA_OBSERVER_EXCEPTION_HEADER "Invalid event type",
 				GAEA_OBSERVER_EXCEPTION_HEADER "Missing key mapping",
 				GAEA_OBSERVER_EXCEPTION_HEADER "Event handler is registered",
@@ -0,0 +1,574 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#if defined(__SSE4_1__)
+#include <immintrin.h>
+#endif // __SSE4_1__
+#include "../../include/gaea.h"
+#include "gaea_occlusion_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace occlusion {
+
+			#define OCCLUSION_AREA_MIN 1e-6f
+			#define OCCLUSION_BOX_INDEX 36
+			#define OCCLUSION_BOX_VERTEX 8
+			#define OCCLUSION_DEPTH_CLEAR 1.f
+			#define OCCLUSION_LANE 4
+			#define OCCLUSION_W_MIN 1e-4f
+
+			static const uint32_t OCCLUSION_BOX_INDICES[OCCLUSION_BOX_INDEX] = {
+				0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5, 0, 1, 5, 0, 5, 4,
+				2, 6, 7, 2, 7, 3, 0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6,
+				};
+
+			_base::_base(void) :
+				m_depth(OCCLUSION_WIDTH * OCCLUSION_HEIGHT, OCCLUSION_DEPTH_CLEAR),
+				m_occluder(0)
+			{
+				return;
+			}
+
+			_base::_base(
+				__in const _base &other
+				) :
+					m_depth(other.m_depth),
+					m_occluder(other.m_occluder)
+			{
+				return;
+			}
+
+			_base::~_base(void)
+			{
+				return;
+			}
+
+			_base &
+			_base::operator=(
+				__in const _base &other
+				)
+			{
+
+				if(this != &other) {
+					m_depth = other.m_depth;
+					m_occluder = other.m_occluder;
+				}
+
+				return *this;
+			}
+
+			std::string 
+			_base::as_string(
+				__in const _base &object,
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << "DIM={" << OCCLUSION_WIDTH << ", " << OCCLUSION_HEIGHT << "}"
+					<< ", OCCLUDERS=" << object.m_occluder;
+
+				return result.str();
+			}
+
+			void 
+			_base::clear(void)
+			{
+				std::fill(m_depth.begin(), m_depth.end(), OCCLUSION_DEPTH_CLEAR);
+				m_occluder = 0;
+			}
+
+			const std::vector<float> &
+			_base::depth(void)
+			{
+				return m_depth;
+			}
+
+			bool 
+			_base::project(
+				__in const glm::mat4 &transform,
+				__in const gaea::engine::occlusion::box_t &box,
+				__out glm::vec3 corner[]
+				)
+			{
+				glm::vec4 clip;
+				bool result = true;
+				uint32_t iter = 0;
+
+				for(; iter < OCCLUSION_BOX_VERTEX; ++iter) {
+					clip = (transform * glm::vec4((iter & 1) ? box.maximum.x : box.minimum.x,
+						(iter & 2) ? box.maximum.y : box.minimum.y, (iter & 4) ? box.maximum.z : box.minimum.z, 1.f));
+
+					if(clip.w < OCCLUSION_W_MIN) {
+						result = false;
+						break;
+					}
+
+					corner[iter] = glm::vec3((((clip.x / clip.w) * 0.5f) + 0.5f) * OCCLUSION_WIDTH,
+						(((clip.y / clip.w) * 0.5f) + 0.5f) * OCCLUSION_HEIGHT, ((clip.z / clip.w) * 0.5f) + 0.5f);
+
+					if(corner[iter].z < 0.f) {
+						result = false;
+						break;
+					}
+				}
+
+				return result;
+			}
+
+			void 
+			_base::rasterize(
+				__in const glm::mat4 &transform,
+				__in const gaea::engine::occlusion::box_t &box
+				)
+			{
+				uint32_t iter = 0;
+				glm::vec3 corner[OCCLUSION_BOX_VERTEX];
+
+				if(project(transform, box, corner)) {
+
+					for(; iter < OCCLUSION_BOX_INDEX; iter += 3) {
+						triangle(corner[OCCLUSION_BOX_INDICES[iter]], corner[OCCLUSION_BOX_INDICES[iter + 1]],
+							corner[OCCLUSION_BOX_INDICES[iter + 2]]);
+					}
+
+					++m_occluder;
+				}
+			}
+
+			void 
+			_base::rasterize(
+				__in const glm::mat4 &transform,
+				__in const std::vector<gaea::engine::occlusion::box_t> &box
+				)
+			{
+				std::vector<gaea::engine::occlusion::box_t>::const_iterator iter;
+
+				for(iter = box.begin(); iter != box.end(); ++iter) {
+					rasterize(transform, *iter);
+				}
+			}
+
+			std::string 
+			_base::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::engine::occlusion::base::as_string(*this, verbose);
+			}
+
+			void 
+			_base::triangle(
+				__in const glm::vec3 &first,
+				__in const glm::vec3 &second,
+				__in const glm::vec3 &third
+				)
+			{
+				int x, y;
+				float inverse, plane[3][3], sample[3], z[3];
+				const glm::vec3 *vertex[3] = { &first, &second, &third };
+				int maximum_x, maximum_y, minimum_x, minimum_y, row;
+				float area = (((second.x - first.x) * (third.y - first.y)) - ((second.y - first.y) * (third.x - first.x)));
+
+				if(std::fabs(area) < OCCLUSION_AREA_MIN) {
+					return;
+				}
+
+				if(area < 0.f) {
+					std::swap(vertex[1], vertex[2]);
+					area = -area;
+				}
+
+				minimum_x = std::max(0, (int) std::floor(std::min(first.x, std::min(second.x, third.x))));
+				maximum_x = std::min(OCCLUSION_WIDTH - 1, (int) std::ceil(std::max(first.x, std::max(second.x, third.x))));
+				minimum_y = std::max(0, (int) std::floor(std::min(first.y, std::min(second.y, third.y))));
+				maximum_y = std::min(OCCLUSION_HEIGHT - 1, (int) std::ceil(std::max(first.y, std::max(second.y, third.y))));
+				if((minimum_x > maximum_x) || (minimum_y > maximum_y)) {
+					return;
+				}
+
+				/*
+				 * Edge function of vertex (x + 1) -> (x + 2) for each x, as A * px + B * py + C,
+				 * where it is non-negative inside the triangle. Each edge is evaluated from its
+				 * lesser endpoint and negated as needed, so triangles sharing an edge compute
+				 * exactly opposite values and leave no cracks. Depth is interpolated the same way.
+				 */
+				for(x = 0; x < 3; ++x) {
+					const glm::vec3 *begin = vertex[(x + 1) % 3], *end = vertex[(x + 2) % 3];
+					float sign = 1.f;
+
+					if((end->x < begin->x) || ((end->x == begin->x) && (end->y < begin->y))) {
+						std::swap(begin, end);
+						sign = -1.f;
+					}
+
+					plane[x][0] = (sign * -(end->y - begin->y));
+					plane[x][1] = (sign * (end->x - begin->x));
+					plane[x][2] = (sign * (((end->y - begin->y) * begin->x) - ((end->x - begin->x) * begin->y)));
+					z[x] = vertex[x]->z;
+				}
+
+				inverse = (1.f / area);
+
+				for(x = 0; x < 3; ++x) {
+					sample[x] = (((plane[0][x] * z[0]) + (plane[1][x] * z[1]) + (plane[2][x] * z[2])) * inverse);
+				}
+
+				for(y = minimum_y; y <= maximum_y; ++y) {
+					float center_y = (y + 0.5f);
+
+					row = (y * OCCLUSION_WIDTH);
+#if defined(__SSE4_1__)
+					__m128 edge_row[3], depth_row = _mm_set1_ps((sample[1] * center_y) + sample[2]);
+
+					for(x = 0; x < 3; ++x) {
+						edge_row[x] = _mm_set1_ps((plane[x][1] * center_y) + plane[x][2]);
+					}
+
+					for(x = (minimum_x & ~(OCCLUSION_LANE - 1)); x <= maximum_x; x += OCCLUSION_LANE) {
+						__m128 center_x = _mm_add_ps(_mm_set1_ps((float) x), _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f)),
+							current = _mm_loadu_ps(&m_depth[row + x]), mask;
+
+						mask = _mm_and_ps(_mm_and_ps(
+							_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[0][0]), center_x), edge_row[0]),
+								_mm_setzero_ps()),
+							_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[1][0]), center_x), edge_row[1]),
+								_mm_setzero_ps())),
+							_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[2][0]), center_x), edge_row[2]),
+								_mm_setzero_ps()));
+
+						_mm_storeu_ps(&m_depth[row + x], _mm_blendv_ps(current, _mm_min_ps(current,
+							_mm_add_ps(_mm_mul_ps(_mm_set1_ps(sample[0]), center_x), depth_row)), mask));
+					}
+#else
+					for(x = minimum_x; x <= maximum_x; ++x) {
+						float center_x = (x + 0.5f);
+
+						if((((plane[0][0] * center_x) + (plane[0][1] * center_y) + plane[0][2]) >= 0.f)
+								&& (((plane[1][0] * center_x) + (plane[1][1] * center_y) + plane[1][2]) >= 0.f)
+								&& (((plane[2][0] * center_x) + (plane[2][1] * center_y) + plane[2][2]) >= 0.f)) {
+							m_depth[row + x] = std::min(m_depth[row + x],
+								(sample[0] * center_x) + (sample[1] * center_y) + sample[2]);
+						}
+					}
+#endif // __SSE4_1__
+				}
+			}
+
+			bool 
+			_base::visible(
+				__in const glm::mat4 &transform,
+				__in const gaea::engine::occlusion::box_t &box
+				)
+			{
+				int x, y;
+				bool result = false;
+				glm::vec3 corner[OCCLUSION_BOX_VERTEX];
+				float maximum_x, maximum_y, minimum_x, minimum_y, nearest;
+				int column_begin, column_end, row, row_begin, row_end;
+				uint32_t iter;
+
+				if(!project(transform, box, corner)) {
+					return true;
+				}
+
+				minimum_x = maximum_x = corner[0].x;
+				minimum_y = maximum_y = corner[0].y;
+				nearest = corner[0].z;
+
+				for(iter = 1; iter < OCCLUSION_BOX_VERTEX; ++iter) {
+					minimum_x = std::min(minimum_x, corner[iter].x);
+					maximum_x = std::max(maximum_x, corner[iter].x);
+					minimum_y = std::min(minimum_y, corner[iter].y);
+					maximum_y = std::max(maximum_y, corner[iter].y);
+					nearest = std::min(nearest, corner[iter].z);
+				}
+
+				if((nearest > OCCLUSION_DEPTH_CLEAR) || (maximum_x < 0.f) || (minimum_x >= OCCLUSION_WIDTH)
+						|| (maximum_y < 0.f) || (minimum_y >= OCCLUSION_HEIGHT)) {
+					return false;
+				}
+
+				column_begin = std::max(0, (int) std::floor(minimum_x));
+				column_end = std::min(OCCLUSION_WIDTH - 1, (int) std::floor(maximum_x));
+				row_begin = std::max(0, (int) std::floor(minimum_y));
+				row_end = std::min(OCCLUSION_HEIGHT - 1, (int) std::floor(maximum_y));
+
+				for(y = row_begin; !result && (y <= row_end); ++y) {
+					row = (y * OCCLUSION_WIDTH);
+					x = column_begin;
+#if defined(__SSE4_1__)
+					__m128 depth = _mm_set1_ps(nearest);
+
+					for(; (x + OCCLUSION_LANE - 1) <= column_end; x += OCCLUSION_LANE) {
+
+						if(_mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(&m_depth[row + x]), depth))) {
+							result = true;
+							break;
+						}
+					}
+#endif // __SSE4_1__
+
+					for(; !result && (x <= column_end); ++x) {
+
+						if(m_depth[row + x] >= nearest) {
+							result = true;
+						}
+					}
+				}
+
+				return result;
+			}
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_culled(0),
+				m_initialized(false),
+				m_pending(false),
+				m_ready(false),
+				m_tested(0)
+			{
+				std::atexit(gaea::engine::occlusion::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				uninitialize();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::occlusion::manager::m_instance) {
+					delete gaea::engine::occlusion::manager::m_instance;
+					gaea::engine::occlusion::manager::m_instance = nullptr;
+				}
+			}
+
+			void 
+			_manager::_thread(void)
+			{
+
+				if(gaea::engine::occlusion::manager::is_allocated()) {
+
+					gaea::engine::occlusion::manager &instance = gaea::engine::occlusion::manager::acquire();
+					for(;;) {
+
+						std::unique_lock<std::mutex> lock(instance.m_lock);
+						instance.m_condition.wait(lock, [&instance] {
+								return (!instance.m_initialized || instance.m_pending);
+							});
+
+						if(!instance.m_initialized) {
+							break;
+						}
+
+						lock.unlock();
+						instance.m_buffer.clear();
+						instance.m_buffer.rasterize(instance.m_transform, instance.m_occluder);
+
+						lock.lock();
+						instance.m_pending = false;
+						instance.m_ready = true;
+						instance.m_condition.notify_all();
+					}
+				}
+			}
+
+			_manager & 
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::occlusion::manager::m_instance) {
+
+					gaea::engine::occlusion::manager::m_instance = new gaea::engine::occlusion::manager;
+					if(!gaea::engine::occlusion::manager::m_instance) {
+						THROW_GAEA_OCCLUSION_EXCEPTION(GAEA_OCCLUSION_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::occlusion::manager::m_instance;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+				m_buffer.clear();
+				m_culled = 0;
+				m_occluder.clear();
+				m_pending = false;
+				m_ready = false;
+				m_tested = 0;
+			}
+
+			size_t 
+			_manager::culled(void)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_OCCLUSION_EXCEPTION(GAEA_OCCLUSION_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				return m_culled;
+			}
+
+			void 
+			_manager::initialize(void)
+			{
+
+				if(m_initialized) {
+					THROW_GAEA_OCCLUSION_EXCEPTION(GAEA_OCCLUSION_EXCEPTION_INITIALIZED);
+				}
+
+				m_initialized = true;
+				m_worker = std::thread(gaea::engine::occlusion::manager::_thread);
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::occlusion::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_initialized(void)
+			{
+				return m_initialized;
+			}
+
+			void 
+			_manager::rasterize(
+				__in const glm::mat4 &transform,
+				__in const gaea::engine::arena::vector<gaea::engine::occlusion::box_t> &occluder
+				)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_OCCLUSION_EXCEPTION(GAEA_OCCLUSION_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::unique_lock<std::mutex> lock(m_lock);
+				m_condition.wait(lock, [this] {
+						return !m_pending;
+					});
+
+				m_culled = 0;
+				m_occluder.assign(occluder.begin(), occluder.end());
+				m_pending = true;
+				m_tested = 0;
+				m_transform = transform;
+				m_condition.notify_all();
+			}
+
+			size_t 
+			_manager::tested(void)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_OCCLUSION_EXCEPTION(GAEA_OCCLUSION_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				return m_tested;
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << GAEA_OCCLUSION_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
+
+				if(m_initialized) {
+					std::lock_guard<std::mutex> lock(m_lock);
+
+					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+						<< ", " << (m_pending ? "PENDING" : (m_ready ? "READY" : "IDLE"));
+
+					if(!m_pending) {
+						result << ", " << m_buffer.to_string(verbose);
+					}
+
+					result << ", TESTED=" << m_tested
+						<< ", CULLED=" << m_culled;
+				}
+
+				return result.str();
+			}
+
+			void 
+			_manager::uninitialize(void)
+			{
+
+				if(m_initialized) {
+
+					m_lock.lock();
+					m_initialized = false;
+					m_condition.notify_all();
+					m_lock.unlock();
+
+					if(m_worker.joinable()) {
+						m_worker.join();
+					}
+
+					clear();
+				}
+			}
+
+			bool 
+			_manager::visible(
+				__in const gaea::engine::occlusion::box_t &box
+				)
+			{
+				bool result = true;
+
+				if(!m_initialized) {
+					THROW_GAEA_OCCLUSION_EXCEPTION(GAEA_OCCLUSION_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::unique_lock<std::mutex> lock(m_lock);
+				m_condition.wait(lock, [this] {
+						return !m_pending;
+					});
+
+				if(m_ready) {
+					++m_tested;
+
+					result = m_buffer.visible(m_transform, box);
+					if(!result) {
+						++m_culled;
+					}
+				}
+
+				return result;
+			}
+		}
+	}
+}
@@ -0,0 +1,412 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "../../include/gaea.h"
+#include "gaea_pool_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace pool {
+
+			#define POOL_CLASS(_LENGTH_) \
+				(((_LENGTH_) ? ((_LENGTH_) - 1) : 0) / POOL_BLOCK_ALIGNMENT)
+			#define POOL_CLASS_LENGTH(_INDEX_) \
+				(((_INDEX_) + 1) * POOL_BLOCK_ALIGNMENT)
+
+			// plain values, so the cache stays usable while threads and the process exit
+			static thread_local size_t cache_count[POOL_CLASS_COUNT];
+			static thread_local bool cache_exited = false;
+			static thread_local uint64_t cache_generation = 0;
+			static thread_local void *cache_head[POOL_CLASS_COUNT];
+
+			// returns the thread's cached blocks to the shared lists as the thread exits
+			typedef class _cache_owner {
+
+				public:
+
+					~_cache_owner(void)
+					{
+
+						if(gaea::engine::pool::manager::is_allocated()) {
+							gaea::engine::pool::manager::acquire().flush();
+						}
+
+						cache_exited = true;
+					}
+
+			} cache_owner;
+
+			static thread_local cache_owner cache_holder;
+
+			// bumped whenever chunks are freed, invalidating every thread's cache
+			static std::atomic<uint64_t> pool_generation(1);
+
+			static void 
+			cache_validate(void)
+			{
+				uint64_t generation = pool_generation;
+
+				if(cache_generation != generation) {
+					std::memset(cache_count, 0, sizeof(cache_count));
+					std::memset(cache_head, 0, sizeof(cache_head));
+					cache_generation = generation;
+				}
+			}
+
+			static bool 
+			cache_attach(void)
+			{
+
+				if(cache_exited) {
+					return false;
+				}
+
+				// first use registers the holder, so this thread flushes on exit
+				(void) &cache_holder;
+				cache_validate();
+
+				return true;
+			}
+
+			void *
+			allocate(
+				__in size_t length
+				)
+			{
+				return gaea::engine::pool::manager::acquire().allocate(length);
+			}
+
+			void 
+			deallocate(
+				__in void *data,
+				__in size_t length
+				)
+			{
+				gaea::engine::pool::manager::acquire().deallocate(data, length);
+			}
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_cached(POOL_CACHE_INIT),
+				m_class(POOL_CLASS_COUNT, class_t())
+			{
+				std::atexit(gaea::engine::pool::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				clear();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::pool::manager::m_instance) {
+					delete gaea::engine::pool::manager::m_instance;
+					gaea::engine::pool::manager::m_instance = nullptr;
+				}
+			}
+
+			_manager & 
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::pool::manager::m_instance) {
+
+					gaea::engine::pool::manager::m_instance = new gaea::engine::pool::manager;
+					if(!gaea::engine::pool::manager::m_instance) {
+						THROW_GAEA_POOL_EXCEPTION(GAEA_POOL_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::pool::manager::m_instance;
+			}
+
+			void *
+			_manager::allocate(
+				__in size_t length
+				)
+			{
+				size_t index;
+				void *result = nullptr;
+
+				if(length > POOL_BLOCK_MAX) {
+
+					result = std::malloc(length);
+					if(!result) {
+						THROW_GAEA_POOL_EXCEPTION_FORMAT(GAEA_POOL_EXCEPTION_ALLOCATED, "Length=%u", (uint32_t) length);
+					}
+
+					return result;
+				}
+
+				index = POOL_CLASS(length);
+
+				if(m_cached && cache_attach()) {
+
+					if(!cache_head[index]) {
+						refill(index, cache_head[index], cache_count[index]);
+					}
+
+					result = cache_head[index];
+					cache_head[index] = *((void **) result);
+					--cache_count[index];
+				} else {
+					size_t count = 0;
+
+					refill(index, result, count);
+				}
+
+				return result;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+				std::vector<class_t>::iterator iter;
+				std::vector<void *>::iterator chunk_iter;
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				++pool_generation;
+
+				for(iter = m_class.begin(); iter != m_class.end(); ++iter) {
+
+					for(chunk_iter = iter->chunk.begin(); chunk_iter != iter->chunk.end(); ++chunk_iter) {
+						std::free(*chunk_iter);
+					}
+
+					iter->chunk.clear();
+					iter->head = nullptr;
+					iter->high_water = 0;
+					iter->used = 0;
+				}
+			}
+
+			void 
+			_manager::deallocate(
+				__in void *data,
+				__in size_t length
+				)
+			{
+				size_t count = 1, index;
+
+				if(!data) {
+					return;
+				}
+
+				if(length > POOL_BLOCK_MAX) {
+					std::free(data);
+					return;
+				}
+
+				index = POOL_CLASS(length);
+
+				if(m_cached && cache_attach()) {
+					*((void **) data) = cache_head[index];
+					cache_head[index] = data;
+
+					if(++cache_count[index] > (2 * POOL_CACHE_BATCH)) {
+						release(index, cache_head[index], cache_count[index]);
+					}
+				} else {
+					*((void **) data) = nullptr;
+					release(index, data, count);
+				}
+			}
+
+			void 
+			_manager::flush(void)
+			{
+				size_t index = 0;
+
+				if(cache_exited) {
+					return;
+				}
+
+				cache_validate();
+
+				for(; index < POOL_CLASS_COUNT; ++index) {
+
+					while(cache_head[index]) {
+						release(index, cache_head[index], cache_count[index]);
+					}
+				}
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::pool::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_cached(void)
+			{
+				return m_cached;
+			}
+
+			void 
+			_manager::refill(
+				__in size_t index,
+				__inout void *&head,
+				__inout size_t &count
+				)
+			{
+				void *block;
+				uint8_t *chunk;
+				size_t iter = 0, length = POOL_CLASS_LENGTH(index);
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				class_t &entry = m_class.at(index);
+
+				for(; iter < (m_cached ? POOL_CACHE_BATCH : 1); ++iter) {
+
+					if(!entry.head) {
+
+						chunk = (uint8_t *) std::malloc(POOL_CHUNK_LENGTH);
+						if(!chunk) {
+							THROW_GAEA_POOL_EXCEPTION_FORMAT(GAEA_POOL_EXCEPTION_ALLOCATED, "Length=%u",
+								POOL_CHUNK_LENGTH);
+						}
+
+						entry.chunk.push_back(chunk);
+
+						for(size_t offset = ((POOL_CHUNK_LENGTH / length) * length); offset; offset -= length) {
+							*((void **) (chunk + offset - length)) = entry.head;
+							entry.head = (chunk + offset - length);
+						}
+					}
+
+					block = entry.head;
+					entry.head = *((void **) block);
+					*((void **) block) = head;
+					head = block;
+					++count;
+					++entry.used;
+				}
+
+				entry.high_water = std::max(entry.high_water, entry.used);
+			}
+
+			void 
+			_manager::release(
+				__in size_t index,
+				__inout void *&head,
+				__inout size_t &count
+				)
+			{
+				void *block;
+				size_t iter = 0;
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				class_t &entry = m_class.at(index);
+
+				for(; head && (iter < (m_cached ? POOL_CACHE_BATCH : count)); ++iter) {
+					block = head;
+					head = *((void **) block);
+					*((void **) block) = entry.head;
+					entry.head = block;
+					--count;
+					--entry.used;
+				}
+			}
+
+			void 
+			_manager::set_cached(
+				__in bool value
+				)
+			{
+				m_cached = value;
+			}
+
+			gaea::engine::pool::statistic_t 
+			_manager::statistic(
+				__in_opt size_t length
+				)
+			{
+				size_t index = 0;
+				gaea::engine::pool::statistic_t result;
+
+				if(length > POOL_BLOCK_MAX) {
+					THROW_GAEA_POOL_EXCEPTION_FORMAT(GAEA_POOL_EXCEPTION_INVALID, "Length=%u", (uint32_t) length);
+				}
+
+				std::memset(&result, 0, sizeof(result));
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				for(; index < m_class.size(); ++index) {
+
+					if(length && (index != POOL_CLASS(length))) {
+						continue;
+					}
+
+					class_t &entry = m_class.at(index);
+					result.allocated += (entry.chunk.size() * POOL_CHUNK_LENGTH);
+					result.chunk += entry.chunk.size();
+					result.high_water += (entry.high_water * POOL_CLASS_LENGTH(index));
+					result.used += (entry.used * POOL_CLASS_LENGTH(index));
+				}
+
+				return result;
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				size_t index = 0;
+				std::stringstream result;
+				gaea::engine::pool::statistic_t total = statistic();
+
+				result << GAEA_POOL_HEADER << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+					<< ", " << (m_cached ? "CACHED" : "SHARED")
+					<< ", CHUNKS=" << total.chunk
+					<< ", MEM=" << (total.allocated / BYTES_PER_KBYTE) << " KB"
+					<< ", USED=" << (total.used / BYTES_PER_KBYTE) << " KB"
+					<< ", HIGH=" << (total.high_water / BYTES_PER_KBYTE) << " KB";
+
+				if(verbose) {
+					std::lock_guard<std::mutex> lock(m_lock);
+
+					for(; index < m_class.size(); ++index) {
+
+						if(!m_class.at(index).chunk.empty()) {
+							result << ", [" << POOL_CLASS_LENGTH(index) << "]={" << m_class.at(index).used
+								<< "/" << ((m_class.at(index).chunk.size() * POOL_CHUNK_LENGTH)
+									/ POOL_CLASS_LENGTH(index)) << "}";
+						}
+					}
+				}
+
+				return result.str();
+			}
+		}
+	}
+}
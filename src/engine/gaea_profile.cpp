@@ -0,0 +1,475 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include "../../include/gaea.h"
+#include "gaea_profile_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace profile {
+
+			#define PROFILE_NS_PER_US 1000.0
+			#define PROFILE_PERCENTILE 99
+			#define PROFILE_PERCENTILE_MAX 100
+			#define PROFILE_PROCESS 1
+			#define PROFILE_THREAD_GPU 0
+
+			static std::string 
+			escape(
+				__in const std::string &input
+				)
+			{
+				std::string result;
+
+				for(std::string::const_iterator iter = input.begin(); iter != input.end(); ++iter) {
+
+					switch(*iter) {
+						case '"':
+						case '\\':
+							result += '\\';
+							result += *iter;
+							break;
+						default:
+
+							if((unsigned char) *iter >= ' ') {
+								result += *iter;
+							}
+							break;
+					}
+				}
+
+				return result;
+			}
+
+			uint64_t 
+			now(void)
+			{
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now().time_since_epoch()).count();
+			}
+
+			_scope::_scope(
+				__in const std::string &name
+				) :
+					m_begin(gaea::engine::profile::now()),
+					m_name(name)
+			{
+				return;
+			}
+
+			_scope::~_scope(void)
+			{
+
+				if(gaea::engine::profile::manager::is_allocated()) {
+
+					gaea::engine::profile::manager &instance = gaea::engine::profile::manager::acquire();
+					if(instance.is_initialized()) {
+						instance.record(m_name, m_begin, gaea::engine::profile::now());
+					}
+				}
+			}
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_history(PROFILE_HISTORY_INIT),
+				m_initialized(false),
+				m_trace(PROFILE_TRACE_INIT)
+			{
+				std::atexit(gaea::engine::profile::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				uninitialize();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::profile::manager::m_instance) {
+					delete gaea::engine::profile::manager::m_instance;
+					gaea::engine::profile::manager::m_instance = nullptr;
+				}
+			}
+
+			_manager & 
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::profile::manager::m_instance) {
+
+					gaea::engine::profile::manager::m_instance = new gaea::engine::profile::manager;
+					if(!gaea::engine::profile::manager::m_instance) {
+						THROW_GAEA_PROFILE_EXCEPTION(GAEA_PROFILE_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::profile::manager::m_instance;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+				m_event.clear();
+				m_phase.clear();
+				m_thread.clear();
+				m_timer.clear();
+			}
+
+			void 
+			_manager::dump(
+				__in_opt const std::string &path
+				)
+			{
+				uint64_t epoch = 0;
+				std::ofstream file;
+				std::deque<event_t>::iterator iter;
+				std::map<std::thread::id, uint32_t>::iterator iter_thread;
+
+				if(!m_initialized) {
+					THROW_GAEA_PROFILE_EXCEPTION(GAEA_PROFILE_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				file.open(path.c_str(), std::ios::out | std::ios::trunc);
+				if(!file) {
+					THROW_GAEA_PROFILE_EXCEPTION_FORMAT(GAEA_PROFILE_EXCEPTION_EXTERNAL, "%s", STRING_CHECK(path));
+				}
+
+				if(!m_event.empty()) {
+					epoch = m_event.front().begin;
+
+					for(iter = m_event.begin(); iter != m_event.end(); ++iter) {
+						epoch = std::min(epoch, iter->begin);
+					}
+				}
+
+				file << std::fixed << std::setprecision(3)
+					<< "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" << std::endl
+					<< "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << PROFILE_PROCESS
+						<< ",\"tid\":" << PROFILE_THREAD_GPU << ",\"args\":{\"name\":\"GPU\"}}";
+
+				for(iter_thread = m_thread.begin(); iter_thread != m_thread.end(); ++iter_thread) {
+					file << "," << std::endl << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << PROFILE_PROCESS
+						<< ",\"tid\":" << iter_thread->second << ",\"args\":{\"name\":\"CPU " << iter_thread->second
+						<< "\"}}";
+				}
+
+				for(iter = m_event.begin(); iter != m_event.end(); ++iter) {
+					file << "," << std::endl << "{\"name\":\"" << escape(iter->name) << "\",\"cat\":\""
+						<< (iter->gpu ? "gpu" : "cpu") << "\",\"ph\":\"X\",\"pid\":" << PROFILE_PROCESS
+						<< ",\"tid\":" << iter->thread
+						<< ",\"ts\":" << ((iter->begin - epoch) / PROFILE_NS_PER_US)
+						<< ",\"dur\":" << (iter->duration / PROFILE_NS_PER_US) << "}";
+				}
+
+				file << std::endl << "]}" << std::endl;
+				if(!file) {
+					THROW_GAEA_PROFILE_EXCEPTION_FORMAT(GAEA_PROFILE_EXCEPTION_EXTERNAL, "%s", STRING_CHECK(path));
+				}
+			}
+
+			void 
+			_manager::initialize(
+				__in_opt size_t history,
+				__in_opt bool trace
+				)
+			{
+
+				if(m_initialized) {
+					THROW_GAEA_PROFILE_EXCEPTION(GAEA_PROFILE_EXCEPTION_INITIALIZED);
+				}
+
+				if(!history) {
+					THROW_GAEA_PROFILE_EXCEPTION_FORMAT(GAEA_PROFILE_EXCEPTION_INVALID, "History=%u", (uint32_t) history);
+				}
+
+				m_history = history;
+				m_trace = trace;
+				m_initialized = true;
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::profile::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_initialized(void)
+			{
+				return m_initialized;
+			}
+
+			std::vector<std::string> 
+			_manager::phases(void)
+			{
+				std::vector<std::string> result;
+				std::map<std::string, phase_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_PROFILE_EXCEPTION(GAEA_PROFILE_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				for(iter = m_phase.begin(); iter != m_phase.end(); ++iter) {
+					result.push_back(iter->first);
+				}
+
+				return result;
+			}
+
+			void 
+			_manager::record(
+				__in const std::string &name,
+				__in uint64_t begin,
+				__in uint64_t end
+				)
+			{
+
+				if(!m_initialized) {
+					THROW_GAEA_PROFILE_EXCEPTION(GAEA_PROFILE_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+				sample(name, begin, (end > begin) ? (end - begin) : 0, false);
+			}
+
+			void 
+			_manager::sample(
+				__in const std::string &name,
+				__in uint64_t begin,
+				__in uint64_t duration,
+				__in bool gpu
+				)
+			{
+				event_t event;
+				uint32_t thread = PROFILE_THREAD_GPU;
+				std::map<std::thread::id, uint32_t>::iterator iter;
+
+				phase_t &phase = m_phase[name];
+				if(phase.sample.size() < m_history) {
+					phase.sample.push_back(duration);
+				} else {
+					phase.sample.at(phase.next) = duration;
+				}
+
+				phase.next = ((phase.next + 1) % m_history);
+				++phase.count;
+
+				if(m_trace) {
+
+					if(!gpu) {
+
+						iter = m_thread.find(std::this_thread::get_id());
+						if(iter == m_thread.end()) {
+							iter = m_thread.insert(std::make_pair(std::this_thread::get_id(), m_thread.size() + 1)).first;
+						}
+
+						thread = iter->second;
+					}
+
+					event.begin = begin;
+					event.duration = duration;
+					event.gpu = gpu;
+					event.name = name;
+					event.thread = thread;
+
+					if(m_event.size() >= PROFILE_TRACE_MAX) {
+						m_event.pop_front();
+					}
+
+					m_event.push_back(event);
+				}
+			}
+
+			void 
+			_manager::start(
+				__in const std::string &name
+				)
+			{
+				size_t index;
+
+				if(!m_initialized) {
+					THROW_GAEA_PROFILE_EXCEPTION(GAEA_PROFILE_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				gpu_t &timer = m_timer[name];
+				if(timer.active) {
+					THROW_GAEA_PROFILE_EXCEPTION_FORMAT(GAEA_PROFILE_EXCEPTION_INVALID, "%s", STRING_CHECK(name));
+				}
+
+				if(timer.query.empty()) {
+					timer.begin.resize(PROFILE_GPU_LATENCY, 0);
+
+					// copies share a handle, so each slot has to generate its own query
+					for(index = 0; index < PROFILE_GPU_LATENCY; ++index) {
+						timer.query.push_back(gaea::graphics::query::base(GL_TIME_ELAPSED));
+					}
+				}
+
+				index = (timer.next % timer.query.size());
+
+				gaea::graphics::query::base &query = timer.query.at(index);
+				if(query.is_issued()) {
+
+					if(!query.is_available()) {
+						return;
+					}
+
+					sample(PROFILE_GPU_PREFIX + name, timer.begin.at(index), query.result(), true);
+				}
+
+				timer.begin.at(index) = gaea::engine::profile::now();
+				query.start();
+				timer.active = true;
+			}
+
+			gaea::engine::profile::statistic_t 
+			_manager::statistic(
+				__in const std::string &name
+				)
+			{
+				size_t index;
+				std::vector<uint64_t> sample;
+				std::vector<uint64_t>::iterator iter;
+				std::map<std::string, phase_t>::iterator iter_phase;
+				gaea::engine::profile::statistic_t result = {};
+
+				if(!m_initialized) {
+					THROW_GAEA_PROFILE_EXCEPTION(GAEA_PROFILE_EXCEPTION_UNINITIALIZED);
+				}
+
+				m_lock.lock();
+
+				iter_phase = m_phase.find(name);
+				if(iter_phase == m_phase.end()) {
+					m_lock.unlock();
+					THROW_GAEA_PROFILE_EXCEPTION_FORMAT(GAEA_PROFILE_EXCEPTION_NOT_FOUND, "%s", STRING_CHECK(name));
+				}
+
+				sample = iter_phase->second.sample;
+				result.count = iter_phase->second.count;
+				m_lock.unlock();
+
+				if(!sample.empty()) {
+					result.minimum = sample.front();
+
+					for(iter = sample.begin(); iter != sample.end(); ++iter) {
+						result.average += *iter;
+						result.maximum = std::max(result.maximum, *iter);
+						result.minimum = std::min(result.minimum, *iter);
+					}
+
+					result.average /= sample.size();
+					index = (((sample.size() * PROFILE_PERCENTILE) + (PROFILE_PERCENTILE_MAX - 1)) 
+						/ PROFILE_PERCENTILE_MAX) - 1;
+					std::nth_element(sample.begin(), sample.begin() + index, sample.end());
+					result.p99 = sample.at(index);
+				}
+
+				return result;
+			}
+
+			void 
+			_manager::stop(
+				__in const std::string &name
+				)
+			{
+				std::map<std::string, gpu_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_PROFILE_EXCEPTION(GAEA_PROFILE_EXCEPTION_UNINITIALIZED);
+				}
+
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				iter = m_timer.find(name);
+				if((iter != m_timer.end()) && iter->second.active) {
+					iter->second.query.at(iter->second.next % iter->second.query.size()).stop();
+					iter->second.active = false;
+					++iter->second.next;
+				}
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+				std::vector<std::string> name;
+				gaea::engine::profile::statistic_t statistic;
+				std::vector<std::string>::iterator iter;
+
+				result << GAEA_PROFILE_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
+
+				if(m_initialized) {
+					name = phases();
+
+					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+						<< ", HIST=" << m_history
+						<< ", PHASE[" << name.size() << "]";
+
+					if(m_trace) {
+						std::lock_guard<std::mutex> lock(m_lock);
+						result << ", TRACE[" << m_event.size() << "]";
+					}
+
+					if(verbose) {
+
+						result << std::fixed << std::setprecision(3);
+
+						for(iter = name.begin(); iter != name.end(); ++iter) {
+							statistic = this->statistic(*iter);
+							result << std::endl << "--- " << *iter << " (" << statistic.count << ")"
+								<< " MIN=" << (statistic.minimum / PROFILE_NS_PER_US) << " us"
+								<< ", AVG=" << (statistic.average / PROFILE_NS_PER_US) << " us"
+								<< ", P99=" << (statistic.p99 / PROFILE_NS_PER_US) << " us"
+								<< ", MAX=" << (statistic.maximum / PROFILE_NS_PER_US) << " us";
+						}
+					}
+				}
+
+				return result.str();
+			}
+
+			void 
+			_manager::uninitialize(void)
+			{
+
+				if(m_initialized) {
+					m_initialized = false;
+					clear();
+				}
+			}
+		}
+	}
+}
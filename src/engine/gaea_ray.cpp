@@ -0,0 +1,261 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include "../../include/gaea.h"
+#include "gaea_ray_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace ray {
+
+			static inline bool 
+			empty(
+				__in const gaea::engine::chunk::base *chunk
+				)
+			{
+				return (!chunk || chunk->is_empty());
+			}
+
+			static bool 
+			trace(
+				__in gaea::engine::world::manager &world,
+				__in const glm::vec3 &origin,
+				__in const glm::vec3 &direction,
+				__in GLfloat distance,
+				__out gaea::engine::ray::hit_t &hit
+				)
+			{
+				int axis = 0;
+				bool result = false;
+				gaea::block_t block;
+				glm::vec3 delta, boundary, unit;
+				gaea::engine::chunk::base *chunk;
+				glm::ivec3 coordinate, current, normal(0), step, voxel;
+				GLfloat length = glm::length(direction), time = 0.f;
+
+				hit.block = BLOCK_AIR;
+				hit.distance = distance;
+				hit.normal = glm::ivec3(0);
+				hit.position = glm::ivec3(0);
+
+				if(!(length > 0.f) || !std::isfinite(length)) {
+					THROW_GAEA_RAY_EXCEPTION_FORMAT(GAEA_RAY_EXCEPTION_INVALID,
+						"Direction={%f, %f, %f}", direction.x, direction.y, direction.z);
+				}
+
+				// a nan boundary never exceeds the distance, so the walk below would not end
+				if(!std::isfinite(origin.x) || !std::isfinite(origin.y) || !std::isfinite(origin.z)) {
+					THROW_GAEA_RAY_EXCEPTION_FORMAT(GAEA_RAY_EXCEPTION_INVALID,
+						"Origin={%f, %f, %f}", origin.x, origin.y, origin.z);
+				}
+
+				if(!std::isfinite(distance) || (distance < 0.f)) {
+					THROW_GAEA_RAY_EXCEPTION_FORMAT(GAEA_RAY_EXCEPTION_INVALID,
+						"Distance=%f", distance);
+				}
+
+				unit = (direction / length);
+				voxel = glm::ivec3(glm::floor(origin));
+
+				for(; axis < 3; ++axis) {
+
+					if(unit[axis] > 0.f) {
+						step[axis] = 1;
+						delta[axis] = (1.f / unit[axis]);
+						boundary[axis] = ((voxel[axis] + 1 - origin[axis]) / unit[axis]);
+					} else if(unit[axis] < 0.f) {
+						step[axis] = -1;
+						delta[axis] = (-1.f / unit[axis]);
+						boundary[axis] = ((voxel[axis] - origin[axis]) / unit[axis]);
+					} else {
+						step[axis] = 0;
+						delta[axis] = INFINITY;
+						boundary[axis] = INFINITY;
+					}
+				}
+
+				current = gaea::engine::chunk::coordinate(voxel);
+				chunk = world.find(current);
+
+				for(;;) {
+
+					if(!empty(chunk)) {
+
+						block = chunk->get(gaea::engine::chunk::local(voxel));
+						if(block != BLOCK_AIR) {
+							hit.block = block;
+							hit.distance = time;
+							hit.normal = normal;
+							hit.position = voxel;
+							result = true;
+							break;
+						}
+					}
+
+					axis = ((boundary.x < boundary.y) ? ((boundary.x < boundary.z) ? 0 : 2)
+						: ((boundary.y < boundary.z) ? 1 : 2));
+
+					time = boundary[axis];
+					if(time > distance) {
+						break;
+					}
+
+					voxel[axis] += step[axis];
+					boundary[axis] += delta[axis];
+					normal = glm::ivec3(0);
+					normal[axis] = -step[axis];
+
+					coordinate = gaea::engine::chunk::coordinate(voxel);
+					if(coordinate != current) {
+						current = coordinate;
+						chunk = world.find(current);
+					}
+				}
+
+				return result;
+			}
+
+			bool 
+			cast(
+				__in const glm::vec3 &origin,
+				__in const glm::vec3 &direction,
+				__out gaea::engine::ray::hit_t &hit,
+				__in_opt GLfloat distance
+				)
+			{
+				gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+				std::lock_guard<std::recursive_mutex> lock(world.lock());
+
+				return trace(world, origin, direction, distance, hit);
+			}
+
+			size_t 
+			cast(
+				__in const std::vector<gaea::engine::ray::ray_t> &ray,
+				__out std::vector<gaea::engine::ray::hit_t> &hit
+				)
+			{
+				size_t iter = 0, result = 0;
+				gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+				std::lock_guard<std::recursive_mutex> lock(world.lock());
+
+				hit.resize(ray.size());
+
+				for(; iter < ray.size(); ++iter) {
+
+					if(trace(world, ray[iter].origin, ray[iter].direction, ray[iter].distance, hit[iter])) {
+						++result;
+					}
+				}
+
+				return result;
+			}
+
+			bool 
+			collide(
+				__in const glm::vec3 &minimum,
+				__in const glm::vec3 &maximum
+				)
+			{
+				bool result = false;
+				gaea::engine::chunk::base *chunk = nullptr;
+				glm::ivec3 begin, coordinate, current, end, voxel;
+				gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+				std::lock_guard<std::recursive_mutex> lock(world.lock());
+
+				begin = glm::ivec3(glm::floor(glm::min(minimum, maximum)));
+				end = glm::ivec3(std::ceil(std::max(minimum.x, maximum.x)), std::ceil(std::max(minimum.y, maximum.y)),
+					std::ceil(std::max(minimum.z, maximum.z)));
+				current = (gaea::engine::chunk::coordinate(begin) - glm::ivec3(1));
+
+				for(voxel.y = begin.y; !result && (voxel.y < end.y); ++voxel.y) {
+
+					for(voxel.z = begin.z; !result && (voxel.z < end.z); ++voxel.z) {
+
+						for(voxel.x = begin.x; voxel.x < end.x; ++voxel.x) {
+
+							coordinate = gaea::engine::chunk::coordinate(voxel);
+							if(coordinate != current) {
+								current = coordinate;
+								chunk = world.find(current);
+							}
+
+							if(!empty(chunk) && (chunk->get(gaea::engine::chunk::local(voxel)) != BLOCK_AIR)) {
+								result = true;
+								break;
+							}
+						}
+					}
+				}
+
+				return result;
+			}
+
+			bool 
+			pick(
+				__in const glm::ivec2 &coordinate,
+				__out gaea::engine::ray::hit_t &hit,
+				__in_opt GLfloat distance
+				)
+			{
+				glm::mat4 inverse;
+				glm::vec4 back, front;
+				gaea::engine::camera::base &camera = gaea::engine::camera::manager::acquire().entry();
+				glm::ivec2 dimensions = camera.dimensions();
+
+				if((dimensions.x <= 0) || (dimensions.y <= 0)) {
+					THROW_GAEA_RAY_EXCEPTION_FORMAT(GAEA_RAY_EXCEPTION_INVALID,
+						"Dimensions={%i, %i}", dimensions.x, dimensions.y);
+				}
+
+				inverse = glm::inverse(camera.projection() * camera.view());
+				front = glm::vec4(((2.f * coordinate.x) / dimensions.x) - 1.f,
+					1.f - ((2.f * coordinate.y) / dimensions.y), -1.f, 1.f);
+				back = glm::vec4(front.x, front.y, 1.f, 1.f);
+				front = (inverse * front);
+				front /= front.w;
+				back = (inverse * back);
+				back /= back.w;
+
+				return cast(glm::vec3(camera.origin()), glm::vec3(back.x - front.x, back.y - front.y,
+					back.z - front.z), hit, distance);
+			}
+
+			bool 
+			visible(
+				__in const glm::vec3 &origin,
+				__in const glm::vec3 &target
+				)
+			{
+				bool result = true;
+				gaea::engine::ray::hit_t hit;
+				GLfloat length = glm::distance(origin, target);
+
+				if(length > 0.f) {
+					result = !cast(origin, target - origin, hit, length);
+				}
+
+				return result;
+			}
+		}
+	}
+}
@@ -0,0 +1,959 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#ifdef GAEA_IO_URING
+#include <liburing.h>
+#endif // GAEA_IO_URING
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../../include/gaea.h"
+#include "gaea_region_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace region {
+
+			#define REGION_COMPRESSION ARCHIVE_COMPRESSION_LZ4
+			#define REGION_COUNT(_ENTRY_) ((_ENTRY_) & UINT8_MAX)
+			#define REGION_COUNT_MAX UINT8_MAX
+			#define REGION_ENTRY(_SECTOR_, _COUNT_) (((_SECTOR_) << 8) | (_COUNT_))
+			#define REGION_EXTENSION ".grg"
+			#define REGION_FILE_INVALID -1
+			#define REGION_MODE 0644
+			#define REGION_MODE_DIRECTORY 0755
+			#define REGION_SECTOR_FIRST 2
+			#define REGION_SECTOR_OF(_ENTRY_) ((_ENTRY_) >> 8)
+			#define REGION_SQE_READ 1
+			#define REGION_SQE_WRITE 2
+			#define REGION_TABLE_OFFSET(_INDEX_) (REGION_SECTOR + ((_INDEX_) * sizeof(uint32_t)))
+
+#ifdef GAEA_IO_URING
+			static struct io_uring REGION_RING;
+
+			static struct io_uring_sqe * 
+			region_sqe(
+				__in unsigned count
+				)
+			{
+
+				// linked entries must go out in one submission, so make room for all of them first
+				if(io_uring_sq_space_left(&REGION_RING) < count) {
+					io_uring_submit(&REGION_RING);
+				}
+
+				return io_uring_get_sqe(&REGION_RING);
+			}
+#endif // GAEA_IO_URING
+
+			glm::ivec3 
+			coordinate(
+				__in const glm::ivec3 &chunk
+				)
+			{
+				return glm::ivec3(chunk.x >> REGION_WIDTH_SHIFT, chunk.y, chunk.z >> REGION_WIDTH_SHIFT);
+			}
+
+			uint32_t 
+			index(
+				__in const glm::ivec3 &chunk
+				)
+			{
+				return (((chunk.z & (REGION_WIDTH - 1)) << REGION_WIDTH_SHIFT) | (chunk.x & (REGION_WIDTH - 1)));
+			}
+
+			_base::_base(
+				__in const std::string &path
+				) :
+					m_file(REGION_FILE_INVALID),
+					m_path(path)
+			{
+				std::memset(m_table, 0, sizeof(m_table));
+				open();
+			}
+
+			_base::~_base(void)
+			{
+				close();
+			}
+
+			off_t 
+			_base::allocate(
+				__in uint32_t index,
+				__in size_t length
+				)
+			{
+				uint32_t count, iter, previous, run = 0, sector;
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				count = ((length + REGION_SECTOR - 1) / REGION_SECTOR);
+				if(!count || (count > REGION_COUNT_MAX) || (index >= REGION_AREA)) {
+					THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_INVALID,
+						"Index=%u, Length=%u", index, (uint32_t) length);
+				}
+
+				previous = REGION_COUNT(m_table[index]);
+				sector = REGION_SECTOR_OF(m_table[index]);
+
+				if(sector && (count <= previous)) {
+
+					for(iter = (sector + count); iter < (sector + previous); ++iter) {
+						m_used[iter] = false;
+					}
+				} else {
+
+					for(iter = sector; iter < (sector + previous); ++iter) {
+						m_used[iter] = false;
+					}
+
+					sector = m_used.size();
+
+					for(iter = REGION_SECTOR_FIRST; iter < m_used.size(); ++iter) {
+						run = (m_used[iter] ? 0 : (run + 1));
+
+						if(run == count) {
+							sector = (iter + 1 - count);
+							break;
+						}
+					}
+
+					if((sector + count) > m_used.size()) {
+						m_used.resize(sector + count, false);
+					}
+
+					for(iter = sector; iter < (sector + count); ++iter) {
+						m_used[iter] = true;
+					}
+				}
+
+				m_table[index] = REGION_ENTRY(sector, count);
+
+				return ((off_t) sector * REGION_SECTOR);
+			}
+
+			std::string 
+			_base::as_string(
+				__in const _base &object,
+				__in_opt bool verbose
+				)
+			{
+				size_t count = 0, iter = 0;
+				std::stringstream result;
+
+				for(; iter < REGION_AREA; ++iter) {
+
+					if(object.m_table[iter]) {
+						++count;
+					}
+				}
+
+				result << STRING_CHECK(object.m_path)
+					<< ", CHUNKS=" << count
+					<< ", SIZE=" << ((object.m_used.size() * REGION_SECTOR) / BYTES_PER_KBYTE) << " KB";
+
+				return result.str();
+			}
+
+			void 
+			_base::close(void)
+			{
+
+				if(m_file != REGION_FILE_INVALID) {
+					::close(m_file);
+					m_file = REGION_FILE_INVALID;
+				}
+
+				std::memset(m_table, 0, sizeof(m_table));
+				m_used.clear();
+			}
+
+			bool 
+			_base::contains(
+				__in uint32_t index
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				return ((index < REGION_AREA) && m_table[index]);
+			}
+
+			void 
+			_base::decode(
+				__in const std::vector<uint8_t> &record,
+				__out gaea::engine::chunk::base &chunk
+				)
+			{
+				std::vector<uint8_t> data;
+				std::vector<gaea::block_t> block;
+				const gaea::engine::region::region_record_t *header =
+					(const gaea::engine::region::region_record_t *) record.data();
+
+				if((record.size() < sizeof(*header)) || (header->length > (record.size() - sizeof(*header)))
+						|| (header->compression > ARCHIVE_COMPRESSION_MAX)) {
+					THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_MALFORMED,
+						"Record length=%u", (uint32_t) record.size());
+				}
+
+				gaea::engine::archive::decompress((gaea::compression_t) header->compression,
+					record.data() + sizeof(*header), header->length, data, CHUNK_VOLUME * sizeof(gaea::block_t));
+				block.resize(CHUNK_VOLUME);
+				std::memcpy(block.data(), data.data(), data.size());
+				chunk.deserialize(block);
+			}
+
+			void 
+			_base::encode(
+				__in const gaea::engine::chunk::base &chunk,
+				__out std::vector<uint8_t> &record
+				)
+			{
+				std::vector<uint8_t> data;
+				std::vector<gaea::block_t> block;
+				gaea::engine::region::region_record_t header = {};
+
+				chunk.serialize(block);
+				gaea::engine::archive::compress(REGION_COMPRESSION, (const uint8_t *) block.data(),
+					block.size() * sizeof(gaea::block_t), data);
+
+				header.compression = REGION_COMPRESSION;
+				header.length = data.size();
+				record.assign((const uint8_t *) &header, (const uint8_t *) &header + sizeof(header));
+				record.insert(record.end(), data.begin(), data.end());
+				record.resize(((record.size() + REGION_SECTOR - 1) / REGION_SECTOR) * REGION_SECTOR, 0);
+			}
+
+			uint32_t 
+			_base::entry(
+				__in uint32_t index
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				return m_table[index];
+			}
+
+			int 
+			_base::file(void)
+			{
+				return m_file;
+			}
+
+			bool 
+			_base::locate(
+				__in uint32_t index,
+				__out off_t &offset,
+				__out size_t &length
+				)
+			{
+				bool result;
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				result = ((index < REGION_AREA) && m_table[index]);
+				if(result) {
+					offset = ((off_t) REGION_SECTOR_OF(m_table[index]) * REGION_SECTOR);
+					length = (REGION_COUNT(m_table[index]) * REGION_SECTOR);
+				}
+
+				return result;
+			}
+
+			void 
+			_base::open(void)
+			{
+				uint32_t count, iter = 0, sector;
+				struct stat status;
+				gaea::engine::region::region_header_t header = {};
+				std::vector<uint8_t> initial(REGION_SECTOR_FIRST * REGION_SECTOR, 0);
+
+				m_file = ::open(m_path.c_str(), O_RDWR | O_CREAT, REGION_MODE);
+				if(m_file == REGION_FILE_INVALID) {
+					THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_EXTERNAL,
+						"open failed: %s (%s)", STRING_CHECK(m_path), strerror(errno));
+				}
+
+				if(fstat(m_file, &status)) {
+					close();
+					THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_EXTERNAL,
+						"fstat failed: %s (%s)", STRING_CHECK(m_path), strerror(errno));
+				}
+
+				if(!status.st_size) {
+					header.magic = REGION_MAGIC;
+					header.version = REGION_VERSION;
+					std::memcpy(initial.data(), &header, sizeof(header));
+
+					if(pwrite(m_file, initial.data(), initial.size(), 0) != (ssize_t) initial.size()) {
+						close();
+						THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_EXTERNAL,
+							"pwrite failed: %s (%s)", STRING_CHECK(m_path), strerror(errno));
+					}
+
+					status.st_size = initial.size();
+				} else if((status.st_size < (off_t) initial.size())
+						|| (pread(m_file, &header, sizeof(header), 0) != (ssize_t) sizeof(header))
+						|| (header.magic != REGION_MAGIC) || (header.version != REGION_VERSION)
+						|| (pread(m_file, m_table, sizeof(m_table), REGION_SECTOR) != (ssize_t) sizeof(m_table))) {
+					close();
+					THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_MALFORMED,
+						"%s", STRING_CHECK(m_path));
+				}
+
+				m_used.assign((status.st_size + REGION_SECTOR - 1) / REGION_SECTOR, false);
+				m_used[0] = true;
+				m_used[1] = true;
+
+				for(; iter < REGION_AREA; ++iter) {
+					count = REGION_COUNT(m_table[iter]);
+					sector = REGION_SECTOR_OF(m_table[iter]);
+
+					if(!m_table[iter]) {
+						continue;
+					}
+
+					if(!count || (sector < REGION_SECTOR_FIRST) || ((sector + count) > m_used.size())) {
+						close();
+						THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_MALFORMED,
+							"%s (Entry[%u]=%x)", STRING_CHECK(m_path), iter, m_table[iter]);
+					}
+
+					for(; count; --count, ++sector) {
+						m_used[sector] = true;
+					}
+				}
+			}
+
+			const std::string & 
+			_base::path(void)
+			{
+				return m_path;
+			}
+
+			bool 
+			_base::read(
+				__in const glm::ivec3 &coordinate,
+				__out gaea::engine::chunk::base &chunk
+				)
+			{
+				bool result;
+				off_t offset;
+				std::vector<uint8_t> record;
+				uint32_t position = gaea::engine::region::index(coordinate);
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				result = m_table[position];
+				if(result) {
+					offset = ((off_t) REGION_SECTOR_OF(m_table[position]) * REGION_SECTOR);
+					record.resize(REGION_COUNT(m_table[position]) * REGION_SECTOR);
+
+					if(pread(m_file, record.data(), record.size(), offset) != (ssize_t) record.size()) {
+						THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_EXTERNAL,
+							"pread failed: %s (%s)", STRING_CHECK(m_path), strerror(errno));
+					}
+
+					decode(record, chunk);
+				}
+
+				return result;
+			}
+
+			size_t 
+			_base::size(void)
+			{
+				size_t iter = 0, result = 0;
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				for(; iter < REGION_AREA; ++iter) {
+
+					if(m_table[iter]) {
+						++result;
+					}
+				}
+
+				return result;
+			}
+
+			std::string 
+			_base::to_string(
+				__in_opt bool verbose
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				return gaea::engine::region::base::as_string(*this, verbose);
+			}
+
+			void 
+			_base::write(
+				__in const glm::ivec3 &coordinate,
+				__in const gaea::engine::chunk::base &chunk
+				)
+			{
+				off_t offset;
+				std::vector<uint8_t> record;
+				uint32_t position = gaea::engine::region::index(coordinate);
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				encode(chunk, record);
+				offset = allocate(position, record.size());
+
+				if((pwrite(m_file, record.data(), record.size(), offset) != (ssize_t) record.size())
+						|| (pwrite(m_file, &m_table[position], sizeof(uint32_t), REGION_TABLE_OFFSET(position))
+						!= (ssize_t) sizeof(uint32_t))) {
+					THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_EXTERNAL,
+						"pwrite failed: %s (%s)", STRING_CHECK(m_path), strerror(errno));
+				}
+			}
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_initialized(false),
+				m_loaded(0),
+				m_saved(0),
+				m_sequence(0),
+				m_uring(false)
+			{
+				std::atexit(gaea::engine::region::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				uninitialize();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::region::manager::m_instance) {
+					delete gaea::engine::region::manager::m_instance;
+					gaea::engine::region::manager::m_instance = nullptr;
+				}
+			}
+
+			void 
+			_manager::_thread(void)
+			{
+
+				if(gaea::engine::region::manager::is_allocated()) {
+
+					gaea::engine::region::manager &instance = gaea::engine::region::manager::acquire();
+					for(;;) {
+						std::vector<job_t> job;
+						std::vector<std::pair<uint64_t, gaea::engine::chunk::base>> chunk;
+
+						std::unique_lock<std::mutex> lock(instance.m_lock);
+						instance.m_condition.wait(lock, [&instance] {
+								return (!instance.m_initialized || !instance.m_job.empty());
+							});
+
+						if(instance.m_job.empty()) {
+							break;
+						}
+
+						instance.take(job, chunk, instance.m_uring ? REGION_BATCH_MAX : 1);
+						lock.unlock();
+						instance.process(job, chunk);
+					}
+				}
+			}
+
+			_manager & 
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::region::manager::m_instance) {
+
+					gaea::engine::region::manager::m_instance = new gaea::engine::region::manager;
+					if(!gaea::engine::region::manager::m_instance) {
+						THROW_GAEA_REGION_EXCEPTION(GAEA_REGION_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::region::manager::m_instance;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+				std::unordered_map<glm::ivec3, gaea::engine::region::base *,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				for(iter = m_region.begin(); iter != m_region.end(); ++iter) {
+					delete iter->second;
+				}
+
+				m_job.clear();
+				m_loaded = 0;
+				m_read.clear();
+				m_region.clear();
+				m_result.clear();
+				m_saved = 0;
+				m_sequence = 0;
+				m_write.clear();
+			}
+
+			void 
+			_manager::collect(
+				__out std::vector<gaea::engine::region::result_t> &result
+				)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				if(!m_initialized) {
+					THROW_GAEA_REGION_EXCEPTION(GAEA_REGION_EXCEPTION_UNINITIALIZED);
+				}
+
+				result.clear();
+				result.swap(m_result);
+			}
+
+			void 
+			_manager::complete(
+				__in const job_t &job,
+				__in bool found,
+				__in const gaea::engine::chunk::base &chunk,
+				__in uint64_t sequence
+				)
+			{
+				gaea::engine::region::result_t result;
+				std::unordered_map<glm::ivec3, std::pair<uint64_t, gaea::engine::chunk::base>,
+					gaea::engine::chunk::hash_t>::iterator iter;
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				if(job.write) {
+
+					iter = m_write.find(job.coordinate);
+					if(iter != m_write.end()) {
+
+						// a save that arrived while this write was in flight queued no job of its own
+						if(iter->second.first == sequence) {
+							m_write.erase(iter);
+						} else {
+							m_job.push_back({ job.coordinate, true });
+							m_condition.notify_one();
+						}
+					}
+
+					if(found) {
+						++m_saved;
+					}
+				} else if(m_read.erase(job.coordinate)) {
+
+					if(found) {
+						result.chunk = chunk;
+						++m_loaded;
+					}
+
+					result.coordinate = job.coordinate;
+					result.found = found;
+					m_result.push_back(result);
+				}
+			}
+
+			gaea::engine::region::base & 
+			_manager::find(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				std::stringstream path;
+				gaea::engine::region::base *result = nullptr;
+				glm::ivec3 key = gaea::engine::region::coordinate(coordinate);
+				std::lock_guard<std::mutex> lock(m_region_lock);
+				std::unordered_map<glm::ivec3, gaea::engine::region::base *,
+					gaea::engine::chunk::hash_t>::iterator iter = m_region.find(key);
+
+				if(iter == m_region.end()) {
+					path << m_path << "r." << key.x << "." << key.y << "." << key.z << REGION_EXTENSION;
+
+					result = new gaea::engine::region::base(path.str());
+					if(!result) {
+						THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_EXTERNAL,
+							"Failed to allocate region: %s", STRING_CHECK(path.str()));
+					}
+
+					iter = m_region.insert(std::pair<glm::ivec3, gaea::engine::region::base *>(key, result)).first;
+				}
+
+				return *iter->second;
+			}
+
+			void 
+			_manager::initialize(
+				__in_opt const std::string &path,
+				__in_opt size_t workers
+				)
+			{
+				size_t iter = 0;
+
+				if(m_initialized) {
+					THROW_GAEA_REGION_EXCEPTION(GAEA_REGION_EXCEPTION_INITIALIZED);
+				}
+
+				if(!workers || path.empty()) {
+					THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_INVALID,
+						"Path=%s, Workers=%u", STRING_CHECK(path), (uint32_t) workers);
+				}
+
+				if(mkdir(path.c_str(), REGION_MODE_DIRECTORY) && (errno != EEXIST)) {
+					THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_EXTERNAL,
+						"mkdir failed: %s (%s)", STRING_CHECK(path), strerror(errno));
+				}
+
+				m_path = path;
+				if(m_path.back() != '/') {
+					m_path += '/';
+				}
+
+#ifdef GAEA_IO_URING
+				m_uring = !io_uring_queue_init(REGION_BATCH_MAX * 2, &REGION_RING, 0);
+				if(m_uring) {
+					workers = 1;
+				}
+#endif // GAEA_IO_URING
+
+				m_initialized = true;
+
+				for(; iter < workers; ++iter) {
+					m_worker.push_back(std::thread(gaea::engine::region::manager::_thread));
+				}
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::region::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_initialized(void)
+			{
+				return m_initialized;
+			}
+
+			void 
+			_manager::load(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				gaea::engine::region::result_t result;
+				std::unordered_map<glm::ivec3, std::pair<uint64_t, gaea::engine::chunk::base>,
+					gaea::engine::chunk::hash_t>::iterator iter;
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				if(!m_initialized) {
+					THROW_GAEA_REGION_EXCEPTION(GAEA_REGION_EXCEPTION_UNINITIALIZED);
+				}
+
+				iter = m_write.find(coordinate);
+				if(iter != m_write.end()) {
+					result.chunk = iter->second.second;
+					result.coordinate = coordinate;
+					result.found = true;
+					m_result.push_back(result);
+					++m_loaded;
+				} else if(m_read.insert(coordinate).second) {
+					m_job.push_back({ coordinate, false });
+					m_condition.notify_one();
+				}
+			}
+
+			size_t 
+			_manager::loaded(void)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				return m_loaded;
+			}
+
+			size_t 
+			_manager::pending(void)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				return (m_read.size() + m_write.size());
+			}
+
+			void 
+			_manager::process(
+				__in const std::vector<job_t> &job,
+				__in const std::vector<std::pair<uint64_t, gaea::engine::chunk::base>> &chunk
+				)
+			{
+				size_t iter = 0;
+				bool found;
+				gaea::engine::chunk::base result;
+#ifdef GAEA_IO_URING
+				off_t offset;
+				size_t count = 0, length;
+				uint32_t entry, position;
+				struct io_uring_cqe *cqe;
+				struct io_uring_sqe *sqe;
+				std::vector<int> status(job.size(), 0);
+				std::vector<std::vector<uint8_t>> record(job.size());
+
+				if(m_uring) {
+
+					for(; iter < job.size(); ++iter) {
+						position = gaea::engine::region::index(job[iter].coordinate);
+
+						try {
+							gaea::engine::region::base &region = find(job[iter].coordinate);
+
+							if(job[iter].write) {
+								gaea::engine::region::base::encode(chunk[iter].second, record[iter]);
+								length = record[iter].size();
+								offset = region.allocate(position, length);
+
+								// the table entry rides behind the record, so a later allocate cannot change it
+								entry = region.entry(position);
+								record[iter].resize(length + sizeof(entry));
+								std::memcpy(record[iter].data() + length, &entry, sizeof(entry));
+
+								sqe = region_sqe(REGION_SQE_WRITE);
+								if(!sqe) {
+									THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_EXTERNAL,
+										"io_uring_get_sqe failed: %p", sqe);
+								}
+
+								io_uring_prep_write(sqe, region.file(), record[iter].data(), length, offset);
+								io_uring_sqe_set_data(sqe, (void *) iter);
+								sqe->flags |= IOSQE_IO_LINK;
+
+								sqe = io_uring_get_sqe(&REGION_RING);
+								io_uring_prep_write(sqe, region.file(), record[iter].data() + length, sizeof(entry),
+									REGION_TABLE_OFFSET(position));
+								io_uring_sqe_set_data(sqe, (void *) iter);
+								count += 2;
+							} else if(region.locate(position, offset, length)) {
+								record[iter].resize(length);
+
+								sqe = region_sqe(REGION_SQE_READ);
+								if(!sqe) {
+									THROW_GAEA_REGION_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_EXTERNAL,
+										"io_uring_get_sqe failed: %p", sqe);
+								}
+
+								io_uring_prep_read(sqe, region.file(), record[iter].data(), length, offset);
+								io_uring_sqe_set_data(sqe, (void *) iter);
+								++count;
+							} else {
+								status[iter] = -ENOENT;
+							}
+						} catch(gaea::exception &exc) {
+							status[iter] = -EIO;
+						}
+					}
+
+					if(count) {
+						io_uring_submit_and_wait(&REGION_RING, count);
+
+						for(; count; --count) {
+
+							if(io_uring_wait_cqe(&REGION_RING, &cqe)) {
+								break;
+							}
+
+							iter = (size_t) io_uring_cqe_get_data(cqe);
+							if(cqe->res < 0) {
+								status[iter] = cqe->res;
+							} else if(!job[iter].write && ((size_t) cqe->res != record[iter].size())) {
+								status[iter] = -EIO;
+							}
+
+							io_uring_cqe_seen(&REGION_RING, cqe);
+						}
+					}
+
+					for(iter = 0; iter < job.size(); ++iter) {
+						found = !status[iter];
+
+						if(found && !job[iter].write) {
+
+							try {
+								gaea::engine::region::base::decode(record[iter], result);
+							} catch(gaea::exception &exc) {
+								found = false;
+							}
+						}
+
+						complete(job[iter], found, result, chunk[iter].first);
+					}
+
+					return;
+				}
+#endif // GAEA_IO_URING
+
+				for(; iter < job.size(); ++iter) {
+
+					try {
+						gaea::engine::region::base &region = find(job[iter].coordinate);
+
+						if(job[iter].write) {
+							region.write(job[iter].coordinate, chunk[iter].second);
+							found = true;
+						} else {
+							found = region.read(job[iter].coordinate, result);
+						}
+					} catch(gaea::exception &exc) {
+						found = false;
+					}
+
+					complete(job[iter], found, result, chunk[iter].first);
+				}
+			}
+
+			void 
+			_manager::save(
+				__in const glm::ivec3 &coordinate,
+				__in const gaea::engine::chunk::base &chunk
+				)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				if(!m_initialized) {
+					THROW_GAEA_REGION_EXCEPTION(GAEA_REGION_EXCEPTION_UNINITIALIZED);
+				}
+
+				if(m_write.find(coordinate) == m_write.end()) {
+					m_job.push_back({ coordinate, true });
+					m_condition.notify_one();
+				}
+
+				m_write[coordinate] = std::pair<uint64_t, gaea::engine::chunk::base>(++m_sequence, chunk);
+			}
+
+			size_t 
+			_manager::saved(void)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				return m_saved;
+			}
+
+			void 
+			_manager::take(
+				__out std::vector<job_t> &job,
+				__out std::vector<std::pair<uint64_t, gaea::engine::chunk::base>> &chunk,
+				__in size_t count
+				)
+			{
+				std::unordered_map<glm::ivec3, std::pair<uint64_t, gaea::engine::chunk::base>,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				for(; count && !m_job.empty(); --count) {
+					job.push_back(m_job.front());
+					m_job.pop_front();
+
+					if(job.back().write) {
+						iter = m_write.find(job.back().coordinate);
+						chunk.push_back(iter->second);
+					} else {
+						chunk.push_back(std::pair<uint64_t, gaea::engine::chunk::base>(0,
+							gaea::engine::chunk::base()));
+					}
+				}
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				size_t count = 0;
+				std::stringstream result;
+				std::unordered_map<glm::ivec3, gaea::engine::region::base *,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				result << GAEA_REGION_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
+
+				if(m_initialized) {
+					std::lock_guard<std::mutex> lock(m_lock);
+
+					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+						<< ", PATH=" << STRING_CHECK(m_path)
+						<< ", IO=" << (m_uring ? "URING" : "POOL")
+						<< ", WORKERS=" << m_worker.size()
+						<< ", QUEUED=" << m_job.size()
+						<< ", PENDING=" << (m_read.size() + m_write.size())
+						<< ", LOADED=" << m_loaded
+						<< ", SAVED=" << m_saved;
+
+					if(verbose) {
+						std::lock_guard<std::mutex> region_lock(m_region_lock);
+
+						for(iter = m_region.begin(); iter != m_region.end(); ++count, ++iter) {
+							result << std::endl << "[" << count << "] " << iter->second->to_string(verbose);
+						}
+					}
+				}
+
+				return result.str();
+			}
+
+			void 
+			_manager::uninitialize(void)
+			{
+				std::deque<job_t>::iterator job_iter;
+				std::vector<std::thread>::iterator iter;
+
+				if(m_initialized) {
+
+					m_lock.lock();
+
+					for(job_iter = m_job.begin(); job_iter != m_job.end();) {
+
+						if(!job_iter->write) {
+							job_iter = m_job.erase(job_iter);
+						} else {
+							++job_iter;
+						}
+					}
+
+					m_read.clear();
+					m_initialized = false;
+					m_condition.notify_all();
+					m_lock.unlock();
+
+					for(iter = m_worker.begin(); iter != m_worker.end(); ++iter) {
+
+						if(iter->joinable()) {
+							iter->join();
+						}
+					}
+
+					m_worker.clear();
+
+#ifdef GAEA_IO_URING
+					if(m_uring) {
+						io_uring_queue_exit(&REGION_RING);
+						m_uring = false;
+					}
+#endif // GAEA_IO_URING
+
+					clear();
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,90 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_REGION_TYPE_H_
+#define GAEA_REGION_TYPE_H_
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace region {
+
+			#define GAEA_REGION_HEADER "[GAEA::ENGINE::REGION]"
+#ifndef NDEBUG
+			#define GAEA_REGION_EXCEPTION_HEADER GAEA_REGION_HEADER " "
+#else
+			#define GAEA_REGION_EXCEPTION_HEADER
+#endif // NDEBUG
+
+			enum {
+				GAEA_REGION_EXCEPTION_ALLOCATED = 0,
+				GAEA_REGION_EXCEPTION_EXTERNAL,
+				GAEA_REGION_EXCEPTION_INITIALIZED,
+				GAEA_REGION_EXCEPTION_INVALID,
+				GAEA_REGION_EXCEPTION_MALFORMED,
+				GAEA_REGION_EXCEPTION_UNINITIALIZED,
+			};
+
+			#define GAEA_REGION_EXCEPTION_MAX GAEA_REGION_EXCEPTION_UNINITIALIZED
+
+			static const std::string GAEA_REGION_EXCEPTION_STR[] = {
+				GAEA_REGION_EXCEPTION_HEADER "Failed to allocate region manager",
+				GAEA_REGION_EXCEPTION_HEADER "External exception",
+				GAEA_REGION_EXCEPTION_HEADER "Region manager is initialized",
+				GAEA_REGION_EXCEPTION_HEADER "Invalid region manager parameter",
+				GAEA_REGION_EXCEPTION_HEADER "Malformed region file",
+				GAEA_REGION_EXCEPTION_HEADER "Region manager is uninitialized",
+				};
+
+			#define GAEA_REGION_EXCEPTION_STRING(_TYPE_) \
+				((_TYPE_) > GAEA_REGION_EXCEPTION_MAX ? GAEA_REGION_EXCEPTION_HEADER EXCEPTION_UNKNOWN : \
+				STRING_CHECK(GAEA_REGION_EXCEPTION_STR[_TYPE_]))
+
+			#define THROW_GAEA_REGION_EXCEPTION(_EXCEPT_) \
+				THROW_EXCEPTION(GAEA_REGION_EXCEPTION_STRING(_EXCEPT_))
+			#define THROW_GAEA_REGION_EXCEPTION_FORMAT(_EXCEPT_, _FORMAT_, ...) \
+				THROW_EXCEPTION_FORMAT(GAEA_REGION_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+			/*
+			 * On-disk layout (little-endian), in REGION_SECTOR sized sectors:
+			 *   header | table (REGION_AREA entries) | records ...
+			 * A table entry is (sector << 8) | count, zero when the chunk is absent.
+			 * Each record is a region_record_t followed by the compressed chunk.
+			 */
+
+			#define REGION_MAGIC 0x4e475247 // "GRGN"
+			#define REGION_VERSION 1
+
+			typedef struct __attribute__((packed)) {
+				uint32_t magic;
+				uint16_t version;
+				uint16_t reserved;
+			} region_header_t;
+
+			typedef struct __attribute__((packed)) {
+				uint32_t length;
+				uint8_t compression;
+				uint8_t reserved[3];
+			} region_record_t;
+		}
+	}
+}
+
+#endif // GAEA_REGION_TYPE_H_
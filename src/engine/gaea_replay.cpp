@@ -0,0 +1,317 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include "../../include/gaea.h"
+#include "gaea_replay_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace replay {
+
+			#define REPLAY_NS_PER_US 1000
+
+			_player::_player(void) :
+				m_count(0),
+				m_offset(0),
+				m_played(0)
+			{
+				return;
+			}
+
+			_player::~_player(void)
+			{
+				close();
+			}
+
+			std::string 
+			_player::as_string(
+				__in const _player &object,
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << GAEA_REPLAY_HEADER << " PLAY";
+
+				if(!object.m_data.empty()) {
+					result << ", PATH=" << object.m_path << ", PLAYED=" << object.m_played << "/" << object.m_count;
+
+					if(verbose) {
+						result << ", OFF=" << object.m_offset << "/" << object.m_data.size();
+					}
+				} else {
+					result << " (CLOSED)";
+				}
+
+				return result.str();
+			}
+
+			void 
+			_player::close(void)
+			{
+				m_count = 0;
+				m_data.clear();
+				m_offset = 0;
+				m_path.clear();
+				m_played = 0;
+			}
+
+			bool 
+			_player::is_finished(void)
+			{
+				return (m_played == m_count);
+			}
+
+			bool 
+			_player::is_open(void)
+			{
+				return !m_data.empty();
+			}
+
+			void 
+			_player::open(
+				__in const std::string &path
+				)
+			{
+				size_t offset;
+				std::ifstream file;
+				std::streamoff length;
+				gaea::engine::replay::replay_header_t header;
+				gaea::engine::replay::replay_record_t record;
+
+				close();
+
+				file = std::ifstream(path.c_str(), std::ios::in | std::ios::binary);
+				if(!file) {
+					THROW_GAEA_REPLAY_EXCEPTION_FORMAT(GAEA_REPLAY_EXCEPTION_NOT_FOUND, "%s", STRING_CHECK(path));
+				}
+
+				file.seekg(0, std::ios::end);
+				length = file.tellg();
+				file.seekg(0, std::ios::beg);
+
+				if(length < (std::streamoff) sizeof(header)) {
+					THROW_GAEA_REPLAY_EXCEPTION_FORMAT(GAEA_REPLAY_EXCEPTION_MALFORMED, "%s", STRING_CHECK(path));
+				}
+
+				m_data.resize(length, 0);
+				file.read((char *) &m_data[0], length);
+				file.close();
+
+				std::memcpy(&header, &m_data[0], sizeof(header));
+				if((header.magic != REPLAY_MAGIC) || (header.version != REPLAY_VERSION)) {
+					m_data.clear();
+					THROW_GAEA_REPLAY_EXCEPTION_FORMAT(GAEA_REPLAY_EXCEPTION_MALFORMED, "%s (magic=%x, version=%u)",
+						STRING_CHECK(path), header.magic, header.version);
+				}
+
+				// validate every record up front, so playback never reads past the end
+				for(offset = sizeof(header); offset < m_data.size(); ++m_count) {
+
+					if((m_data.size() - offset) < sizeof(record)) {
+						break;
+					}
+
+					std::memcpy(&record, &m_data[offset], sizeof(record));
+					offset += (sizeof(record) + record.length);
+				}
+
+				if(offset != m_data.size()) {
+					m_count = 0;
+					m_data.clear();
+					THROW_GAEA_REPLAY_EXCEPTION_FORMAT(GAEA_REPLAY_EXCEPTION_MALFORMED, "%s (truncated)",
+						STRING_CHECK(path));
+				}
+
+				m_offset = sizeof(header);
+				m_path = path;
+			}
+
+			size_t 
+			_player::play(
+				__in uint32_t frame,
+				__in_opt gaea::engine::replay::input_cb handler
+				)
+			{
+				size_t result = 0;
+				gaea::engine::replay::replay_record_t record;
+
+				if(m_data.empty()) {
+					THROW_GAEA_REPLAY_EXCEPTION(GAEA_REPLAY_EXCEPTION_UNINITIALIZED);
+				}
+
+				while(m_offset < m_data.size()) {
+					std::memcpy(&record, &m_data[m_offset], sizeof(record));
+
+					if(record.frame > frame) {
+						break;
+					}
+
+					if(handler) {
+						handler(record.specifier, record.length ? &m_data[m_offset + sizeof(record)] : nullptr,
+							record.length);
+					} else {
+						gaea::engine::event::notify(EVENT_INPUT, record.specifier,
+							record.length ? &m_data[m_offset + sizeof(record)] : nullptr, record.length);
+					}
+					m_offset += (sizeof(record) + record.length);
+					++m_played;
+					++result;
+				}
+
+				return result;
+			}
+
+			size_t 
+			_player::size(void)
+			{
+				return m_count;
+			}
+
+			std::string 
+			_player::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::engine::replay::player::as_string(*this, verbose);
+			}
+
+			_recorder::_recorder(void) :
+				m_begin(0),
+				m_count(0)
+			{
+				return;
+			}
+
+			_recorder::~_recorder(void)
+			{
+				close();
+			}
+
+			std::string 
+			_recorder::as_string(
+				__in const _recorder &object,
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << GAEA_REPLAY_HEADER << " RECORD";
+
+				if(object.m_file.is_open()) {
+					result << ", PATH=" << object.m_path << ", RECORDED=" << object.m_count;
+				} else {
+					result << " (CLOSED)";
+				}
+
+				return result.str();
+			}
+
+			void 
+			_recorder::close(void)
+			{
+
+				if(m_file.is_open()) {
+					m_file.close();
+				}
+
+				m_begin = 0;
+				m_count = 0;
+				m_path.clear();
+			}
+
+			bool 
+			_recorder::is_open(void)
+			{
+				return m_file.is_open();
+			}
+
+			void 
+			_recorder::open(
+				__in const std::string &path
+				)
+			{
+				gaea::engine::replay::replay_header_t header;
+
+				close();
+
+				m_file.open(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+				if(!m_file) {
+					THROW_GAEA_REPLAY_EXCEPTION_FORMAT(GAEA_REPLAY_EXCEPTION_NOT_FOUND, "%s", STRING_CHECK(path));
+				}
+
+				std::memset(&header, 0, sizeof(header));
+				header.magic = REPLAY_MAGIC;
+				header.version = REPLAY_VERSION;
+				m_file.write((const char *) &header, sizeof(header));
+				m_begin = gaea::engine::profile::now();
+				m_path = path;
+			}
+
+			void 
+			_recorder::record(
+				__in uint32_t frame,
+				__in uint32_t specifier,
+				__in const void *context,
+				__in size_t length
+				)
+			{
+				gaea::engine::replay::replay_record_t record;
+
+				if(!m_file.is_open()) {
+					THROW_GAEA_REPLAY_EXCEPTION(GAEA_REPLAY_EXCEPTION_UNINITIALIZED);
+				}
+
+				if((specifier > UINT8_MAX) || (length > UINT8_MAX) || (!context && length)) {
+					THROW_GAEA_REPLAY_EXCEPTION_FORMAT(GAEA_REPLAY_EXCEPTION_INVALID, "%x, %p[%u]", specifier,
+						context, (uint32_t) length);
+				}
+
+				record.frame = frame;
+				record.offset = ((gaea::engine::profile::now() - m_begin) / REPLAY_NS_PER_US);
+				record.specifier = specifier;
+				record.length = length;
+				m_file.write((const char *) &record, sizeof(record));
+
+				if(length) {
+					m_file.write((const char *) context, length);
+				}
+
+				++m_count;
+			}
+
+			size_t 
+			_recorder::size(void)
+			{
+				return m_count;
+			}
+
+			std::string 
+			_recorder::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::engine::replay::recorder::as_string(*this, verbose);
+			}
+		}
+	}
+}
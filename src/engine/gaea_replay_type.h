@@ -0,0 +1,86 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GAEA_REPLAY_TYPE_H_
+#define GAEA_REPLAY_TYPE_H_
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace replay {
+
+			#define GAEA_REPLAY_HEADER "[GAEA::ENGINE::REPLAY]"
+#ifndef NDEBUG
+			#define GAEA_REPLAY_EXCEPTION_HEADER GAEA_REPLAY_HEADER " "
+#else
+			#define GAEA_REPLAY_EXCEPTION_HEADER
+#endif // NDEBUG
+
+			enum {
+				GAEA_REPLAY_EXCEPTION_INVALID = 0,
+				GAEA_REPLAY_EXCEPTION_MALFORMED,
+				GAEA_REPLAY_EXCEPTION_NOT_FOUND,
+				GAEA_REPLAY_EXCEPTION_UNINITIALIZED,
+			};
+
+			#define GAEA_REPLAY_EXCEPTION_MAX GAEA_REPLAY_EXCEPTION_UNINITIALIZED
+
+			static const std::string GAEA_REPLAY_EXCEPTION_STR[] = {
+				GAEA_REPLAY_EXCEPTION_HEADER "Invalid replay record",
+				GAEA_REPLAY_EXCEPTION_HEADER "Malformed replay file",
+				GAEA_REPLAY_EXCEPTION_HEADER "Replay file does not exist",
+				GAEA_REPLAY_EXCEPTION_HEADER "Replay file is not open",
+				};
+
+			#define GAEA_REPLAY_EXCEPTION_STRING(_TYPE_) \
+				((_TYPE_) > GAEA_REPLAY_EXCEPTION_MAX ? GAEA_REPLAY_EXCEPTION_HEADER EXCEPTION_UNKNOWN : \
+				STRING_CHECK(GAEA_REPLAY_EXCEPTION_STR[_TYPE_]))
+
+			#define THROW_GAEA_REPLAY_EXCEPTION(_EXCEPT_) \
+				THROW_EXCEPTION(GAEA_REPLAY_EXCEPTION_STRING(_EXCEPT_))
+			#define THROW_GAEA_REPLAY_EXCEPTION_FORMAT(_EXCEPT_, _FORMAT_, ...) \
+				THROW_EXCEPTION_FORMAT(GAEA_REPLAY_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
+
+			/*
+			 * On-disk layout (little-endian):
+			 *   header | record | payload | record | payload ...
+			 * Payloads are the raw input event, exactly as passed to event::notify.
+			 */
+
+			#define REPLAY_MAGIC 0x50524747 // "GGRP"
+			#define REPLAY_VERSION 1
+
+			typedef struct __attribute__((packed)) {
+				uint32_t magic;
+				uint16_t version;
+				uint16_t reserved;
+			} replay_header_t;
+
+			typedef struct __attribute__((packed)) {
+				uint32_t frame;
+				uint32_t offset;
+				uint8_t specifier;
+				uint8_t length;
+			} replay_record_t;
+		}
+	}
+}
+
+#endif // GAEA_REPLAY_TYPE_H_
@@ -17,6 +17,13 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #include "../../include/gaea.h"
 #include "gaea_signal_type.h"
 
@@ -26,10 +33,33 @@ namespace gaea {
 
 		namespace signal {
 
+			#define SIGNAL_NOTIFIED 1
+			#define SIGNAL_NS_PER_SEC 1000000000LL
+			#define SIGNAL_WAITER 2
+
+#if defined(__i386__) || defined(__x86_64__)
+			#define SIGNAL_PAUSE() __builtin_ia32_pause()
+#else
+			#define SIGNAL_PAUSE()
+#endif // __i386__ || __x86_64__
+
+			#define SIGNAL_WAITING(_STATE_) ((_STATE_) / SIGNAL_WAITER)
+
+			static long 
+			futex(
+				__in std::atomic<uint32_t> &state,
+				__in int operation,
+				__in uint32_t value,
+				__in_opt const struct timespec *timeout = nullptr
+				)
+			{
+				return syscall(SYS_futex, (uint32_t *) &state, operation, value, timeout, nullptr, 0);
+			}
+
 			_base::_base(
 				__in_opt bool notified
 				) :
-					m_notified(notified)
+					m_state(notified ? SIGNAL_NOTIFIED : 0)
 			{
 				return;
 			}
@@ -37,7 +67,7 @@ namespace gaea {
 			_base::_base(
 				__in _base &other
 				) :
-					m_notified(other.m_notified)
+					m_state(other.m_state & SIGNAL_NOTIFIED)
 			{
 				return;
 			}
@@ -54,7 +84,12 @@ namespace gaea {
 			{
 
 				if(this != &other) {
-					m_notified = other.m_notified;
+
+					if(other.is_notified()) {
+						notify();
+					} else {
+						clear();
+					}
 				}
 
 				return *this;
@@ -66,9 +101,14 @@ namespace gaea {
 				__in_opt bool verbose
 				)
 			{
+				uint32_t state = object.m_state;
 				std::stringstream result;
 
-				result << (object.m_notified ? "NOTIFIED" : "CLEAR");
+				result << ((state & SIGNAL_NOTIFIED) ? "NOTIFIED" : "CLEAR");
+
+				if(verbose) {
+					result << ", WAIT=" << SIGNAL_WAITING(state);
+				}
 
 				return result.str();
 			}
@@ -76,25 +116,110 @@ namespace gaea {
 			void 
 			_base::clear(void)
 			{
-				std::lock_guard<std::mutex> lock(m_mutex);
+				m_state.fetch_and(~SIGNAL_NOTIFIED);
+			}
 
-				m_notified = false;
-				m_condition.notify_all();
+			bool 
+			_base::consume(void)
+			{
+				uint32_t state = m_state.load(std::memory_order_relaxed);
+
+				while(state & SIGNAL_NOTIFIED) {
+
+					if(m_state.compare_exchange_weak(state, state & ~SIGNAL_NOTIFIED, std::memory_order_acquire,
+							std::memory_order_relaxed)) {
+						return true;
+					}
+				}
+
+				return false;
 			}
 
 			bool 
 			_base::is_notified(void)
 			{
-				return m_notified;
+				return ((m_state & SIGNAL_NOTIFIED) != 0);
 			}
 
 			void 
 			_base::notify(void)
 			{
-				std::lock_guard<std::mutex> lock(m_mutex);
+				uint32_t state = m_state.fetch_or(SIGNAL_NOTIFIED);
 
-				m_notified = true;
-				m_condition.notify_all();
+				if(!(state & SIGNAL_NOTIFIED) && SIGNAL_WAITING(state)) {
+					gaea::engine::signal::futex(m_state, FUTEX_WAKE_PRIVATE, 1);
+				}
+			}
+
+			bool 
+			_base::park(
+				__in bool timed,
+				__in_opt uint64_t timeout
+				)
+			{
+				int error;
+				uint32_t iter = 0, state;
+				struct timespec remaining;
+				std::chrono::nanoseconds left;
+				std::chrono::steady_clock::time_point deadline;
+
+				// spinning only pays off when the notifier can run on another core
+				static const uint32_t spin = ((std::thread::hardware_concurrency() > 1) ? SIGNAL_SPIN_INIT : 0);
+
+				for(; iter < spin; ++iter) {
+
+					if(consume()) {
+						return true;
+					}
+
+					SIGNAL_PAUSE();
+				}
+
+				if(timed) {
+					deadline = (std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout));
+				}
+
+				m_state.fetch_add(SIGNAL_WAITER);
+
+				for(;;) {
+
+					state = m_state.load();
+					if(state & SIGNAL_NOTIFIED) {
+
+						// consume the flag and leave the waiter count in one step
+						if(m_state.compare_exchange_weak(state, (state & ~SIGNAL_NOTIFIED) - SIGNAL_WAITER)) {
+							return true;
+						}
+
+						continue;
+					}
+
+					if(timed) {
+
+						left = std::chrono::duration_cast<std::chrono::nanoseconds>(
+							deadline - std::chrono::steady_clock::now());
+						if(left.count() <= 0) {
+							m_state.fetch_sub(SIGNAL_WAITER);
+							break;
+						}
+
+						remaining.tv_sec = (left.count() / SIGNAL_NS_PER_SEC);
+						remaining.tv_nsec = (left.count() % SIGNAL_NS_PER_SEC);
+					}
+
+					if(gaea::engine::signal::futex(m_state, FUTEX_WAIT_PRIVATE, state, timed ? &remaining : nullptr) 
+							== -1) {
+
+						error = errno;
+						if((error != EAGAIN) && (error != EINTR) && (error != ETIMEDOUT)) {
+							m_state.fetch_sub(SIGNAL_WAITER);
+							THROW_GAEA_SIGNAL_EXCEPTION_FORMAT(GAEA_SIGNAL_EXCEPTION_EXTERNAL,
+								"futex: %s", std::strerror(error));
+						}
+					}
+				}
+
+				return false;
 			}
 
 			std::string 
@@ -108,10 +233,21 @@ namespace gaea {
 			void 
 			_base::wait(void)
 			{
-				std::unique_lock<std::mutex> lock(m_mutex);
+				park(false);
+			}
+
+			bool 
+			_base::wait_for(
+				__in uint64_t timeout
+				)
+			{
+				return park(true, timeout);
+			}
 
-				m_condition.wait(lock, [this] { return m_notified; });
-				m_notified = false;
+			uint32_t 
+			_base::waiting(void)
+			{
+				return SIGNAL_WAITING(m_state.load());
 			}
 		}
 	}
@@ -34,13 +34,13 @@ namespace gaea {
 #endif // NDEBUG
 
 			enum {
-				GAEA_SIGNAL_EXCEPTION_NONE = 0,
+				GAEA_SIGNAL_EXCEPTION_EXTERNAL = 0,
 			};
 
-			#define GAEA_SIGNAL_EXCEPTION_MAX GAEA_SIGNAL_EXCEPTION_NONE
+			#define GAEA_SIGNAL_EXCEPTION_MAX GAEA_SIGNAL_EXCEPTION_EXTERNAL
 
 			static const std::string GAEA_SIGNAL_EXCEPTION_STR[] = {
-				GAEA_SIGNAL_EXCEPTION_HEADER "",
+				GAEA_SIGNAL_EXCEPTION_HEADER "External exception",
 				};
 
 			#define GAEA_SIGNAL_EXCEPTION_STRING(_TYPE_) \
@@ -0,0 +1,394 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include "../../include/gaea.h"
+#include "gaea_stream_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace stream {
+
+			static inline int32_t 
+			distance(
+				__in const glm::ivec3 &coordinate,
+				__in const glm::ivec3 &focus
+				)
+			{
+				return (((coordinate.x - focus.x) * (coordinate.x - focus.x))
+					+ ((coordinate.z - focus.z) * (coordinate.z - focus.z)));
+			}
+
+			static inline bool 
+			persistent(void)
+			{
+				bool result = false;
+
+				if(gaea::engine::region::manager::is_allocated()) {
+					result = gaea::engine::region::manager::acquire().is_initialized();
+				}
+
+				return result;
+			}
+
+			static inline int32_t 
+			radius(void)
+			{
+				int32_t result = TERRAIN_RADIUS_INIT;
+
+				if(gaea::engine::terrain::manager::is_allocated()) {
+
+					gaea::engine::terrain::manager &instance = gaea::engine::terrain::manager::acquire();
+					if(instance.is_initialized()) {
+						result = instance.radius();
+					}
+				}
+
+				return result;
+			}
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_evicted(0),
+				m_focused(false),
+				m_footprint(0),
+				m_hysteresis(STREAM_HYSTERESIS_INIT),
+				m_initialized(false),
+				m_memory(STREAM_MEMORY_INIT),
+				m_tick(0)
+			{
+				std::atexit(gaea::engine::stream::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				uninitialize();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::stream::manager::m_instance) {
+					delete gaea::engine::stream::manager::m_instance;
+					gaea::engine::stream::manager::m_instance = nullptr;
+				}
+			}
+
+			_manager & 
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::stream::manager::m_instance) {
+
+					gaea::engine::stream::manager::m_instance = new gaea::engine::stream::manager;
+					if(!gaea::engine::stream::manager::m_instance) {
+						THROW_GAEA_STREAM_EXCEPTION(GAEA_STREAM_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::stream::manager::m_instance;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+				m_access.clear();
+				m_evict.clear();
+				m_evicted = 0;
+				m_focused = false;
+				m_footprint = 0;
+				m_tick = 0;
+			}
+
+			void 
+			_manager::evict(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				int32_t view = radius();
+				gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+
+				if(distance(coordinate, m_focus) <= (view * view)) {
+					return;
+				}
+
+				if(gaea::engine::mesh::manager::is_allocated()) {
+
+					gaea::engine::mesh::manager &mesh = gaea::engine::mesh::manager::acquire();
+					if(mesh.is_initialized() && mesh.contains(coordinate)) {
+						mesh.erase(coordinate);
+					}
+				}
+
+				if(world.contains(coordinate)) {
+
+					if(persistent()) {
+						gaea::engine::region::manager::acquire().save(coordinate, world.chunk(coordinate));
+					}
+
+					world.erase(coordinate);
+					++m_evicted;
+				}
+
+				m_access.erase(coordinate);
+			}
+
+			size_t 
+			_manager::evicted(void)
+			{
+				return m_evicted;
+			}
+
+			void 
+			_manager::initialize(
+				__in_opt int32_t hysteresis,
+				__in_opt size_t memory
+				)
+			{
+
+				if(m_initialized) {
+					THROW_GAEA_STREAM_EXCEPTION(GAEA_STREAM_EXCEPTION_INITIALIZED);
+				}
+
+				if(hysteresis < 0) {
+					THROW_GAEA_STREAM_EXCEPTION_FORMAT(GAEA_STREAM_EXCEPTION_INVALID,
+						"Hysteresis=%i", hysteresis);
+				}
+
+				m_hysteresis = hysteresis;
+				m_memory = memory;
+				m_initialized = true;
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::stream::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_initialized(void)
+			{
+				return m_initialized;
+			}
+
+			size_t 
+			_manager::memory(void)
+			{
+				size_t result = gaea::engine::world::manager::acquire().memory();
+
+				if(gaea::engine::mesh::manager::is_allocated()) {
+
+					gaea::engine::mesh::manager &mesh = gaea::engine::mesh::manager::acquire();
+					if(mesh.is_initialized()) {
+						result += mesh.memory();
+					}
+				}
+
+				return result;
+			}
+
+			void 
+			_manager::sweep(void)
+			{
+				size_t current;
+				int64_t excess;
+				int32_t inner = radius(), outer;
+				std::vector<glm::ivec3> coordinate, outside;
+				std::vector<glm::ivec3>::iterator iter;
+				std::vector<std::pair<uint64_t, glm::ivec3>> candidate;
+				std::vector<std::pair<uint64_t, glm::ivec3>>::iterator candidate_iter;
+				std::unordered_map<glm::ivec3, uint64_t, gaea::engine::chunk::hash_t>::iterator access_iter;
+				gaea::engine::mesh::manager *mesh = nullptr;
+				gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+
+				if(gaea::engine::mesh::manager::is_allocated()
+						&& gaea::engine::mesh::manager::acquire().is_initialized()) {
+					mesh = &gaea::engine::mesh::manager::acquire();
+				}
+
+				outer = (inner + m_hysteresis);
+				coordinate = world.coordinates();
+				m_evict.clear();
+
+				for(iter = coordinate.begin(); iter != coordinate.end(); ++iter) {
+
+					if(distance(*iter, m_focus) > (outer * outer)) {
+						outside.push_back(*iter);
+					} else if(distance(*iter, m_focus) > (inner * inner)) {
+						access_iter = m_access.find(*iter);
+						candidate.push_back(std::pair<uint64_t, glm::ivec3>((access_iter != m_access.end())
+							? access_iter->second : 0, *iter));
+					}
+				}
+
+				current = memory();
+				m_footprint = current;
+				if(current > m_memory) {
+					excess = (current - m_memory);
+
+					std::sort(candidate.begin(), candidate.end(),
+						[](const std::pair<uint64_t, glm::ivec3> &left,
+								const std::pair<uint64_t, glm::ivec3> &right) {
+							return (left.first < right.first);
+						});
+
+					for(candidate_iter = candidate.begin(); (candidate_iter != candidate.end()) && (excess > 0);
+							++candidate_iter) {
+						excess -= world.chunk(candidate_iter->second).memory();
+						if(mesh) {
+							excess -= mesh->memory(candidate_iter->second);
+						}
+
+						m_evict.push_back(candidate_iter->second);
+					}
+
+					std::reverse(m_evict.begin(), m_evict.end());
+				}
+
+				m_evict.insert(m_evict.end(), outside.begin(), outside.end());
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << GAEA_STREAM_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
+
+				if(m_initialized) {
+					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+						<< ", HYST=" << m_hysteresis
+						<< ", CAP=" << (m_memory / BYTES_PER_KBYTE) << " KB"
+						<< ", FOCUS={" << m_focus.x << ", " << m_focus.y << ", " << m_focus.z << "}"
+						<< ", TRACKED=" << m_access.size()
+						<< ", QUEUED=" << m_evict.size()
+						<< ", EVICTED=" << m_evicted;
+				}
+
+				return result.str();
+			}
+
+			void 
+			_manager::touch(void)
+			{
+				glm::ivec3 coordinate;
+				int32_t view = radius(), x, y, z;
+				gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+
+				for(z = -view; z <= view; ++z) {
+
+					for(x = -view; x <= view; ++x) {
+
+						if(((x * x) + (z * z)) > (view * view)) {
+							continue;
+						}
+
+						for(y = TERRAIN_CHUNK_BOTTOM; y <= TERRAIN_CHUNK_TOP; ++y) {
+							coordinate = glm::ivec3(m_focus.x + x, y, m_focus.z + z);
+
+							if(world.contains(coordinate)) {
+								m_access[coordinate] = m_tick;
+							}
+						}
+					}
+				}
+			}
+
+			void 
+			_manager::uninitialize(void)
+			{
+				std::vector<glm::ivec3> coordinate;
+				std::vector<glm::ivec3>::iterator iter;
+
+				if(m_initialized) {
+					m_initialized = false;
+
+					if(persistent() && gaea::engine::world::manager::is_allocated()) {
+
+						gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+						if(world.is_initialized()) {
+							gaea::engine::region::manager &region = gaea::engine::region::manager::acquire();
+
+							coordinate = world.coordinates();
+							for(iter = coordinate.begin(); iter != coordinate.end(); ++iter) {
+								region.save(*iter, world.chunk(*iter));
+							}
+						}
+					}
+
+					clear();
+				}
+			}
+
+			void 
+			_manager::update(
+				__in const glm::dvec3 &position
+				)
+			{
+				glm::ivec3 focus;
+				size_t count = 0, current;
+
+				if(!m_initialized) {
+					THROW_GAEA_STREAM_EXCEPTION(GAEA_STREAM_EXCEPTION_UNINITIALIZED);
+				}
+
+				++m_tick;
+
+				if(gaea::engine::terrain::manager::is_allocated()) {
+
+					gaea::engine::terrain::manager &terrain = gaea::engine::terrain::manager::acquire();
+					if(terrain.is_initialized()) {
+						terrain.update(position);
+					}
+				}
+
+				focus = gaea::engine::chunk::coordinate(glm::ivec3(glm::floor(position)));
+				if(!m_focused || (focus != m_focus)) {
+					m_focus = focus;
+					m_focused = true;
+					touch();
+					sweep();
+				} else {
+					// chunks still in view stay recently seen while the focus holds still
+					touch();
+
+					if(m_evict.empty()) {
+						// an unmet cap leaves the footprint unchanged, and sweeping it again would pick nothing new
+						current = memory();
+						if((current > m_memory) && (current != m_footprint)) {
+							sweep();
+						}
+					}
+				}
+
+				for(; (count < STREAM_EVICT_MAX) && !m_evict.empty(); ++count) {
+					evict(m_evict.back());
+					m_evict.pop_back();
+				}
+			}
+		}
+	}
+}
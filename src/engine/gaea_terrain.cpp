@@ -0,0 +1,693 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include "../../include/gaea.h"
+#include "gaea_terrain_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace terrain {
+
+			#define TERRAIN_CAVE_DEPTH 4
+			#define TERRAIN_CAVE_OCTAVE 2
+			#define TERRAIN_CAVE_OFFSET 97.31f
+			#define TERRAIN_CAVE_SCALE (1.f / 48.f)
+			#define TERRAIN_CAVE_THRESHOLD 0.06f
+			#define TERRAIN_CLIMATE_OCTAVE 2
+			#define TERRAIN_CLIMATE_SCALE (1.f / 512.f)
+			#define TERRAIN_HEIGHT_AMPLITUDE 48.f
+			#define TERRAIN_HEIGHT_BASE 8.f
+			#define TERRAIN_HEIGHT_OCTAVE 5
+			#define TERRAIN_HEIGHT_SCALE (1.f / 256.f)
+			#define TERRAIN_MOUNTAIN_AMPLITUDE 240.f
+			#define TERRAIN_MOUNTAIN_HEIGHT 40
+			#define TERRAIN_MOUNTAIN_START 0.2f
+			#define TERRAIN_PLANE 0.37f
+			#define TERRAIN_SEED_CAVE 3
+			#define TERRAIN_SEED_HEIGHT 0
+			#define TERRAIN_SEED_HUMIDITY 2
+			#define TERRAIN_SEED_TEMPERATURE 1
+			#define TERRAIN_SNOW_HEIGHT 56
+			#define TERRAIN_SOIL_DEPTH 4
+
+			static_assert((CHUNK_WIDTH % NOISE_LANE) == 0,
+				"CHUNK_WIDTH must be a whole number of NOISE_LANE columns");
+
+			#define BIOME_STRING(_TYPE_) \
+				((_TYPE_) > BIOME_MAX ? STRING_UNKNOWN : \
+				STRING_CHECK(BIOME_STR[_TYPE_]))
+
+			static const std::string BIOME_STR[] = {
+				"OCEAN", "BEACH", "PLAINS", "FOREST", "DESERT", "MOUNTAIN", "SNOW",
+				};
+
+			static const gaea::block_t BIOME_SUBSURFACE[] = {
+				BLOCK_SAND, BLOCK_SAND, BLOCK_DIRT, BLOCK_DIRT, BLOCK_SAND, BLOCK_STONE, BLOCK_DIRT,
+				};
+
+			static const gaea::block_t BIOME_SURFACE[] = {
+				BLOCK_SAND, BLOCK_SAND, BLOCK_GRASS, BLOCK_GRASS, BLOCK_SAND, BLOCK_STONE, BLOCK_SNOW,
+				};
+
+			static inline uint64_t 
+			derive(
+				__in uint64_t seed,
+				__in uint64_t index
+				)
+			{
+				uint64_t result = (seed + ((index + 1) * 0x9e3779b97f4a7c15ULL));
+
+				result = ((result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ULL);
+				result = ((result ^ (result >> 27)) * 0x94d049bb133111ebULL);
+
+				return (result ^ (result >> 31));
+			}
+
+			static inline bool 
+			persistent(void)
+			{
+				bool result = false;
+
+				if(gaea::engine::region::manager::is_allocated()) {
+					result = gaea::engine::region::manager::acquire().is_initialized();
+				}
+
+				return result;
+			}
+
+			_base::_base(
+				__in_opt uint64_t seed
+				) :
+					m_cave(derive(seed, TERRAIN_SEED_CAVE)),
+					m_height(derive(seed, TERRAIN_SEED_HEIGHT)),
+					m_humidity(derive(seed, TERRAIN_SEED_HUMIDITY)),
+					m_seed(seed),
+					m_temperature(derive(seed, TERRAIN_SEED_TEMPERATURE))
+			{
+				return;
+			}
+
+			_base::_base(
+				__in const _base &other
+				) :
+					m_cave(other.m_cave),
+					m_height(other.m_height),
+					m_humidity(other.m_humidity),
+					m_seed(other.m_seed),
+					m_temperature(other.m_temperature)
+			{
+				return;
+			}
+
+			_base::~_base(void)
+			{
+				return;
+			}
+
+			_base & 
+			_base::operator=(
+				__in const _base &other
+				)
+			{
+
+				if(this != &other) {
+					m_cave = other.m_cave;
+					m_height = other.m_height;
+					m_humidity = other.m_humidity;
+					m_seed = other.m_seed;
+					m_temperature = other.m_temperature;
+				}
+
+				return *this;
+			}
+
+			std::string 
+			_base::as_string(
+				__in const _base &object,
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << "SEED=" << SCALAR_AS_HEX(uint64_t, object.m_seed);
+
+				return result.str();
+			}
+
+			gaea::biome_t 
+			_base::biome(
+				__in int32_t x,
+				__in int32_t z
+				) const
+			{
+				gaea::biome_t result[NOISE_LANE];
+				int32_t height[NOISE_LANE], position_x[NOISE_LANE], position_z[NOISE_LANE];
+
+				std::fill_n(position_x, NOISE_LANE, x);
+				std::fill_n(position_z, NOISE_LANE, z);
+				column(position_x, position_z, height, result);
+
+				return result[0];
+			}
+
+			void 
+			_base::column(
+				__in const int32_t x[NOISE_LANE],
+				__in const int32_t z[NOISE_LANE],
+				__out int32_t height[NOISE_LANE],
+				__out gaea::biome_t biome[NOISE_LANE]
+				) const
+			{
+				size_t lane = 0;
+				float elevation[NOISE_LANE], humidity[NOISE_LANE], plane[NOISE_LANE], sample_x[NOISE_LANE],
+					sample_z[NOISE_LANE], temperature[NOISE_LANE], value;
+
+				for(; lane < NOISE_LANE; ++lane) {
+					plane[lane] = TERRAIN_PLANE;
+					sample_x[lane] = (x[lane] * TERRAIN_HEIGHT_SCALE);
+					sample_z[lane] = (z[lane] * TERRAIN_HEIGHT_SCALE);
+				}
+
+				m_height.fbm(sample_x, plane, sample_z, elevation, TERRAIN_HEIGHT_OCTAVE);
+
+				for(lane = 0; lane < NOISE_LANE; ++lane) {
+					sample_x[lane] = (x[lane] * TERRAIN_CLIMATE_SCALE);
+					sample_z[lane] = (z[lane] * TERRAIN_CLIMATE_SCALE);
+				}
+
+				m_temperature.fbm(sample_x, plane, sample_z, temperature, TERRAIN_CLIMATE_OCTAVE);
+				m_humidity.fbm(sample_x, plane, sample_z, humidity, TERRAIN_CLIMATE_OCTAVE);
+
+				for(lane = 0; lane < NOISE_LANE; ++lane) {
+					value = (TERRAIN_HEIGHT_BASE + (elevation[lane] * TERRAIN_HEIGHT_AMPLITUDE));
+
+					if(elevation[lane] > TERRAIN_MOUNTAIN_START) {
+						value += ((elevation[lane] - TERRAIN_MOUNTAIN_START) * (elevation[lane] - TERRAIN_MOUNTAIN_START)
+							* TERRAIN_MOUNTAIN_AMPLITUDE);
+					}
+
+					height[lane] = (TERRAIN_SEA_LEVEL + (int32_t) std::floor(value));
+					temperature[lane] -= (std::max(0, height[lane] - TERRAIN_MOUNTAIN_HEIGHT) / 64.f);
+
+					if(height[lane] < (TERRAIN_SEA_LEVEL - 1)) {
+						biome[lane] = BIOME_OCEAN;
+					} else if(height[lane] <= (TERRAIN_SEA_LEVEL + 1)) {
+						biome[lane] = BIOME_BEACH;
+					} else if((height[lane] > TERRAIN_SNOW_HEIGHT) || (temperature[lane] < -0.3f)) {
+						biome[lane] = BIOME_SNOW;
+					} else if(height[lane] > TERRAIN_MOUNTAIN_HEIGHT) {
+						biome[lane] = BIOME_MOUNTAIN;
+					} else if((temperature[lane] > 0.2f) && (humidity[lane] < 0.f)) {
+						biome[lane] = BIOME_DESERT;
+					} else if(humidity[lane] > 0.1f) {
+						biome[lane] = BIOME_FOREST;
+					} else {
+						biome[lane] = BIOME_PLAINS;
+					}
+				}
+			}
+
+			void 
+			_base::generate(
+				__in const glm::ivec3 &coordinate,
+				__out gaea::engine::chunk::base &chunk
+				) const
+			{
+				gaea::block_t block;
+				bool carve[NOISE_LANE], underground;
+				glm::ivec3 origin = (coordinate * CHUNK_WIDTH);
+				gaea::biome_t biome[CHUNK_AREA];
+				float cave[NOISE_LANE], offset[NOISE_LANE], sample_x[NOISE_LANE], sample_y[NOISE_LANE],
+					sample_z[NOISE_LANE], tunnel[NOISE_LANE];
+				int32_t height[CHUNK_AREA], depth, lane, maximum = TERRAIN_SEA_LEVEL,
+					position_x[NOISE_LANE], position_z[NOISE_LANE], top, x, y, z;
+
+				chunk.clear();
+
+				for(z = 0; z < CHUNK_WIDTH; ++z) {
+
+					for(x = 0; x < CHUNK_WIDTH; x += NOISE_LANE) {
+
+						for(lane = 0; lane < NOISE_LANE; ++lane) {
+							position_x[lane] = (origin.x + x + lane);
+							position_z[lane] = (origin.z + z);
+						}
+
+						column(position_x, position_z, &height[(z * CHUNK_WIDTH) + x],
+							&biome[(z * CHUNK_WIDTH) + x]);
+
+						for(lane = 0; lane < NOISE_LANE; ++lane) {
+							maximum = std::max(maximum, height[(z * CHUNK_WIDTH) + x + lane]);
+						}
+					}
+				}
+
+				if(origin.y > maximum) {
+					return;
+				}
+
+				top = std::min(CHUNK_WIDTH, (maximum - origin.y) + 1);
+
+				for(y = 0; y < top; ++y) {
+
+					for(z = 0; z < CHUNK_WIDTH; ++z) {
+
+						for(x = 0; x < CHUNK_WIDTH; x += NOISE_LANE) {
+							underground = false;
+
+							for(lane = 0; lane < NOISE_LANE; ++lane) {
+								carve[lane] = false;
+								underground |= ((origin.y + y) < (height[(z * CHUNK_WIDTH) + x + lane]
+									- TERRAIN_CAVE_DEPTH));
+								offset[lane] = (((origin.x + x + lane) * TERRAIN_CAVE_SCALE) + TERRAIN_CAVE_OFFSET);
+								sample_x[lane] = ((origin.x + x + lane) * TERRAIN_CAVE_SCALE);
+								sample_y[lane] = ((origin.y + y) * TERRAIN_CAVE_SCALE);
+								sample_z[lane] = ((origin.z + z) * TERRAIN_CAVE_SCALE);
+							}
+
+							if(underground) {
+								m_cave.fbm(sample_x, sample_y, sample_z, cave, TERRAIN_CAVE_OCTAVE);
+								m_cave.fbm(offset, sample_y, sample_z, tunnel, TERRAIN_CAVE_OCTAVE);
+
+								for(lane = 0; lane < NOISE_LANE; ++lane) {
+									carve[lane] = ((std::fabs(cave[lane]) < TERRAIN_CAVE_THRESHOLD)
+										&& (std::fabs(tunnel[lane]) < TERRAIN_CAVE_THRESHOLD));
+								}
+							}
+
+							for(lane = 0; lane < NOISE_LANE; ++lane) {
+								depth = (height[(z * CHUNK_WIDTH) + x + lane] - (origin.y + y));
+
+								if(depth < 0) {
+									block = (((origin.y + y) <= TERRAIN_SEA_LEVEL) ? BLOCK_WATER : BLOCK_AIR);
+								} else if(carve[lane] && (depth > TERRAIN_CAVE_DEPTH)) {
+									block = BLOCK_AIR;
+								} else if(!depth) {
+									block = BIOME_SURFACE[biome[(z * CHUNK_WIDTH) + x + lane]];
+								} else if(depth < TERRAIN_SOIL_DEPTH) {
+									block = BIOME_SUBSURFACE[biome[(z * CHUNK_WIDTH) + x + lane]];
+								} else {
+									block = BLOCK_STONE;
+								}
+
+								if(block != BLOCK_AIR) {
+									chunk.set(x + lane, y, z, block);
+								}
+							}
+						}
+					}
+				}
+
+				chunk.compact();
+			}
+
+			int32_t 
+			_base::height(
+				__in int32_t x,
+				__in int32_t z
+				) const
+			{
+				gaea::biome_t biome[NOISE_LANE];
+				int32_t result[NOISE_LANE], position_x[NOISE_LANE], position_z[NOISE_LANE];
+
+				std::fill_n(position_x, NOISE_LANE, x);
+				std::fill_n(position_z, NOISE_LANE, z);
+				column(position_x, position_z, result, biome);
+
+				return result[0];
+			}
+
+			uint64_t 
+			_base::seed(void) const
+			{
+				return m_seed;
+			}
+
+			std::string 
+			_base::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::engine::terrain::base::as_string(*this, verbose);
+			}
+
+			_manager::_distance_t::_distance_t(
+				__in const glm::ivec3 &focus
+				) :
+					m_focus(focus)
+			{
+				return;
+			}
+
+			bool 
+			_manager::_distance_t::operator()(
+				__in const glm::ivec3 &left,
+				__in const glm::ivec3 &right
+				) const
+			{
+				glm::ivec3 delta_left = (left - m_focus), delta_right = (right - m_focus);
+
+				return (glm::dot(delta_left, delta_left) > glm::dot(delta_right, delta_right));
+			}
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_focused(false),
+				m_generated(0),
+				m_initialized(false),
+				m_radius(TERRAIN_RADIUS_INIT)
+			{
+				std::atexit(gaea::engine::terrain::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				uninitialize();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::terrain::manager::m_instance) {
+					delete gaea::engine::terrain::manager::m_instance;
+					gaea::engine::terrain::manager::m_instance = nullptr;
+				}
+			}
+
+			void 
+			_manager::_thread(void)
+			{
+
+				if(gaea::engine::terrain::manager::is_allocated()) {
+
+					gaea::engine::terrain::manager &instance = gaea::engine::terrain::manager::acquire();
+					for(;;) {
+						glm::ivec3 coordinate;
+						gaea::engine::chunk::base chunk;
+
+						std::unique_lock<std::mutex> lock(instance.m_lock);
+						instance.m_condition.wait(lock, [&instance] {
+								return (!instance.m_initialized || !instance.m_job.empty());
+							});
+
+						if(!instance.m_initialized) {
+							break;
+						}
+
+						std::pop_heap(instance.m_job.begin(), instance.m_job.end(), distance_t(instance.m_focus));
+						coordinate = instance.m_job.back();
+						instance.m_job.pop_back();
+						lock.unlock();
+
+						instance.m_generator.generate(coordinate, chunk);
+
+						lock.lock();
+						instance.m_result.push_back(std::pair<glm::ivec3, gaea::engine::chunk::base>(
+							coordinate, chunk));
+						++instance.m_generated;
+					}
+				}
+			}
+
+			_manager & 
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::terrain::manager::m_instance) {
+
+					gaea::engine::terrain::manager::m_instance = new gaea::engine::terrain::manager;
+					if(!gaea::engine::terrain::manager::m_instance) {
+						THROW_GAEA_TERRAIN_EXCEPTION(GAEA_TERRAIN_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::terrain::manager::m_instance;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+				m_focused = false;
+				m_generated = 0;
+				m_job.clear();
+				m_request.clear();
+				m_result.clear();
+			}
+
+			size_t 
+			_manager::generated(void)
+			{
+				return m_generated;
+			}
+
+			void 
+			_manager::initialize(
+				__in_opt uint64_t seed,
+				__in_opt size_t workers,
+				__in_opt int32_t radius
+				)
+			{
+				size_t iter = 0;
+
+				if(m_initialized) {
+					THROW_GAEA_TERRAIN_EXCEPTION(GAEA_TERRAIN_EXCEPTION_INITIALIZED);
+				}
+
+				if(!workers || (radius < 0)) {
+					THROW_GAEA_TERRAIN_EXCEPTION_FORMAT(GAEA_TERRAIN_EXCEPTION_INVALID,
+						"Workers=%u, Radius=%i", workers, radius);
+				}
+
+				m_generator = gaea::engine::terrain::base(seed);
+				m_radius = radius;
+				m_initialized = true;
+
+				for(; iter < workers; ++iter) {
+					m_worker.push_back(std::thread(gaea::engine::terrain::manager::_thread));
+				}
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::terrain::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_initialized(void)
+			{
+				return m_initialized;
+			}
+
+			size_t 
+			_manager::pending(void)
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+
+				return (m_request.size());
+			}
+
+			int32_t 
+			_manager::radius(void)
+			{
+				return m_radius;
+			}
+
+			void 
+			_manager::schedule(void)
+			{
+				glm::ivec3 coordinate;
+				bool persist = persistent();
+				int32_t radius = (m_radius * m_radius), x, y, z;
+				std::vector<glm::ivec3>::iterator iter;
+				gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+
+				for(iter = m_job.begin(); iter != m_job.end();) {
+					x = (iter->x - m_focus.x);
+					z = (iter->z - m_focus.z);
+
+					if(((x * x) + (z * z)) > radius) {
+						m_request.erase(*iter);
+						iter = m_job.erase(iter);
+					} else {
+						++iter;
+					}
+				}
+
+				for(z = -m_radius; z <= m_radius; ++z) {
+
+					for(x = -m_radius; x <= m_radius; ++x) {
+
+						if(((x * x) + (z * z)) > radius) {
+							continue;
+						}
+
+						for(y = TERRAIN_CHUNK_BOTTOM; y <= TERRAIN_CHUNK_TOP; ++y) {
+							coordinate = glm::ivec3(m_focus.x + x, y, m_focus.z + z);
+
+							if((m_request.find(coordinate) == m_request.end()) && !world.contains(coordinate)) {
+								m_request.insert(coordinate);
+
+								if(persist) {
+									gaea::engine::region::manager::acquire().load(coordinate);
+								} else {
+									m_job.push_back(coordinate);
+								}
+							}
+						}
+					}
+				}
+
+				std::make_heap(m_job.begin(), m_job.end(), distance_t(m_focus));
+				m_condition.notify_all();
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << GAEA_TERRAIN_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
+
+				if(m_initialized) {
+					std::lock_guard<std::mutex> lock(m_lock);
+
+					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+						<< ", " << m_generator.to_string(verbose)
+						<< ", WORKERS=" << m_worker.size()
+						<< ", RADIUS=" << m_radius
+						<< ", FOCUS={" << m_focus.x << ", " << m_focus.y << ", " << m_focus.z << "}"
+						<< ", QUEUED=" << m_job.size()
+						<< ", PENDING=" << m_request.size()
+						<< ", GENERATED=" << m_generated;
+				}
+
+				return result.str();
+			}
+
+			void 
+			_manager::uninitialize(void)
+			{
+				std::vector<std::thread>::iterator iter;
+
+				if(m_initialized) {
+
+					m_lock.lock();
+					m_initialized = false;
+					m_condition.notify_all();
+					m_lock.unlock();
+
+					for(iter = m_worker.begin(); iter != m_worker.end(); ++iter) {
+
+						if(iter->joinable()) {
+							iter->join();
+						}
+					}
+
+					m_worker.clear();
+					clear();
+				}
+			}
+
+			void 
+			_manager::update(
+				__in const glm::dvec3 &position,
+				__in_opt size_t commit
+				)
+			{
+				glm::ivec3 focus;
+				int32_t x, z;
+				std::vector<gaea::engine::region::result_t> loaded;
+				std::vector<gaea::engine::region::result_t>::iterator loaded_iter;
+				std::vector<std::pair<glm::ivec3, gaea::engine::chunk::base>> result;
+				std::vector<std::pair<glm::ivec3, gaea::engine::chunk::base>>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_TERRAIN_EXCEPTION(GAEA_TERRAIN_EXCEPTION_UNINITIALIZED);
+				}
+
+				focus = gaea::engine::chunk::coordinate(glm::ivec3(glm::floor(position)));
+
+				if(persistent()) {
+					gaea::engine::region::manager::acquire().collect(loaded);
+				}
+
+				m_lock.lock();
+
+				if(!m_focused || (focus != m_focus)) {
+					m_focus = focus;
+					m_focused = true;
+					schedule();
+				}
+
+				if(!loaded.empty()) {
+
+					for(loaded_iter = loaded.begin(); loaded_iter != loaded.end(); ++loaded_iter) {
+						x = (loaded_iter->coordinate.x - m_focus.x);
+						z = (loaded_iter->coordinate.z - m_focus.z);
+
+						if(((x * x) + (z * z)) > (m_radius * m_radius)) {
+							m_request.erase(loaded_iter->coordinate);
+						} else if(loaded_iter->found) {
+							m_result.push_back(std::pair<glm::ivec3, gaea::engine::chunk::base>(
+								loaded_iter->coordinate, loaded_iter->chunk));
+						} else {
+							m_job.push_back(loaded_iter->coordinate);
+							std::push_heap(m_job.begin(), m_job.end(), distance_t(m_focus));
+						}
+					}
+
+					m_condition.notify_all();
+				}
+
+				result.swap(m_result);
+
+				if(result.size() > commit) {
+					m_result.assign(result.begin() + commit, result.end());
+					result.resize(commit);
+				}
+
+				m_lock.unlock();
+
+				if(!result.empty()) {
+					gaea::engine::world::manager &world = gaea::engine::world::manager::acquire();
+
+					for(iter = result.begin(); iter != result.end(); ++iter) {
+						world.set_chunk(iter->first, iter->second);
+					}
+
+					m_lock.lock();
+
+					for(iter = result.begin(); iter != result.end(); ++iter) {
+						m_request.erase(iter->first);
+					}
+
+					m_lock.unlock();
+				}
+			}
+		}
+	}
+}
@@ -158,6 +158,7 @@ namespace gaea {
 				m_initialized(false),
 				m_next(UID_INIT)
 			{
+				gaea::engine::pool::manager::acquire();
 				std::atexit(gaea::engine::uid::manager::_delete);
 			}
 
@@ -218,7 +219,7 @@ namespace gaea {
 				)
 			{
 				size_t result = 0;
-				std::map<gaea::uid_t, size_t>::iterator iter;
+				gaea::engine::pool::map<gaea::uid_t, size_t>::iterator iter;
 
 				iter = find(id);
 				if(iter->second <= REFERENCE_INIT) {
@@ -236,12 +237,12 @@ namespace gaea {
 				return result;
 			}
 
-			std::map<gaea::uid_t, size_t>::iterator 
+			gaea::engine::pool::map<gaea::uid_t, size_t>::iterator 
 			_manager::find(
 				__in gaea::uid_t &id
 				)
 			{
-				std::map<gaea::uid_t, size_t>::iterator result;
+				gaea::engine::pool::map<gaea::uid_t, size_t>::iterator result;
 
 				if(!m_initialized) {
 					THROW_GAEA_UID_EXCEPTION(GAEA_UID_EXCEPTION_UNINITIALIZED);
@@ -260,7 +261,7 @@ namespace gaea {
 				__out gaea::uid_t &id
 				)
 			{
-				std::set<gaea::uid_t>::iterator iter;
+				gaea::engine::pool::set<gaea::uid_t>::iterator iter;
 
 				if(!m_surplus.empty()) {
 					iter = m_surplus.begin();
@@ -331,7 +332,7 @@ namespace gaea {
 			{
 				size_t count = 0;
 				std::stringstream result;
-				std::map<gaea::uid_t, size_t>::iterator iter;
+				gaea::engine::pool::map<gaea::uid_t, size_t>::iterator iter;
 
 				result << GAEA_UID_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
 
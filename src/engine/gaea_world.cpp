@@ -0,0 +1,417 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/gaea.h"
+#include "gaea_world_type.h"
+
+namespace gaea {
+
+	namespace engine {
+
+		namespace world {
+
+			_manager *_manager::m_instance = nullptr;
+
+			_manager::_manager(void) :
+				m_initialized(false)
+			{
+				std::atexit(gaea::engine::world::manager::_delete);
+			}
+
+			_manager::~_manager(void)
+			{
+				uninitialize();
+			}
+
+			void 
+			_manager::_delete(void)
+			{
+
+				if(gaea::engine::world::manager::m_instance) {
+					delete gaea::engine::world::manager::m_instance;
+					gaea::engine::world::manager::m_instance = nullptr;
+				}
+			}
+
+			_manager &
+			_manager::acquire(void)
+			{
+
+				if(!gaea::engine::world::manager::m_instance) {
+
+					gaea::engine::world::manager::m_instance = new gaea::engine::world::manager;
+					if(!gaea::engine::world::manager::m_instance) {
+						THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_ALLOCATED);
+					}
+				}
+
+				return *gaea::engine::world::manager::m_instance;
+			}
+
+			gaea::block_t 
+			_manager::block(
+				__in const glm::ivec3 &position
+				)
+			{
+				gaea::block_t result = BLOCK_AIR;
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+				std::unordered_map<glm::ivec3, gaea::engine::chunk::base,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_UNINITIALIZED);
+				}
+
+				iter = m_entry.find(gaea::engine::chunk::coordinate(position));
+				if(iter != m_entry.end()) {
+					result = iter->second.get(gaea::engine::chunk::local(position));
+				}
+
+				return result;
+			}
+
+			gaea::engine::chunk::base &
+			_manager::chunk(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+				std::unordered_map<glm::ivec3, gaea::engine::chunk::base,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_UNINITIALIZED);
+				}
+
+				iter = m_entry.find(coordinate);
+				if(iter == m_entry.end()) {
+					THROW_GAEA_WORLD_EXCEPTION_FORMAT(GAEA_WORLD_EXCEPTION_NOT_FOUND,
+						"{%i, %i, %i}", coordinate.x, coordinate.y, coordinate.z);
+				}
+
+				return iter->second;
+			}
+
+			void 
+			_manager::clear(void)
+			{
+				m_entry.clear();
+			}
+
+			bool 
+			_manager::contains(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				if(!m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_UNINITIALIZED);
+				}
+
+				return (m_entry.find(coordinate) != m_entry.end());
+			}
+
+			std::vector<glm::ivec3> 
+			_manager::coordinates(void)
+			{
+				std::vector<glm::ivec3> result;
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+				std::unordered_map<glm::ivec3, gaea::engine::chunk::base,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_UNINITIALIZED);
+				}
+
+				result.reserve(m_entry.size());
+
+				for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
+					result.push_back(iter->first);
+				}
+
+				return result;
+			}
+
+			std::vector<glm::ivec3> 
+			_manager::dirty(void)
+			{
+				std::vector<glm::ivec3> result;
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+				std::unordered_map<glm::ivec3, gaea::engine::chunk::base,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_UNINITIALIZED);
+				}
+
+				for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
+
+					if(iter->second.is_dirty()) {
+						result.push_back(iter->first);
+					}
+				}
+
+				return result;
+			}
+
+			void 
+			_manager::erase(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+				std::unordered_map<glm::ivec3, gaea::engine::chunk::base,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_UNINITIALIZED);
+				}
+
+				iter = m_entry.find(coordinate);
+				if(iter == m_entry.end()) {
+					THROW_GAEA_WORLD_EXCEPTION_FORMAT(GAEA_WORLD_EXCEPTION_NOT_FOUND,
+						"{%i, %i, %i}", coordinate.x, coordinate.y, coordinate.z);
+				}
+
+				m_entry.erase(iter);
+			}
+
+			gaea::engine::chunk::base * 
+			_manager::find(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				gaea::engine::chunk::base *result = nullptr;
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+				std::unordered_map<glm::ivec3, gaea::engine::chunk::base,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_UNINITIALIZED);
+				}
+
+				iter = m_entry.find(coordinate);
+				if(iter != m_entry.end()) {
+					result = &iter->second;
+				}
+
+				return result;
+			}
+
+			void 
+			_manager::initialize(void)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				if(m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_INITIALIZED);
+				}
+
+				m_initialized = true;
+			}
+
+			gaea::engine::chunk::base &
+			_manager::insert(
+				__in const glm::ivec3 &coordinate,
+				__in_opt gaea::block_t block
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+				std::unordered_map<glm::ivec3, gaea::engine::chunk::base,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				if(!m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_UNINITIALIZED);
+				}
+
+				iter = m_entry.find(coordinate);
+				if(iter == m_entry.end()) {
+					iter = m_entry.insert(std::pair<glm::ivec3, gaea::engine::chunk::base>(coordinate,
+						gaea::engine::chunk::base(block))).first;
+				}
+
+				return iter->second;
+			}
+
+			bool 
+			_manager::is_allocated(void)
+			{
+				return (gaea::engine::world::manager::m_instance != nullptr);
+			}
+
+			bool 
+			_manager::is_initialized(void)
+			{
+				return m_initialized;
+			}
+
+			std::recursive_mutex &
+			_manager::lock(void)
+			{
+				return m_lock;
+			}
+
+			size_t 
+			_manager::memory(void)
+			{
+				size_t result = 0;
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+				std::unordered_map<glm::ivec3, gaea::engine::chunk::base,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				for(iter = m_entry.begin(); iter != m_entry.end(); ++iter) {
+					result += iter->second.memory();
+				}
+
+				return result;
+			}
+
+			void 
+			_manager::set_block(
+				__in const glm::ivec3 &position,
+				__in gaea::block_t block
+				)
+			{
+				glm::uvec3 local;
+				glm::ivec3 coordinate;
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				if(!m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_UNINITIALIZED);
+				}
+
+				local = gaea::engine::chunk::local(position);
+				coordinate = gaea::engine::chunk::coordinate(position);
+
+				gaea::engine::chunk::base &entry = insert(coordinate);
+				if(entry.get(local) == block) {
+					return;
+				}
+
+				entry.set(local, block);
+
+				if(!local.x) {
+					set_dirty(coordinate - glm::ivec3(1, 0, 0));
+				} else if(local.x == (CHUNK_WIDTH - 1)) {
+					set_dirty(coordinate + glm::ivec3(1, 0, 0));
+				}
+
+				if(!local.y) {
+					set_dirty(coordinate - glm::ivec3(0, 1, 0));
+				} else if(local.y == (CHUNK_WIDTH - 1)) {
+					set_dirty(coordinate + glm::ivec3(0, 1, 0));
+				}
+
+				if(!local.z) {
+					set_dirty(coordinate - glm::ivec3(0, 0, 1));
+				} else if(local.z == (CHUNK_WIDTH - 1)) {
+					set_dirty(coordinate + glm::ivec3(0, 0, 1));
+				}
+			}
+
+			void 
+			_manager::set_chunk(
+				__in const glm::ivec3 &coordinate,
+				__in const gaea::engine::chunk::base &chunk
+				)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				if(!m_initialized) {
+					THROW_GAEA_WORLD_EXCEPTION(GAEA_WORLD_EXCEPTION_UNINITIALIZED);
+				}
+
+				gaea::engine::chunk::base &entry = insert(coordinate);
+				entry = chunk;
+				entry.set_dirty();
+				set_dirty(coordinate - glm::ivec3(1, 0, 0));
+				set_dirty(coordinate + glm::ivec3(1, 0, 0));
+				set_dirty(coordinate - glm::ivec3(0, 1, 0));
+				set_dirty(coordinate + glm::ivec3(0, 1, 0));
+				set_dirty(coordinate - glm::ivec3(0, 0, 1));
+				set_dirty(coordinate + glm::ivec3(0, 0, 1));
+			}
+
+			void 
+			_manager::set_dirty(
+				__in const glm::ivec3 &coordinate
+				)
+			{
+				std::unordered_map<glm::ivec3, gaea::engine::chunk::base,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				iter = m_entry.find(coordinate);
+				if(iter != m_entry.end()) {
+					iter->second.set_dirty();
+				}
+			}
+
+			size_t 
+			_manager::size(void)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				return m_entry.size();
+			}
+
+			std::string 
+			_manager::to_string(
+				__in_opt bool verbose
+				)
+			{
+				size_t count = 0;
+				std::stringstream result;
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+				std::unordered_map<glm::ivec3, gaea::engine::chunk::base,
+					gaea::engine::chunk::hash_t>::iterator iter;
+
+				result << GAEA_WORLD_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
+
+				if(m_initialized) {
+					result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
+						<< ", CHUNKS=" << m_entry.size()
+						<< ", MEM=" << (memory() / BYTES_PER_KBYTE) << " KB";
+
+					if(verbose) {
+
+						for(iter = m_entry.begin(); iter != m_entry.end(); ++count, ++iter) {
+							result << std::endl << "[" << count << "] {" << iter->first.x << ", "
+								<< iter->first.y << ", " << iter->first.z << "} "
+								<< iter->second.to_string(verbose);
+						}
+					}
+				}
+
+				return result.str();
+			}
+
+			void 
+			_manager::uninitialize(void)
+			{
+				std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+				if(m_initialized) {
+					m_initialized = false;
+					clear();
+				}
+			}
+		}
+	}
+}
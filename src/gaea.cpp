@@ -17,13 +17,14 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include "../include/gaea.h"
 #include "gaea_type.h"
 
 namespace gaea {
 
-	#define DELTA_DIV 1000
-	#define DELTA_MIN 1
 	#define GL_ATTRIB_ACCELERATED 1
 	#define GL_ATTRIB_COLOR 8
 	#define GL_ATTRIB_DEPTH 24
@@ -36,9 +37,51 @@ namespace gaea {
 	#define GL_CHAN_MAX 255
 	#define GL_CHAN_RED (52 / (GLfloat) GL_CHAN_MAX)
 	#define GL_CLEAR_FLAGS (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT)
+	#define HEADLESS_EXTENSION_PLATFORM "EGL_MESA_platform_surfaceless"
+	#define HEADLESS_EXTENSION_SURFACELESS "EGL_KHR_surfaceless_context"
+	#define HEADLESS_SURFACE_DIMENSION 1
+	#define PACING_SPIN (2 * TIME_NS_PER_MS)
+	#define PROFILE_PHASE_ENTITY "entity"
+	#define PROFILE_PHASE_EVENT "event"
+	#define PROFILE_PHASE_FRAME "frame"
+	#define PROFILE_PHASE_MESH "mesh"
+	#define PROFILE_PHASE_OCCLUSION "occlusion"
+	#define PROFILE_PHASE_RENDER "render"
+	#define PROFILE_PHASE_STREAM "stream"
+	#define PROFILE_PHASE_SWAP "swap"
+	#define PROFILE_PHASE_UPDATE "update"
 	#define SDL_ATTRIB_VSYNC 1
-	#define SDL_INIT_FLAGS (SDL_INIT_AUDIO | SDL_INIT_TIMER | SDL_INIT_VIDEO)
+	#define SDL_ATTRIB_VSYNC_ADAPTIVE -1
+	#define SDL_ATTRIB_VSYNC_NONE 0
+	#define SDL_INIT_FLAGS (SDL_INIT_AUDIO | SDL_INIT_GAMECONTROLLER | SDL_INIT_TIMER | SDL_INIT_VIDEO)
+	#define SDL_INIT_HEADLESS_FLAGS (SDL_INIT_EVENTS | SDL_INIT_TIMER)
 	#define SDL_WINDOW_FLAGS (SDL_WINDOW_INPUT_GRABBED | SDL_WINDOW_OPENGL)
+	#define TICK_FRAME_MAX (TIME_NS_PER_SEC / 4)
+	#define TICK_STEP_MAX 8
+	#define TIME_NS_PER_MS 1000000ULL
+	#define TIME_NS_PER_SEC 1000000000ULL
+
+	static const EGLint HEADLESS_CONFIG[] = {
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RED_SIZE, GL_ATTRIB_COLOR,
+		EGL_GREEN_SIZE, GL_ATTRIB_COLOR,
+		EGL_BLUE_SIZE, GL_ATTRIB_COLOR,
+		EGL_DEPTH_SIZE, GL_ATTRIB_DEPTH,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_NONE,
+		};
+
+	static const EGLint HEADLESS_CONTEXT[] = {
+		EGL_CONTEXT_MAJOR_VERSION, GL_ATTRIB_MAJOR,
+		EGL_CONTEXT_MINOR_VERSION, GL_ATTRIB_MINOR,
+		EGL_NONE,
+		};
+
+	static const EGLint HEADLESS_SURFACE[] = {
+		EGL_WIDTH, HEADLESS_SURFACE_DIMENSION,
+		EGL_HEIGHT, HEADLESS_SURFACE_DIMENSION,
+		EGL_NONE,
+		};
 
 	std::string 
 	version(
@@ -64,16 +107,42 @@ namespace gaea {
 	_manager *_manager::m_instance = nullptr;
 
 	_manager::_manager(void) :
+		m_action_manager(gaea::engine::action::manager::acquire()),
+		m_archive_manager(gaea::engine::archive::manager::acquire()),
+		m_arena_manager(gaea::engine::arena::manager::acquire()),
 		m_camera_manager(gaea::engine::camera::manager::acquire()),
+		m_context(EGL_NO_CONTEXT),
+		m_display(EGL_NO_DISPLAY),
 		m_entity_manager(gaea::engine::entity::manager::acquire()),
 		m_event_manager(gaea::engine::event::manager::acquire()),
+		m_frame_count(0),
+		m_framebuffer(GL_HANDLE_INVALID),
+		m_framebuffer_color(GL_HANDLE_INVALID),
+		m_framebuffer_depth(GL_HANDLE_INVALID),
 		m_gfx_manager(gaea::graphics::manager::acquire()),
+		m_headless(HEADLESS_INIT),
+		m_headless_frames(HEADLESS_FRAMES_INIT),
 		m_initialized(false),
+		m_mesh_manager(gaea::engine::mesh::manager::acquire()),
+		m_occlusion_manager(gaea::engine::occlusion::manager::acquire()),
+		m_pacing(PACING_INIT),
+		m_pacing_rate(PACING_RATE_INIT),
+		m_path_step(PATH_STEP_INIT),
+		m_pipelined(PIPELINE_INIT),
+		m_profile_manager(gaea::engine::profile::manager::acquire()),
+		m_region_manager(gaea::engine::region::manager::acquire()),
+		m_simulating(false),
 		m_started(false),
+		m_stream_manager(gaea::engine::stream::manager::acquire()),
+		m_surface(EGL_NO_SURFACE),
+		m_terrain_manager(gaea::engine::terrain::manager::acquire()),
 		m_tick(TICK_INVALID),
+		m_tick_rate(TICK_RATE_INIT),
+		m_time(0),
 		m_uid_manager(gaea::engine::uid::manager::acquire()),
 		m_window(nullptr),
-		m_window_context(nullptr)
+		m_window_context(nullptr),
+		m_world_manager(gaea::engine::world::manager::acquire())
 	{
 		std::atexit(gaea::manager::_delete);
 	}
@@ -93,6 +162,49 @@ namespace gaea {
 		}
 	}
 
+	void 
+	_manager::_input(
+		__in uint32_t specifier,
+		__in void *context,
+		__in size_t length
+		)
+	{
+
+		if(gaea::manager::m_instance) {
+			gaea::manager::m_instance->dispatch(specifier, context, length);
+		}
+	}
+
+	void 
+	_manager::_thread(void)
+	{
+		uint64_t deadline, now;
+
+		if(gaea::manager::is_allocated()) {
+
+			gaea::manager &instance = gaea::manager::acquire();
+			for(;;) {
+
+				std::unique_lock<std::mutex> lock(instance.m_lock);
+				now = gaea::engine::profile::now();
+				deadline = (instance.m_time + (TIME_NS_PER_SEC / instance.m_tick_rate));
+
+				if(deadline > now) {
+					instance.m_condition.wait_for(lock, std::chrono::nanoseconds(deadline - now), [&instance] {
+							return !instance.m_simulating;
+						});
+				}
+
+				if(!instance.m_simulating) {
+					break;
+				}
+
+				lock.unlock();
+				instance.simulate(gaea::engine::profile::now());
+			}
+		}
+	}
+
 	_manager &
 	_manager::acquire(void)
 	{
@@ -108,6 +220,72 @@ namespace gaea {
 		return *gaea::manager::m_instance;
 	}
 
+	void 
+	_manager::capture(
+		__in uint64_t step
+		)
+	{
+		gaea::engine::frame::packet_t &packet = m_frame.back();
+		gaea::engine::camera::base &camera = m_camera_manager.entry();
+
+		packet.camera.id = camera.id();
+		packet.camera.type = ENTITY_CAMERA;
+		camera.capture(packet.camera.previous, packet.camera.current);
+		packet.entity.clear();
+		m_entity_manager.capture(packet.entity);
+		packet.projection = camera.projection();
+		packet.step = step;
+		packet.tick = m_tick;
+		packet.time = m_time;
+		m_frame.publish();
+	}
+
+	void 
+	_manager::dispatch(
+		__in uint32_t specifier,
+		__in void *context,
+		__in size_t length
+		)
+	{
+		m_action_manager.input(specifier, context, length);
+		gaea::engine::event::notify(EVENT_INPUT, specifier, context, length);
+	}
+
+	void 
+	_manager::follow(void)
+	{
+		size_t index, next;
+		GLfloat position = (m_tick / (GLfloat) m_path_step);
+		gaea::engine::entity::transform_t transform;
+		gaea::engine::camera::base &camera = m_camera_manager.entry();
+
+		index = std::min((size_t) position, m_path.size() - 1);
+		next = std::min(index + 1, m_path.size() - 1);
+		transform = gaea::engine::entity::interpolate(m_path.at(index), m_path.at(next), position - index);
+		camera.receive(gaea::engine::camera::position_set_t{ transform.position });
+		camera.receive(gaea::engine::camera::rotation_set_t{ transform.rotation });
+		camera.receive(gaea::engine::camera::up_set_t{ transform.up });
+	}
+
+	void 
+	_manager::input(
+		__in uint32_t specifier,
+		__in void *context,
+		__in size_t length
+		)
+	{
+
+		if(m_player.is_open()) {
+			return;
+		}
+
+		if(m_recorder.is_open()) {
+			m_recorder.record(m_frame_count, specifier, context, length);
+		}
+
+		dispatch(specifier, context, length);
+	}
+
 	void 
 	_manager::initialize(void)
 	{
@@ -125,27 +303,133 @@ namespace gaea {
 		return (gaea::manager::m_instance != nullptr);
 	}
 
+	bool 
+	_manager::is_headless(void)
+	{
+		return m_headless;
+	}
+
 	bool 
 	_manager::is_initialized(void)
 	{
 		return m_initialized;
 	}
 
+	bool 
+	_manager::is_pipelined(void)
+	{
+		return m_pipelined;
+	}
+
 	bool 
 	_manager::is_started(void)
 	{
 		return m_started;
 	}
 
+	void 
+	_manager::pace(
+		__in uint64_t begin
+		)
+	{
+		uint64_t deadline, now;
+
+		if(m_pacing == PACING_TARGET) {
+			deadline = (begin + (TIME_NS_PER_SEC / m_pacing_rate));
+
+			now = gaea::engine::profile::now();
+			if((now + PACING_SPIN) < deadline) {
+				std::this_thread::sleep_for(std::chrono::nanoseconds(deadline - now - PACING_SPIN));
+			}
+
+			while(gaea::engine::profile::now() < deadline) {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	gaea::pacing_t 
+	_manager::pacing(void)
+	{
+		return m_pacing;
+	}
+
+	void 
+	_manager::prepare(
+		__in const glm::dvec3 &position,
+		__in const glm::mat4 &transform
+		)
+	{
+		uint64_t begin, end;
+		gaea::engine::arena::vector<gaea::engine::occlusion::box_t> occluder;
+
+		begin = gaea::engine::profile::now();
+		m_mesh_manager.occluders(position, occluder);
+		m_occlusion_manager.rasterize(transform, occluder);
+		end = gaea::engine::profile::now();
+		m_profile_manager.record(PROFILE_PHASE_OCCLUSION, begin, end);
+
+		begin = end;
+		m_stream_manager.update(position);
+		end = gaea::engine::profile::now();
+		m_profile_manager.record(PROFILE_PHASE_STREAM, begin, end);
+
+		begin = end;
+		m_mesh_manager.update(position);
+		m_profile_manager.record(PROFILE_PHASE_MESH, begin, gaea::engine::profile::now());
+	}
+
+	void 
+	_manager::present(
+		__in uint64_t now,
+		__in_opt bool current
+		)
+	{
+		GLfloat alpha = 0.f;
+		gaea::engine::entity::transform_t transform;
+		gaea::engine::camera::base &camera = m_camera_manager.entry();
+
+		m_frame.acquire();
+
+		gaea::engine::frame::packet_t &packet = m_frame.front();
+		if(current) {
+			alpha = 1.f;
+		} else if(now > packet.time) {
+			alpha = ((now - packet.time) / (GLfloat) packet.step);
+		}
+
+		camera.present(packet.camera.previous, packet.camera.current, alpha);
+		m_entity_manager.present(packet.entity, alpha);
+		transform = gaea::engine::entity::interpolate(packet.camera.previous, packet.camera.current, alpha);
+		prepare(transform.position, packet.projection * camera.view());
+		render(transform, packet.projection, camera.view());
+	}
+
 	void 
 	_manager::render(
-		__in gaea::engine::camera::base &camera
+		__in const gaea::engine::entity::transform_t &camera,
+		__in const glm::mat4 &projection,
+		__in const glm::mat4 &view
 		)
 	{
+		uint64_t begin;
+
+		m_profile_manager.start(PROFILE_PHASE_RENDER);
+		begin = gaea::engine::profile::now();
 		GL_CHECK(glClearColor, GL_CHAN_RED, GL_CHAN_GREEN, GL_CHAN_BLUE, GL_CHAN_ALPHA);
 		GL_CHECK(glClear, GL_CLEAR_FLAGS);
-		m_entity_manager.render(camera.position(), camera.rotation(), camera.up(), camera.projection(), camera.view());
-		SDL_GL_SwapWindow(m_window);
+		m_entity_manager.render(camera.position, camera.rotation, camera.up, projection, view);
+		m_profile_manager.record(PROFILE_PHASE_RENDER, begin, gaea::engine::profile::now());
+		m_profile_manager.stop(PROFILE_PHASE_RENDER);
+
+		begin = gaea::engine::profile::now();
+
+		if(m_headless) {
+			GL_CHECK(glFinish);
+		} else {
+			SDL_GL_SwapWindow(m_window);
+		}
+		m_profile_manager.record(PROFILE_PHASE_SWAP, begin, gaea::engine::profile::now());
 	}
 
 	void 
@@ -160,15 +444,167 @@ namespace gaea {
 		)
 	{
 		GLenum result;
-		uint32_t flags = SDL_WINDOW_FLAGS;
 
 		m_tick = tick;
 
-		if(SDL_Init(SDL_INIT_FLAGS)) {
+		if(SDL_Init(m_headless ? SDL_INIT_HEADLESS_FLAGS : SDL_INIT_FLAGS)) {
 			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "SDL_Init failed: %s",
 				SDL_GetError());
 		}
 
+		if(m_headless) {
+			setup_headless();
+		} else {
+			setup_window(title, dimensions, fullscreen);
+		}
+
+		glewExperimental = GL_TRUE;
+
+		result = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+		if(m_headless && (result == GLEW_ERROR_NO_GLX_DISPLAY)) {
+			result = GLEW_OK;
+		}
+#endif // GLEW_ERROR_NO_GLX_DISPLAY
+
+		if(result != GLEW_OK) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "glewInit failed: %s",
+				GL_ERROR_STRING(result));
+		}
+
+		GL_ERROR_CLEAR;
+		GL_CHECK(glEnable, GL_DEPTH_TEST);
+
+		if(m_headless) {
+			setup_framebuffer(dimensions);
+		} else {
+			swap_interval();
+		}
+
+		m_arena_manager.initialize();
+		m_uid_manager.initialize();
+		m_archive_manager.initialize();
+		m_archive_manager.mount(ARCHIVE_PATH_INIT, true);
+		m_event_manager.initialize();
+		m_gfx_manager.initialize();
+		m_entity_manager.initialize();
+		m_camera_manager.initialize(dimensions);
+		m_world_manager.initialize();
+		m_region_manager.initialize();
+		m_terrain_manager.initialize();
+		m_stream_manager.initialize();
+		m_mesh_manager.initialize();
+		m_occlusion_manager.initialize();
+#ifndef NDEBUG
+		m_profile_manager.initialize(PROFILE_HISTORY_INIT, true);
+#else
+		m_profile_manager.initialize();
+#endif // NDEBUG
+
+		m_action_manager.initialize(key_map, speed, sensitivity);
+		m_action_manager.load(ACTION_PATH_INIT, true);
+
+		// TODO: initialize singletons
+
+	}
+
+	void 
+	_manager::setup_framebuffer(
+		__in const glm::uvec2 &dimensions
+		)
+	{
+		GLenum status;
+
+		GL_CHECK(glGenFramebuffers, 1, &m_framebuffer);
+		GL_CHECK(glBindFramebuffer, GL_FRAMEBUFFER, m_framebuffer);
+
+		GL_CHECK(glGenRenderbuffers, 1, &m_framebuffer_color);
+		GL_CHECK(glBindRenderbuffer, GL_RENDERBUFFER, m_framebuffer_color);
+		GL_CHECK(glRenderbufferStorage, GL_RENDERBUFFER, GL_RGBA8, dimensions.x, dimensions.y);
+		GL_CHECK(glFramebufferRenderbuffer, GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+			m_framebuffer_color);
+
+		GL_CHECK(glGenRenderbuffers, 1, &m_framebuffer_depth);
+		GL_CHECK(glBindRenderbuffer, GL_RENDERBUFFER, m_framebuffer_depth);
+		GL_CHECK(glRenderbufferStorage, GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, dimensions.x, dimensions.y);
+		GL_CHECK(glFramebufferRenderbuffer, GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER,
+			m_framebuffer_depth);
+
+		GL_CHECK_RESULT(status, glCheckFramebufferStatus, GL_FRAMEBUFFER);
+		if(status != GL_FRAMEBUFFER_COMPLETE) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "glCheckFramebufferStatus failed: %x",
+				status);
+		}
+
+		GL_CHECK(glViewport, 0, 0, dimensions.x, dimensions.y);
+	}
+
+	void 
+	_manager::setup_headless(void)
+	{
+		EGLConfig config;
+		EGLint count = 0;
+		const char *extension;
+		PFNEGLGETPLATFORMDISPLAYEXTPROC platform_display;
+
+		extension = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+		if(extension && std::strstr(extension, HEADLESS_EXTENSION_PLATFORM)) {
+
+			platform_display = (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+			if(platform_display) {
+				m_display = platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+			}
+		}
+
+		if(m_display == EGL_NO_DISPLAY) {
+			m_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		}
+
+		if(m_display == EGL_NO_DISPLAY) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "eglGetDisplay failed: %x", eglGetError());
+		}
+
+		if(!eglInitialize(m_display, nullptr, nullptr)) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "eglInitialize failed: %x", eglGetError());
+		}
+
+		if(!eglBindAPI(EGL_OPENGL_API)) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "eglBindAPI failed: %x", eglGetError());
+		}
+
+		if(!eglChooseConfig(m_display, HEADLESS_CONFIG, &config, 1, &count) || !count) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "eglChooseConfig failed: %x", eglGetError());
+		}
+
+		m_context = eglCreateContext(m_display, config, EGL_NO_CONTEXT, HEADLESS_CONTEXT);
+		if(m_context == EGL_NO_CONTEXT) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "eglCreateContext failed: %x", eglGetError());
+		}
+
+		extension = eglQueryString(m_display, EGL_EXTENSIONS);
+		if(!extension || !std::strstr(extension, HEADLESS_EXTENSION_SURFACELESS)) {
+
+			m_surface = eglCreatePbufferSurface(m_display, config, HEADLESS_SURFACE);
+			if(m_surface == EGL_NO_SURFACE) {
+				THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "eglCreatePbufferSurface failed: %x",
+					eglGetError());
+			}
+		}
+
+		if(!eglMakeCurrent(m_display, m_surface, m_surface, m_context)) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "eglMakeCurrent failed: %x", eglGetError());
+		}
+	}
+
+	void 
+	_manager::setup_window(
+		__in const std::string &title,
+		__in const glm::uvec2 &dimensions,
+		__in bool fullscreen
+		)
+	{
+		uint32_t flags = SDL_WINDOW_FLAGS;
+
 		if(SDL_GL_SetAttribute(SDL_GL_RED_SIZE, GL_ATTRIB_COLOR)) {
 			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, 
 				"SDL_GL_SetAttribute(SDL_GL_RED_SIZE) failed: %s", SDL_GetError());
@@ -236,32 +672,6 @@ namespace gaea {
 			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "SDL_SetRelativeMouseMode(SDL_TRUE) failed: %s", 
 				SDL_GetError());
 		}
-
-		glewExperimental = GL_TRUE;
-
-		result = glewInit();
-		if(result != GLEW_OK) {
-			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "glewInit failed: %s",
-				GL_ERROR_STRING(result));
-		}
-
-		GL_ERROR_CLEAR;
-
-		if(SDL_GL_SetSwapInterval(SDL_ATTRIB_VSYNC)) {
-			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "SDL_GL_SetSwapInterval failed: %s", 
-				SDL_GetError());
-		}
-
-		m_uid_manager.initialize();
-		m_event_manager.initialize();
-		m_gfx_manager.initialize();
-		m_entity_manager.initialize();
-		m_camera_manager.initialize(dimensions);
-
-		// TODO: HANDLE KEYMAP/SPEED/SENSITIVITY SETTINGS
-
-		// TODO: initialize singletons
-
 	}
 
 	void 
@@ -276,7 +686,7 @@ namespace gaea {
 		)
 	{
 		SDL_Event event;
-		gaea::tick_t begin = 0, delta = 0, end = 0;
+		uint64_t frame, phase, step;
 
 		if(!m_initialized) {
 			THROW_GAEA_EXCEPTION(GAEA_EXCEPTION_UNINITALIZED);
@@ -287,7 +697,6 @@ namespace gaea {
 		}
 
 		setup(title, dimensions, fullscreen, key_map, speed, sensitivity, tick);
-		gaea::engine::camera::base &camera = m_camera_manager.entry();
 
 		// TODO: DEBUGGING
 		enum {
@@ -316,9 +725,30 @@ namespace gaea {
 		}
 		// ---
 
+		m_frame_count = 0;
+
+		if(!m_replay_path.empty()) {
+			m_player.open(m_replay_path);
+		}
+
+		if(!m_record_path.empty()) {
+			m_recorder.open(m_record_path);
+		}
+
 		m_started = true;
+		m_time = gaea::engine::profile::now();
+		capture(TIME_NS_PER_SEC / m_tick_rate);
+
+		if(m_pipelined && !m_headless) {
+			m_simulating = true;
+			m_simulation = std::thread(gaea::manager::_thread);
+		}
+
 		while(m_started) {
+			frame = gaea::engine::profile::now();
+			m_arena_manager.reset();
 
+			phase = frame;
 			while(SDL_PollEvent(&event)) {
 
 				switch(event.type) {
@@ -332,21 +762,30 @@ namespace gaea {
 						}
 #endif // NDEEBUG
 
-						gaea::engine::event::notify(EVENT_INPUT, EVENT_INPUT_KEY,
-							&event.key, sizeof(SDL_KeyboardEvent));
+						input(EVENT_INPUT_KEY, &event.key, sizeof(SDL_KeyboardEvent));
 						break;
 					case SDL_MOUSEBUTTONDOWN:
 					case SDL_MOUSEBUTTONUP:
-						gaea::engine::event::notify(EVENT_INPUT, EVENT_INPUT_BUTTON,
-							&event.button, sizeof(SDL_MouseButtonEvent));
+						input(EVENT_INPUT_BUTTON, &event.button, sizeof(SDL_MouseButtonEvent));
 						break;
 					case SDL_MOUSEMOTION:
-						gaea::engine::event::notify(EVENT_INPUT, EVENT_INPUT_MOTION,
-							&event.motion, sizeof(SDL_MouseMotionEvent));
+						input(EVENT_INPUT_MOTION, &event.motion, sizeof(SDL_MouseMotionEvent));
 						break;
 					case SDL_MOUSEWHEEL:
-						gaea::engine::event::notify(EVENT_INPUT, EVENT_INPUT_WHEEL,
-							&event.wheel, sizeof(SDL_MouseWheelEvent));
+						input(EVENT_INPUT_WHEEL, &event.wheel, sizeof(SDL_MouseWheelEvent));
+						break;
+					case SDL_CONTROLLERAXISMOTION:
+						input(EVENT_INPUT_CONTROLLER_AXIS, &event.caxis, sizeof(SDL_ControllerAxisEvent));
+						break;
+					case SDL_CONTROLLERBUTTONDOWN:
+					case SDL_CONTROLLERBUTTONUP:
+						input(EVENT_INPUT_CONTROLLER_BUTTON, &event.cbutton, sizeof(SDL_ControllerButtonEvent));
+						break;
+					case SDL_CONTROLLERDEVICEADDED:
+						m_action_manager.attach(event.cdevice.which);
+						break;
+					case SDL_CONTROLLERDEVICEREMOVED:
+						m_action_manager.detach(event.cdevice.which);
 						break;
 					case SDL_QUIT:
 						stop();
@@ -356,19 +795,43 @@ namespace gaea {
 				}
 			}
 
-			if(delta < DELTA_MIN) {
-				begin = SDL_GetTicks();
-				SDL_Delay(DELTA_MIN);
-				end = SDL_GetTicks();
-				delta = (end - begin);
+			if(m_player.is_open()) {
+				m_player.play(m_frame_count, gaea::manager::_input);
 			}
 
-			begin = SDL_GetTicks();
-			update(delta / (GLfloat) DELTA_DIV);
-			render(camera);
-			end = SDL_GetTicks();
-			delta = (end - begin);
-			++m_tick;
+			m_action_manager.update();
+
+			m_profile_manager.record(PROFILE_PHASE_EVENT, phase, gaea::engine::profile::now());
+
+			if(m_headless) {
+				step = (TIME_NS_PER_SEC / m_tick_rate);
+				simulate(m_time + step);
+				present(m_time, true);
+			} else {
+
+				if(!m_pipelined) {
+					simulate(frame);
+				}
+
+				present(gaea::engine::profile::now());
+			}
+
+			pace(frame);
+			m_profile_manager.record(PROFILE_PHASE_FRAME, frame, gaea::engine::profile::now());
+
+			++m_frame_count;
+
+			if(m_headless && (m_frame_count >= m_headless_frames)) {
+				stop();
+			}
+		}
+
+		if(m_simulation.joinable()) {
+			m_lock.lock();
+			m_simulating = false;
+			m_condition.notify_all();
+			m_lock.unlock();
+			m_simulation.join();
 		}
 
 		// TODO: DEBUGGING
@@ -381,6 +844,144 @@ namespace gaea {
 		teardown();
 	}
 
+	void 
+	_manager::set_headless(
+		__in bool value,
+		__in_opt uint32_t frames
+		)
+	{
+
+		if(m_started) {
+			THROW_GAEA_EXCEPTION(GAEA_EXCEPTION_STARTED);
+		}
+
+		if(!frames) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_INVALID, "Frames=%u", frames);
+		}
+
+		m_headless = value;
+		m_headless_frames = frames;
+	}
+
+	void 
+	_manager::set_pacing(
+		__in gaea::pacing_t pacing,
+		__in_opt uint32_t rate
+		)
+	{
+
+		if(pacing > PACING_MAX) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_INVALID, "Pacing=%x", pacing);
+		}
+
+		if((pacing == PACING_TARGET) && !rate) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_INVALID, "Rate=%u", rate);
+		}
+
+		m_pacing = pacing;
+		m_pacing_rate = rate;
+
+		if(m_window_context) {
+			swap_interval();
+		}
+	}
+
+	void 
+	_manager::set_path(
+		__in const std::vector<gaea::engine::entity::transform_t> &path,
+		__in_opt uint32_t step
+		)
+	{
+
+		if(!step) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_INVALID, "Step=%u", step);
+		}
+
+		m_path = path;
+		m_path_step = step;
+	}
+
+	void 
+	_manager::set_pipelined(
+		__in bool value
+		)
+	{
+
+		if(m_started) {
+			THROW_GAEA_EXCEPTION(GAEA_EXCEPTION_STARTED);
+		}
+
+		m_pipelined = value;
+	}
+
+	void 
+	_manager::set_record(
+		__in const std::string &path
+		)
+	{
+
+		if(m_started) {
+			THROW_GAEA_EXCEPTION(GAEA_EXCEPTION_STARTED);
+		}
+
+		m_record_path = path;
+	}
+
+	void 
+	_manager::set_replay(
+		__in const std::string &path
+		)
+	{
+
+		if(m_started) {
+			THROW_GAEA_EXCEPTION(GAEA_EXCEPTION_STARTED);
+		}
+
+		m_replay_path = path;
+	}
+
+	void 
+	_manager::set_tick_rate(
+		__in uint32_t rate
+		)
+	{
+
+		if(!rate) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_INVALID, "Rate=%u", rate);
+		}
+
+		m_tick_rate = rate;
+	}
+
+	uint32_t 
+	_manager::simulate(
+		__in uint64_t now
+		)
+	{
+		uint32_t result = 0;
+		uint64_t step = (TIME_NS_PER_SEC / m_tick_rate);
+
+		if((now > m_time) && ((now - m_time) > TICK_FRAME_MAX)) {
+			m_time = (now - TICK_FRAME_MAX);
+		}
+
+		for(; (result < TICK_STEP_MAX) && ((m_time + step) <= now); ++result) {
+			update(step / (GLfloat) TIME_NS_PER_SEC);
+			m_time += step;
+			++m_tick;
+		}
+
+		if((m_time + step) <= now) {
+			m_time = (now - ((now - m_time) % step));
+		}
+
+		if(result) {
+			capture(step);
+		}
+
+		return result;
+	}
+
 	void 
 	_manager::stop(void)
 	{
@@ -390,17 +991,119 @@ namespace gaea {
 		}
 	}
 
+	void 
+	_manager::swap_interval(void)
+	{
+		int result;
+
+		switch(m_pacing) {
+			case PACING_VSYNC_ADAPTIVE:
+
+				result = SDL_GL_SetSwapInterval(SDL_ATTRIB_VSYNC_ADAPTIVE);
+				if(result) {
+					result = SDL_GL_SetSwapInterval(SDL_ATTRIB_VSYNC);
+				}
+				break;
+			case PACING_TARGET:
+			case PACING_UNCAPPED:
+				result = SDL_GL_SetSwapInterval(SDL_ATTRIB_VSYNC_NONE);
+				break;
+			default:
+				result = SDL_GL_SetSwapInterval(SDL_ATTRIB_VSYNC);
+				break;
+		}
+
+		if(result) {
+			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "SDL_GL_SetSwapInterval failed: %s", 
+				SDL_GetError());
+		}
+	}
+
 	void 
 	_manager::teardown(void)
 	{
 
 		// TODO: uninitialize singletons
 
+#ifndef NDEBUG
+		m_profile_manager.dump();
+#endif // NDEBUG
+
+		if(m_headless) {
+			std::cout << m_profile_manager.to_string(true) << std::endl
+				<< m_arena_manager.to_string(true) << std::endl
+				<< gaea::engine::pool::manager::acquire().to_string(true) << std::endl;
+		}
+
+		m_profile_manager.uninitialize();
+		m_frame.clear();
+		m_player.close();
+		m_recorder.close();
+		m_occlusion_manager.uninitialize();
+		m_mesh_manager.uninitialize();
+		m_stream_manager.uninitialize();
+		m_terrain_manager.uninitialize();
+		m_region_manager.uninitialize();
+		m_world_manager.uninitialize();
 		m_camera_manager.uninitialize();
 		m_entity_manager.uninitialize();		
 		m_gfx_manager.uninitialize();
 		m_event_manager.uninitialize();
+		m_action_manager.uninitialize();
+		m_archive_manager.uninitialize();
 		m_uid_manager.uninitialize();
+		m_arena_manager.uninitialize();
+
+		if(m_headless) {
+			teardown_headless();
+		} else {
+			teardown_window();
+		}
+
+		SDL_Quit();
+		m_tick = TICK_INVALID;
+	}
+
+	void 
+	_manager::teardown_headless(void)
+	{
+
+		if(m_framebuffer_depth != GL_HANDLE_INVALID) {
+			GL_CHECK(glDeleteRenderbuffers, 1, &m_framebuffer_depth);
+			m_framebuffer_depth = GL_HANDLE_INVALID;
+		}
+
+		if(m_framebuffer_color != GL_HANDLE_INVALID) {
+			GL_CHECK(glDeleteRenderbuffers, 1, &m_framebuffer_color);
+			m_framebuffer_color = GL_HANDLE_INVALID;
+		}
+
+		if(m_framebuffer != GL_HANDLE_INVALID) {
+			GL_CHECK(glDeleteFramebuffers, 1, &m_framebuffer);
+			m_framebuffer = GL_HANDLE_INVALID;
+		}
+
+		if(m_display != EGL_NO_DISPLAY) {
+			eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+			if(m_surface != EGL_NO_SURFACE) {
+				eglDestroySurface(m_display, m_surface);
+				m_surface = EGL_NO_SURFACE;
+			}
+
+			if(m_context != EGL_NO_CONTEXT) {
+				eglDestroyContext(m_display, m_context);
+				m_context = EGL_NO_CONTEXT;
+			}
+
+			eglTerminate(m_display);
+			m_display = EGL_NO_DISPLAY;
+		}
+	}
+
+	void 
+	_manager::teardown_window(void)
+	{
 
 		if(SDL_SetRelativeMouseMode(SDL_FALSE)) {
 			THROW_GAEA_EXCEPTION_FORMAT(GAEA_EXCEPTION_EXTERNAL, "SDL_SetRelativeMouseMode(SDL_FALSE) failed: %s", 
@@ -416,9 +1119,6 @@ namespace gaea {
 			SDL_DestroyWindow(m_window);
 			m_window = nullptr;
 		}
-
-		SDL_Quit();
-		m_tick = TICK_INVALID;
 	}
 
 	gaea::tick_t 
@@ -443,7 +1143,23 @@ namespace gaea {
 			if(m_started) {
 				result << ", WIN=" << SCALAR_AS_HEX(uintptr_t, m_window) 
 					<< ", CONT=" << SCALAR_AS_HEX(uintptr_t, m_window_context)
-					<< ", TICK=" << m_tick;
+					<< ", TICK=" << m_tick << " (" << m_tick_rate << " Hz)"
+					<< ", PACE=" << m_pacing;
+
+				if(m_pacing == PACING_TARGET) {
+					result << " (" << m_pacing_rate << " Hz)";
+				}
+
+				result << ", " << (m_headless ? "HEADLESS" : (m_pipelined ? "PIPELINED" : "SERIAL"))
+					<< ", " << m_frame.to_string(verbose);
+
+				if(m_recorder.is_open()) {
+					result << ", " << m_recorder.to_string(verbose);
+				}
+
+				if(m_player.is_open()) {
+					result << ", " << m_player.to_string(verbose);
+				}
 			}
 		}
 
@@ -469,6 +1185,15 @@ namespace gaea {
 		__in GLfloat delta
 		)
 	{
+		uint64_t begin;
+		gaea::engine::profile::scope timer(PROFILE_PHASE_UPDATE);
+
+		if(!m_path.empty()) {
+			follow();
+		}
+
+		begin = gaea::engine::profile::now();
 		m_entity_manager.update(delta);
+		m_profile_manager.record(PROFILE_PHASE_ENTITY, begin, gaea::engine::profile::now());
 	}
 }
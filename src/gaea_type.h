@@ -33,6 +33,7 @@ namespace gaea {
 		GAEA_EXCEPTION_ALLOCATED = 0,
 		GAEA_EXCEPTION_EXTERNAL,
 		GAEA_EXCEPTION_INITIALIZED,
+		GAEA_EXCEPTION_INVALID,
 		GAEA_EXCEPTION_STARTED,
 		GAEA_EXCEPTION_UNINITALIZED,
 	};
@@ -43,6 +44,7 @@ namespace gaea {
 		GAEA_EXCEPTION_HEADER "Failed to allocate manager",
 		GAEA_EXCEPTION_HEADER "External exception",
 		GAEA_EXCEPTION_HEADER "Manager is initialized",
+		GAEA_EXCEPTION_HEADER "Invalid manager parameter",
 		GAEA_EXCEPTION_HEADER "Manager is started",
 		GAEA_EXCEPTION_HEADER "Manager is uninitialized",
 		};
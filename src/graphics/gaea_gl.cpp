@@ -29,7 +29,7 @@ namespace gaea {
 			STRING_CHECK(GL_OBJECT_STR[_TYPE_]))
 
 		static const std::string GL_OBJECT_STR[] = {
-			"CUBEMAP", "PROGRAM", "SHADER", "TEXTURE", "VAO", "VBO",
+			"CUBEMAP", "PROGRAM", "QUERY", "SHADER", "TEXTURE", "VAO", "VBO",
 			};
 
 		enum {
@@ -65,7 +65,7 @@ namespace gaea {
 			decrement_reference();
 		}
 
-		_base &
+		_base & 
 		_base::operator=(
 			__in const _base &other
 			)
@@ -178,6 +178,7 @@ namespace gaea {
 		_manager::_manager(void) :
 			m_initialized(false)
 		{
+			gaea::engine::pool::manager::acquire();
 			std::atexit(gaea::graphics::manager::_delete);
 		}
 
@@ -196,7 +197,7 @@ namespace gaea {
 			}
 		}
 
-		_manager &
+		_manager & 
 		_manager::acquire(void)
 		{
 
@@ -214,8 +215,8 @@ namespace gaea {
 		void 
 		_manager::clear(void)
 		{
-			std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator entry_iter;
-			std::vector<std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>>::iterator type_iter;
+			gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator entry_iter;
+			std::vector<gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>>::iterator type_iter;
 
 			for(type_iter = m_entry.begin(); type_iter != m_entry.end(); ++type_iter) {
 
@@ -227,6 +228,23 @@ namespace gaea {
 			}
 
 			m_entry.clear();
+
+			if(!m_free.empty()) {
+
+				if(!m_free.at(GL_OBJECT_QUERY).empty()) {
+					GL_CHECK(glDeleteQueries, m_free.at(GL_OBJECT_QUERY).size(), m_free.at(GL_OBJECT_QUERY).data());
+				}
+
+				if(!m_free.at(GL_OBJECT_VAO).empty()) {
+					GL_CHECK(glDeleteVertexArrays, m_free.at(GL_OBJECT_VAO).size(), m_free.at(GL_OBJECT_VAO).data());
+				}
+
+				if(!m_free.at(GL_OBJECT_VBO).empty()) {
+					GL_CHECK(glDeleteBuffers, m_free.at(GL_OBJECT_VBO).size(), m_free.at(GL_OBJECT_VBO).data());
+				}
+			}
+
+			m_free.clear();
 		}
 
 		bool 
@@ -257,6 +275,13 @@ namespace gaea {
 			std::string name;
 			GLuint result = GL_HANDLE_INVALID;
 
+			if((type < m_free.size()) && !m_free.at(type).empty()) {
+				result = m_free.at(type).back();
+				m_free.at(type).pop_back();
+
+				return result;
+			}
+
 			switch(type) {
 				case GL_OBJECT_CUBEMAP:
 				case GL_OBJECT_TEXTURE:
@@ -267,6 +292,10 @@ namespace gaea {
 					GL_CHECK_RESULT(result, glCreateProgram);
 					name = STRING_CONCAT(glCreateProgram);
 					break;
+				case GL_OBJECT_QUERY:
+					GL_CHECK(glGenQueries, OBJECT_COUNT, &result);
+					name = STRING_CONCAT(glGenQueries);
+					break;
 				case GL_OBJECT_SHADER:
 					GL_CHECK_RESULT(result, glCreateShader, target);
 					name = STRING_CONCAT(glCreateShader);
@@ -298,11 +327,15 @@ namespace gaea {
 			)
 		{
 			size_t result = 0;
-			std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator iter;
+			gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator iter;
 
 			iter = find(id, type);
 			if(TUPLE_ENTRY(iter->second, GL_TUPLE_REFERENCE) <= REFERENCE_INIT) {
-				destroy(iter);
+
+				if(!recycle(iter)) {
+					destroy(iter);
+				}
+
 				m_entry.at(type).erase(iter);
 			} else {
 				result = --TUPLE_ENTRY(iter->second, GL_TUPLE_REFERENCE);
@@ -313,7 +346,7 @@ namespace gaea {
 
 		void 
 		_manager::destroy(
-			__in const std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator &entry
+			__in const gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator &entry
 			)
 		{
 			GLuint handle;
@@ -328,6 +361,9 @@ namespace gaea {
 				case GL_OBJECT_PROGRAM:
 					GL_CHECK(glDeleteProgram, handle);
 					break;
+				case GL_OBJECT_QUERY:
+					GL_CHECK(glDeleteQueries, OBJECT_COUNT, &handle);
+					break;
 				case GL_OBJECT_SHADER:
 					GL_CHECK(glDeleteShader, handle);
 					break;
@@ -343,13 +379,13 @@ namespace gaea {
 			}
 		}
 
-		std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator 
+		gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator 
 		_manager::find(
 			__in gaea::uid_t &id,
 			__in gaea::gl_t type
 			)
 		{
-			std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator result;
+			gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator result;
 
 			if(!m_initialized) {
 				THROW_GAEA_GL_EXCEPTION(GAEA_GL_EXCEPTION_UNINITIALIZED);
@@ -417,7 +453,8 @@ namespace gaea {
 			}
 
 			m_entry.resize(GL_OBJECT_MAX + 1, 
-				std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>());
+				gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>());
+			m_free.resize(GL_OBJECT_MAX + 1, std::vector<GLuint>());
 			m_initialized = true;
 		}
 
@@ -433,6 +470,48 @@ namespace gaea {
 			return m_initialized;
 		}
 
+		bool 
+		_manager::recycle(
+			__in const gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator &entry
+			)
+		{
+			bool result = false;
+			gaea::gl_t type = TUPLE_ENTRY(entry->second, GL_TUPLE_TYPE);
+
+			switch(type) {
+				case GL_OBJECT_QUERY:
+				case GL_OBJECT_VAO:
+				case GL_OBJECT_VBO:
+					result = (m_free.at(type).size() < GL_FREE_MAX);
+					if(result) {
+						m_free.at(type).push_back(TUPLE_ENTRY(entry->second, GL_TUPLE_HANDLE));
+					}
+					break;
+				default:
+					break;
+			}
+
+			return result;
+		}
+
+		size_t 
+		_manager::recycled(
+			__in gaea::gl_t type
+			)
+		{
+
+			if(!m_initialized) {
+				THROW_GAEA_GL_EXCEPTION(GAEA_GL_EXCEPTION_UNINITIALIZED);
+			}
+
+			if(type >= m_free.size()) {
+				THROW_GAEA_GL_EXCEPTION_FORMAT(GAEA_GL_EXCEPTION_INVALID,
+					"%x", type);
+			}
+
+			return m_free.at(type).size();
+		}
+
 		size_t 
 		_manager::reference_count(
 			__in gaea::uid_t &id,
@@ -446,7 +525,7 @@ namespace gaea {
 		_manager::size(void)
 		{
 			size_t result = 0;
-			std::vector<std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>>::iterator iter;
+			std::vector<gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>>::iterator iter;
 
 			if(!m_initialized) {
 				THROW_GAEA_GL_EXCEPTION(GAEA_GL_EXCEPTION_UNINITIALIZED);
@@ -484,14 +563,17 @@ namespace gaea {
 		{
 			size_t count;
 			std::stringstream result;
-			std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator entry_iter;
-			std::vector<std::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>>::iterator type_iter;
+			gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>::iterator entry_iter;
+			std::vector<gaea::engine::pool::map<gaea::uid_t, std::tuple<gaea::gl_t, GLenum, GLuint, size_t>>>::iterator type_iter;
 
 			result << GAEA_GL_HEADER << " (" << (m_initialized ? "INIT" : "UNINIT") << ")";
 
 			if(m_initialized) {
 				result << " INST=" << SCALAR_AS_HEX(uintptr_t, this)
-					<< ", ENTRIES=" << size();
+					<< ", ENTRIES=" << size()
+					<< ", FREE={" << m_free.at(GL_OBJECT_QUERY).size() << ", "
+						<< m_free.at(GL_OBJECT_VAO).size() << ", "
+						<< m_free.at(GL_OBJECT_VBO).size() << "}";
 
 				if(verbose) {
 
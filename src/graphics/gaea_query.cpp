@@ -0,0 +1,133 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/gaea.h"
+#include "gaea_query_type.h"
+
+namespace gaea {
+
+	namespace graphics {
+
+		namespace query {
+
+			_base::_base(
+				__in_opt GLenum target
+				) :
+					gaea::graphics::base(GL_OBJECT_QUERY, target),
+					m_issued(false)
+			{
+				return;
+			}
+
+			_base::_base(
+				__in const _base &other
+				) :
+					gaea::graphics::base(other),
+					m_issued(other.m_issued)
+			{
+				return;
+			}
+
+			_base::~_base(void)
+			{
+				return;
+			}
+
+			_base &
+			_base::operator=(
+				__in const _base &other
+				)
+			{
+
+				if(this != &other) {
+					gaea::graphics::base::operator=(other);
+					m_issued = other.m_issued;
+				}
+
+				return *this;
+			}
+
+			std::string 
+			_base::as_string(
+				__in const _base &object,
+				__in_opt bool verbose
+				)
+			{
+				std::stringstream result;
+
+				result << gaea::graphics::base::as_string(object, verbose)
+					<< ", " << (object.m_issued ? "ISSUED" : "IDLE");
+
+				return result.str();
+			}
+
+			bool 
+			_base::is_available(void)
+			{
+				GLuint result = GL_FALSE;
+
+				if(m_issued) {
+					GL_CHECK(glGetQueryObjectuiv, m_handle, GL_QUERY_RESULT_AVAILABLE, &result);
+				}
+
+				return (result == GL_TRUE);
+			}
+
+			bool 
+			_base::is_issued(void)
+			{
+				return m_issued;
+			}
+
+			GLuint 
+			_base::result(void)
+			{
+				GLuint result = 0;
+
+				if(m_issued) {
+					GL_CHECK(glGetQueryObjectuiv, m_handle, GL_QUERY_RESULT, &result);
+					m_issued = false;
+				}
+
+				return result;
+			}
+
+			void 
+			_base::start(void)
+			{
+				GL_CHECK(glBeginQuery, m_target, m_handle);
+			}
+
+			void 
+			_base::stop(void)
+			{
+				GL_CHECK(glEndQuery, m_target);
+				m_issued = true;
+			}
+
+			std::string 
+			_base::to_string(
+				__in_opt bool verbose
+				)
+			{
+				return gaea::graphics::query::base::as_string(*this, verbose);
+			}
+		}
+	}
+}
@@ -17,7 +17,6 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <fstream>
 #include "../../include/gaea.h"
 #include "gaea_shader_type.h"
 
@@ -80,33 +79,31 @@ namespace gaea {
 				)
 			{				
 				std::string buffer;
-				std::ifstream file;
+				size_t mapped_length;
 				GLint complete, length;
+				std::vector<uint8_t> data;
 				const GLchar *source = nullptr;
+				std::shared_ptr<const uint8_t> mapped;
 
-				file = std::ifstream(shader.c_str(), std::ios::in);
-				if(!file) {
-					THROW_GAEA_SHADER_EXCEPTION_FORMAT(GAEA_SHADER_EXCEPTION_NOT_FOUND,
-						"%s", STRING_CHECK(shader));
-				}
+				if(gaea::engine::archive::map(shader, mapped, mapped_length)) {
+					source = (const GLchar *) mapped.get();
+					length = mapped_length;
+				} else {
 
-				file.seekg(0, std::ios::end);
-				length = file.tellg();
-				file.seekg(0, std::ios::beg);
+					if(!gaea::engine::archive::load(shader, data)) {
+						THROW_GAEA_SHADER_EXCEPTION_FORMAT(GAEA_SHADER_EXCEPTION_NOT_FOUND,
+							"%s", STRING_CHECK(shader));
+					}
 
-				if(length > 0) {
-					buffer.resize(++length, 0);
-					file.read(&buffer[0], length);
+					source = (const GLchar *) data.data();
+					length = data.size();
 				}
 
-				file.close();
-
-				if(length < 0) {
+				if(!source || (length <= 0)) {
 					THROW_GAEA_SHADER_EXCEPTION_FORMAT(GAEA_SHADER_EXCEPTION_MALFORMED,
 						"%s", STRING_CHECK(shader));
 				}
 
-				source = (const GLchar *) &buffer[0];
 				GL_CHECK(glShaderSource, m_handle, OBJECT_COUNT, &source, &length);
 				GL_CHECK(glCompileShader, m_handle);
 				GL_CHECK(glGetShaderiv, m_handle, GL_COMPILE_STATUS, &complete);
@@ -17,6 +17,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
 #include "../../include/gaea.h"
 #include "gaea_texture_type.h"
 
@@ -31,9 +32,14 @@ namespace gaea {
 			#define IMAGE_DEPTH_16 16
 			#define IMAGE_DEPTH_INVALID SCALAR_INVALID(png_byte)
 
+			typedef struct {
+				const uint8_t *data;
+				size_t length;
+				size_t offset;
+			} import_source_t;
+
 			void 
 			import_cleanup_png(
-				__inout FILE **file,
 				__inout png_structpp reader,
 				__inout png_infopp reader_info
 				)
@@ -52,15 +58,24 @@ namespace gaea {
 				if(reader_info) {
 					reader_info = nullptr;
 				}
+			}
 
-				if(file) {
-
-					if(*file) {
-						std::fclose(*file);
-					}
+			void 
+			import_read_png(
+				__in png_structp reader,
+				__out png_bytep data,
+				__in png_size_t length
+				)
+			{
+				gaea::graphics::texture::import_source_t *source =
+					(gaea::graphics::texture::import_source_t *) png_get_io_ptr(reader);
 
-					file = nullptr;
+				if(!source || (length > (source->length - source->offset))) {
+					png_error(reader, "Unexpected end of image data");
 				}
+
+				std::memcpy(data, source->data + source->offset, length);
+				source->offset += length;
 			}
 
 			void 
@@ -69,15 +84,15 @@ namespace gaea {
 				__out png_byte &color,
 				__out png_byte &depth,
 				__out glm::ivec2 &dimensions,
-				__out FILE **file,
+				__inout gaea::graphics::texture::import_source_t &source,
 				__out png_structpp reader,
 				__out png_infopp reader_info
 				)
 			{
 
-				if(!file || !reader || !reader_info) {
+				if(!source.data || !reader || !reader_info) {
 					THROW_GAEA_TEXTURE_EXCEPTION_FORMAT(GAEA_TEXTURE_EXCEPTION_INVALID,
-						"file=%p, reader=%p, reader_info=%p", file, reader, reader_info);
+						"source=%p, reader=%p, reader_info=%p", source.data, reader, reader_info);
 				}
 
 				*reader = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
@@ -92,31 +107,25 @@ namespace gaea {
 						"png_create_read_struct failed: %p", *reader_info);
 				}
 
-				*file = std::fopen(texture.c_str(), "rb");
-				if(!*file) {
-					THROW_GAEA_TEXTURE_EXCEPTION_FORMAT(GAEA_TEXTURE_EXCEPTION_NOT_FOUND,
-						"%s", STRING_CHECK(texture));
-				}
-
 				if(setjmp(png_jmpbuf(*reader))) {
-					import_cleanup_png(file, reader, reader_info);
+					import_cleanup_png(reader, reader_info);
 					THROW_GAEA_TEXTURE_EXCEPTION_FORMAT(GAEA_TEXTURE_EXCEPTION_EXTERNAL,
 						"png_jmpbuf failed: %p", *reader);
 				}
 
-				png_init_io(*reader, *file);
+				png_set_read_fn(*reader, &source, import_read_png);
 				png_read_info(*reader, *reader_info);
 
 				dimensions.x = png_get_image_width(*reader, *reader_info);
 				if(!dimensions.x) {
-					import_cleanup_png(file, reader, reader_info);
+					import_cleanup_png(reader, reader_info);
 					THROW_GAEA_TEXTURE_EXCEPTION_FORMAT(GAEA_TEXTURE_EXCEPTION_EXTERNAL,
 						"png_get_image_width failed: %u (must be >0)", dimensions.x);
 				}
 
 				dimensions.y = png_get_image_height(*reader, *reader_info);
 				if(!dimensions.y) {
-					import_cleanup_png(file, reader, reader_info);
+					import_cleanup_png(reader, reader_info);
 					THROW_GAEA_TEXTURE_EXCEPTION_FORMAT(GAEA_TEXTURE_EXCEPTION_EXTERNAL,
 						"png_get_image_height failed: %u (must be >0)", dimensions.y);
 				}
@@ -176,7 +185,10 @@ namespace gaea {
 			{
 				size_t iter = 0;
 				png_uint_32 width;
-				FILE *file = nullptr;
+				size_t mapped_length;
+				std::vector<uint8_t> buffer;
+				std::shared_ptr<const uint8_t> mapped;
+				gaea::graphics::texture::import_source_t source;
 				png_structp reader = nullptr;
 				png_infop reader_info = nullptr;
 				std::vector<png_bytep> data_ptr;
@@ -188,10 +200,25 @@ namespace gaea {
 
 				switch(type) {
 					case IMAGE_PNG:
-						import_setup_png(texture, color, depth, dimensions, &file, &reader, &reader_info);
+
+						if(!gaea::engine::archive::map(texture, mapped, mapped_length)) {
+
+							if(!gaea::engine::archive::load(texture, buffer)) {
+								THROW_GAEA_TEXTURE_EXCEPTION_FORMAT(GAEA_TEXTURE_EXCEPTION_NOT_FOUND,
+									"%s", STRING_CHECK(texture));
+							}
+
+							mapped_length = buffer.size();
+						}
+
+						source.data = (mapped ? mapped.get() : buffer.data());
+						source.length = mapped_length;
+						source.offset = 0;
+						import_setup_png(texture, color, depth, dimensions, source, &reader, &reader_info);
 
 						width = png_get_rowbytes(reader, reader_info);
 						if(!width) {
+							import_cleanup_png(&reader, &reader_info);
 							THROW_GAEA_TEXTURE_EXCEPTION_FORMAT(GAEA_TEXTURE_EXCEPTION_EXTERNAL,
 								"png_get_rowbytes failed: %u (must be >0)", width);
 						}
@@ -203,8 +230,16 @@ namespace gaea {
 							data_ptr.at(iter) = ((&data[0]) + (width * iter));
 						}
 
+						// png_error longjmps to the most recent setjmp, and the one in import_setup_png
+						// went out of scope when it returned, so rearm it in the frame that reads the image
+						if(setjmp(png_jmpbuf(reader))) {
+							import_cleanup_png(&reader, &reader_info);
+							THROW_GAEA_TEXTURE_EXCEPTION_FORMAT(GAEA_TEXTURE_EXCEPTION_EXTERNAL,
+								"png_read_image failed: %s", STRING_CHECK(texture));
+						}
+
 						png_read_image(reader, &data_ptr[0]);
-						import_cleanup_png(&file, &reader, &reader_info);
+						import_cleanup_png(&reader, &reader_info);
 						break;
 					default:
 						THROW_GAEA_TEXTURE_EXCEPTION_FORMAT(GAEA_TEXTURE_EXCEPTION_UNSUPPORTED,
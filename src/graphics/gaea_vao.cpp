@@ -145,6 +145,36 @@ namespace gaea {
 				m_vbo.push_back(gaea::graphics::vbo::base(data, size, target, usage));
 			}
 
+			void 
+			_base::set_attribute(
+				__in GLuint index,
+				__in GLint element_size,
+				__in GLenum element_type,
+				__in_opt GLboolean normalized,
+				__in_opt GLsizei stride,
+				__in_opt const GLvoid *pointer
+				)
+			{
+				GL_CHECK(glBindVertexArray, m_handle);
+				GL_CHECK(glVertexAttribPointer, index, element_size, element_type, 
+					normalized, stride, pointer);
+				m_index.push_back(index);
+			}
+
+			void 
+			_base::set_attribute_integer(
+				__in GLuint index,
+				__in GLint element_size,
+				__in GLenum element_type,
+				__in_opt GLsizei stride,
+				__in_opt const GLvoid *pointer
+				)
+			{
+				GL_CHECK(glBindVertexArray, m_handle);
+				GL_CHECK(glVertexAttribIPointer, index, element_size, element_type, stride, pointer);
+				m_index.push_back(index);
+			}
+
 			void 
 			_base::start(void)
 			{
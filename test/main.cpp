@@ -20,12 +20,45 @@
 #include "../include/gaea.h"
 
 #define INSTANCE_DIM glm::uvec2(1024, 768)
+#define INSTANCE_HEADLESS "--headless"
+#define INSTANCE_PATH_COUNT 16
+#define INSTANCE_PATH_HEIGHT 48.f
+#define INSTANCE_PATH_RADIUS 64.f
+#define INSTANCE_RECORD "--record"
+#define INSTANCE_REPLAY "--replay"
+
+static void 
+instance_path(
+	__out std::vector<gaea::engine::entity::transform_t> &path
+	)
+{
+	GLfloat angle;
+	uint32_t iter = 0;
+	gaea::engine::entity::transform_t transform;
+
+	path.clear();
+
+	for(; iter <= INSTANCE_PATH_COUNT; ++iter) {
+		angle = ((2.f * glm::pi<GLfloat>() * iter) / INSTANCE_PATH_COUNT);
+		transform.position = glm::vec3(INSTANCE_PATH_RADIUS * std::cos(angle), INSTANCE_PATH_HEIGHT,
+			INSTANCE_PATH_RADIUS * std::sin(angle));
+		transform.rotation = glm::normalize(-transform.position);
+		transform.up = glm::vec3(0.f, 1.f, 0.f);
+		path.push_back(transform);
+	}
+}
 
 int 
-main(void)
+main(
+	__in int argc,
+	__in char *argv[]
+	)
 {
-	int result = 0;
-	std::string title;
+	int iter = 1, result = 0;
+	std::string argument, title;
+	bool headless = false, replay = false;
+	uint32_t frames = HEADLESS_FRAMES_INIT;
+	std::vector<gaea::engine::entity::transform_t> path;
 
 	title = STRING_CHECK(gaea::version(true));
 	std::cout << title << std::endl;
@@ -33,6 +66,34 @@ main(void)
 	try {
 		gaea::manager &instance = gaea::manager::acquire();
 		instance.initialize();
+
+		for(; iter < argc; ++iter) {
+			argument = argv[iter];
+
+			if(argument == INSTANCE_HEADLESS) {
+				headless = true;
+
+				if(((iter + 1) < argc) && std::isdigit(argv[iter + 1][0])) {
+					frames = std::stoul(argv[++iter]);
+				}
+			} else if((argument == INSTANCE_RECORD) && ((iter + 1) < argc)) {
+				instance.set_record(argv[++iter]);
+			} else if((argument == INSTANCE_REPLAY) && ((iter + 1) < argc)) {
+				replay = true;
+				instance.set_replay(argv[++iter]);
+			}
+		}
+
+		if(headless) {
+			instance.set_headless(true, frames);
+
+			// a replay drives the camera itself, so only script a path without one
+			if(!replay) {
+				instance_path(path);
+				instance.set_path(path);
+			}
+		}
+
 		instance.start(title, INSTANCE_DIM);
 		instance.stop();
 		instance.uninitialize();
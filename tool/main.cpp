@@ -0,0 +1,80 @@
+/**
+ * Gaea
+ * Copyright (C) 2016 David Jolly
+ * ----------------------
+ *
+ * Gaea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Gaea is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include "../include/gaea.h"
+
+#define ARGUMENT_MIN 3
+#define FLAG_LZ4 "-l"
+#define FLAG_NONE "-n"
+#define FLAG_ZSTD "-z"
+
+void 
+usage(
+	__in const char *name
+	)
+{
+	std::cerr << "Usage: " << name << " <archive> [" << FLAG_NONE << "|" << FLAG_LZ4 << "|"
+		<< FLAG_ZSTD << "] <file> ..." << std::endl
+		<< FLAG_NONE << "\tStore following files uncompressed (page-aligned)" << std::endl
+		<< FLAG_LZ4 << "\tCompress following files with LZ4 (default)" << std::endl
+		<< FLAG_ZSTD << "\tCompress following files with Zstandard" << std::endl;
+}
+
+int 
+main(
+	__in int argc,
+	__in const char *argv[]
+	)
+{
+	int iter = 2, result = 0;
+	gaea::engine::archive::builder builder;
+	gaea::compression_t compression = gaea::ARCHIVE_COMPRESSION_LZ4;
+
+	std::cout << STRING_CHECK(gaea::version(true)) << std::endl;
+
+	if(argc < ARGUMENT_MIN) {
+		usage(argv[0]);
+		return SCALAR_INVALID(int);
+	}
+
+	try {
+
+		for(; iter < argc; ++iter) {
+
+			if(!std::strcmp(argv[iter], FLAG_LZ4)) {
+				compression = gaea::ARCHIVE_COMPRESSION_LZ4;
+			} else if(!std::strcmp(argv[iter], FLAG_NONE)) {
+				compression = gaea::ARCHIVE_COMPRESSION_NONE;
+			} else if(!std::strcmp(argv[iter], FLAG_ZSTD)) {
+				compression = gaea::ARCHIVE_COMPRESSION_ZSTD;
+			} else {
+				builder.add_file(argv[iter], compression);
+			}
+		}
+
+		builder.write(argv[1]);
+		std::cout << argv[1] << ": " << builder.to_string(true) << std::endl;
+	} catch(gaea::exception &exc) {
+		std::cerr << exc.to_string(true) << std::endl;
+		result = SCALAR_INVALID(int);
+	}
+
+	return result;
+}